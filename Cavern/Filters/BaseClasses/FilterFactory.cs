@@ -10,5 +10,12 @@ namespace Cavern.Filters {
         /// Creates a gain filter with the specified <paramref name="gain"/> value in decibels.
         /// </summary>
         public static IGainFilter CreateGain(double gain) => CavernAmp.Available ? (IGainFilter)new GainAmp(gain) : new Gain(gain);
+
+        /// <summary>
+        /// Creates a biquad filter of the given <paramref name="type"/>.
+        /// </summary>
+        public static Filter CreateBiquad(BiquadFilterType type, int sampleRate, double centerFreq, double q, double gain) =>
+            CavernAmp.Available ? (Filter)new BiquadFilterAmp(type, sampleRate, centerFreq, q, gain) :
+                BiquadFilter.Create(type, sampleRate, centerFreq, q, gain);
     }
 }
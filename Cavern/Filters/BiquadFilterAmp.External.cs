@@ -0,0 +1,156 @@
+using System;
+using System.Runtime.InteropServices;
+
+namespace Cavern.Filters {
+    /// <summary>
+    /// Wrapper for CavernAmp's implementation of <see cref="BiquadFilter"/>.
+    /// </summary>
+    public partial class BiquadFilterAmp {
+        /// <summary>
+        /// Create a biquad filter of the given <see cref="BiquadFilterType"/>.
+        /// </summary>
+        [DllImport("CavernAmp.dll")]
+        static extern IntPtr BiquadFilter_Create(int type, int sampleRate, double centerFreq, double q, double gain);
+
+        /// <summary>
+        /// The enumerated type of the filter.
+        /// </summary>
+        [DllImport("CavernAmp.dll")]
+        static extern int BiquadFilter_GetFilterType(IntPtr instance);
+
+        /// <summary>
+        /// Audio sample rate.
+        /// </summary>
+        [DllImport("CavernAmp.dll")]
+        static extern int BiquadFilter_GetSampleRate(IntPtr instance);
+
+        /// <summary>
+        /// Change the sample rate and regenerate the transfer function.
+        /// </summary>
+        [DllImport("CavernAmp.dll")]
+        static extern void BiquadFilter_SetSampleRate(IntPtr instance, int sampleRate);
+
+        /// <summary>
+        /// Center frequency (-3 dB point) of the filter.
+        /// </summary>
+        [DllImport("CavernAmp.dll")]
+        static extern double BiquadFilter_GetCenterFreq(IntPtr instance);
+
+        /// <summary>
+        /// Change the center frequency and regenerate the transfer function.
+        /// </summary>
+        [DllImport("CavernAmp.dll")]
+        static extern void BiquadFilter_SetCenterFreq(IntPtr instance, double centerFreq);
+
+        /// <summary>
+        /// Q-factor of the filter.
+        /// </summary>
+        [DllImport("CavernAmp.dll")]
+        static extern double BiquadFilter_GetQ(IntPtr instance);
+
+        /// <summary>
+        /// Change the Q-factor and regenerate the transfer function.
+        /// </summary>
+        [DllImport("CavernAmp.dll")]
+        static extern void BiquadFilter_SetQ(IntPtr instance, double q);
+
+        /// <summary>
+        /// Gain of the filter in decibels.
+        /// </summary>
+        [DllImport("CavernAmp.dll")]
+        static extern double BiquadFilter_GetGain(IntPtr instance);
+
+        /// <summary>
+        /// Change the gain and regenerate the transfer function.
+        /// </summary>
+        [DllImport("CavernAmp.dll")]
+        static extern void BiquadFilter_SetGain(IntPtr instance, double gain);
+
+        /// <summary>
+        /// Is the phase response swapped, delaying higher frequencies.
+        /// </summary>
+        [DllImport("CavernAmp.dll")]
+        [return: MarshalAs(UnmanagedType.I1)]
+        static extern bool BiquadFilter_GetPhaseSwapped(IntPtr instance);
+
+        /// <summary>
+        /// Swap the phase response, returns false if the type is not phase-swappable.
+        /// </summary>
+        [DllImport("CavernAmp.dll")]
+        [return: MarshalAs(UnmanagedType.I1)]
+        static extern bool BiquadFilter_SetPhaseSwapped(IntPtr instance, [MarshalAs(UnmanagedType.I1)] bool phaseSwapped);
+
+        /// <summary>
+        /// Transfer function variable.
+        /// </summary>
+        [DllImport("CavernAmp.dll")]
+        static extern float BiquadFilter_GetA1(IntPtr instance);
+
+        /// <summary>
+        /// Transfer function variable.
+        /// </summary>
+        [DllImport("CavernAmp.dll")]
+        static extern float BiquadFilter_GetA2(IntPtr instance);
+
+        /// <summary>
+        /// Transfer function variable.
+        /// </summary>
+        [DllImport("CavernAmp.dll")]
+        static extern float BiquadFilter_GetB0(IntPtr instance);
+
+        /// <summary>
+        /// Transfer function variable.
+        /// </summary>
+        [DllImport("CavernAmp.dll")]
+        static extern float BiquadFilter_GetB1(IntPtr instance);
+
+        /// <summary>
+        /// Transfer function variable.
+        /// </summary>
+        [DllImport("CavernAmp.dll")]
+        static extern float BiquadFilter_GetB2(IntPtr instance);
+
+        /// <summary>
+        /// Clear the history of the filter.
+        /// </summary>
+        [DllImport("CavernAmp.dll")]
+        static extern void BiquadFilter_Reset(IntPtr instance);
+
+        /// <summary>
+        /// Regenerate the transfer function.
+        /// </summary>
+        [DllImport("CavernAmp.dll")]
+        static extern void BiquadFilter_ResetParameters(IntPtr instance, double centerFreq, double q, double gain);
+
+        /// <summary>
+        /// Create a filter of the same type with an inverse gain.
+        /// </summary>
+        [DllImport("CavernAmp.dll")]
+        static extern IntPtr BiquadFilter_GetInverse(IntPtr instance);
+
+        /// <summary>
+        /// Calculate the maximum distance of the filter's poles from the origin.
+        /// </summary>
+        [DllImport("CavernAmp.dll")]
+        static extern float BiquadFilter_GetPoleRadius(IntPtr instance);
+
+        /// <summary>
+        /// Create a copy of the filter with a changed sample rate.
+        /// </summary>
+        [DllImport("CavernAmp.dll")]
+        static extern IntPtr BiquadFilter_CloneWithSampleRate(IntPtr instance, int sampleRate);
+
+        /// <summary>
+        /// Is the block state-space processing enabled for single channel signals.
+        /// </summary>
+        [DllImport("CavernAmp.dll")]
+        [return: MarshalAs(UnmanagedType.I1)]
+        static extern bool BiquadFilter_GetBlockProcessing(IntPtr instance);
+
+        /// <summary>
+        /// Process single channel signals in blocks of 8 samples with a matrix-vector product.
+        /// </summary>
+        [DllImport("CavernAmp.dll")]
+        static extern void BiquadFilter_SetBlockProcessing(IntPtr instance, [MarshalAs(UnmanagedType.I1)] bool enabled);
+    }
+}
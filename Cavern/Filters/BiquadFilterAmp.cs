@@ -0,0 +1,143 @@
+using System;
+using System.ComponentModel;
+
+using Cavern.Filters.Interfaces;
+using Cavern.Utilities;
+
+namespace Cavern.Filters {
+    /// <summary>
+    /// A version of a <see cref="BiquadFilter"/> running in <see cref="CavernAmp"/>.
+    /// </summary>
+    public partial class BiquadFilterAmp : FilterAmp, IResettableFilter, ISampleRateDependentFilter {
+        /// <inheritdoc/>
+        public int SampleRate {
+            get => BiquadFilter_GetSampleRate(Handle);
+            set => BiquadFilter_SetSampleRate(Handle, value);
+        }
+
+        /// <summary>
+        /// Center frequency (-3 dB point) of the filter.
+        /// </summary>
+        [DisplayName("Center frequency (Hz)")]
+        public double CenterFreq {
+            get => BiquadFilter_GetCenterFreq(Handle);
+            set => BiquadFilter_SetCenterFreq(Handle, value);
+        }
+
+        /// <summary>
+        /// Q-factor of the filter.
+        /// </summary>
+        [DisplayName("Q-factor")]
+        public double Q {
+            get => BiquadFilter_GetQ(Handle);
+            set => BiquadFilter_SetQ(Handle, value);
+        }
+
+        /// <summary>
+        /// Gain of the filter in decibels.
+        /// </summary>
+        [DisplayName("Gain (dB)")]
+        public double Gain {
+            get => BiquadFilter_GetGain(Handle);
+            set => BiquadFilter_SetGain(Handle, value);
+        }
+
+        /// <summary>
+        /// Biquad filters usually achieve their effect by delaying lower frequencies. Phase swapping delays higher frequencies.
+        /// Only has an effect on the types that are <see cref="PhaseSwappableBiquadFilter"/>s in managed code.
+        /// </summary>
+        [DisplayName("Phase-swapped")]
+        public bool PhaseSwapped {
+            get => BiquadFilter_GetPhaseSwapped(Handle);
+            set => BiquadFilter_SetPhaseSwapped(Handle, value);
+        }
+
+        /// <summary>
+        /// Process single channel signals in blocks of 8 samples, each calculated from its inputs and the history at once,
+        /// instead of the sample-by-sample recurrence. Has no effect on interlaced signals.
+        /// </summary>
+        [DisplayName("Block processing")]
+        public bool BlockProcessing {
+            get => BiquadFilter_GetBlockProcessing(Handle);
+            set => BiquadFilter_SetBlockProcessing(Handle, value);
+        }
+
+#pragma warning disable IDE1006 // Naming Styles
+        /// <summary>
+        /// Transfer function variable.
+        /// </summary>
+        public float a1 => BiquadFilter_GetA1(Handle);
+
+        /// <summary>
+        /// Transfer function variable.
+        /// </summary>
+        public float a2 => BiquadFilter_GetA2(Handle);
+
+        /// <summary>
+        /// Transfer function variable.
+        /// </summary>
+        public float b0 => BiquadFilter_GetB0(Handle);
+
+        /// <summary>
+        /// Transfer function variable.
+        /// </summary>
+        public float b1 => BiquadFilter_GetB1(Handle);
+
+        /// <summary>
+        /// Transfer function variable.
+        /// </summary>
+        public float b2 => BiquadFilter_GetB2(Handle);
+#pragma warning restore IDE1006 // Naming Styles
+
+        /// <summary>
+        /// The enumerated type of this filter.
+        /// </summary>
+        public BiquadFilterType FilterType => (BiquadFilterType)BiquadFilter_GetFilterType(Handle);
+
+        /// <summary>
+        /// Simple first-order biquad filter of any type.
+        /// </summary>
+        /// <param name="type">The enumerated type of the filter</param>
+        /// <param name="sampleRate">Audio sample rate</param>
+        /// <param name="centerFreq">Center frequency (-3 dB point) of the filter</param>
+        /// <param name="q">Q-factor of the filter</param>
+        /// <param name="gain">Gain of the filter in decibels</param>
+        public BiquadFilterAmp(BiquadFilterType type, int sampleRate, double centerFreq, double q, double gain) :
+            base(BiquadFilter_Create((int)type, sampleRate, centerFreq, q, gain)) { }
+
+        /// <summary>
+        /// Wraps a native filter instance.
+        /// </summary>
+        BiquadFilterAmp(IntPtr handle) : base(handle) { }
+
+        /// <inheritdoc/>
+        public void Reset() => BiquadFilter_Reset(Handle);
+
+        /// <summary>
+        /// Regenerate the transfer function.
+        /// </summary>
+        /// <param name="centerFreq">Center frequency (-3 dB point) of the filter</param>
+        /// <param name="q">Q-factor of the filter</param>
+        /// <param name="gain">Gain of the filter in decibels</param>
+        public void Reset(double centerFreq, double q, double gain) => BiquadFilter_ResetParameters(Handle, centerFreq, q, gain);
+
+        /// <summary>
+        /// Clone the filter with an inverse gain.
+        /// </summary>
+        public BiquadFilterAmp GetInverse() => new BiquadFilterAmp(BiquadFilter_GetInverse(Handle));
+
+        /// <summary>
+        /// Calculate the maximum distance of the filter's poles from the origin.
+        /// </summary>
+        public float GetPoleRadius() => BiquadFilter_GetPoleRadius(Handle);
+
+        /// <inheritdoc/>
+        public override object Clone() => new BiquadFilterAmp(CavernAmp.Filter_Clone(Handle));
+
+        /// <summary>
+        /// Create a copy of this filter with a changed <see cref="SampleRate"/>.
+        /// </summary>
+        /// <param name="sampleRate">Sample rate of the new filter</param>
+        public object Clone(int sampleRate) => new BiquadFilterAmp(BiquadFilter_CloneWithSampleRate(Handle, sampleRate));
+    }
+}
@@ -3,7 +3,7 @@
 
 #include "../../Cavern/Utilities/graphUtils.h"
 #include "peakingEqualizer.h"
-#include "../../Cavern/Filters/peakingFilter.h"
+#include "../../Cavern/Filters/biquadFilter.h"
 #include "../../Cavern/Utilities/qmath.h"
 #include "../../Cavern/Utilities/waveformUtils.h"
 
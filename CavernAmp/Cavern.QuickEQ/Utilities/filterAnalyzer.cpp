@@ -28,7 +28,11 @@ void FilterAnalyzer::ClearFilter() {
 float* FilterAnalyzer::GetSpectrum() {
     memcpy(spectrum, impulseReference, resolution * sizeof(float));
     filter->Process(spectrum, resolution);
-    InPlaceFFT1D(spectrum, resolution, cache);
+    InPlaceRealFFT(spectrum, resolution, cache);
+    Complex *bins = (Complex*)spectrum;
+    for (int i = 0, end = resolution / 2; i <= end; i++) {
+        spectrum[i] = bins[i].getMagnitude(); // Never overwrites an unread bin
+    }
     return spectrum;
 }
 
@@ -46,7 +50,7 @@ void FilterAnalyzer::SetResolution(const int value) {
     impulseReference = new float[resolution]();
     impulseReference[0] = 1;
     cache = new FFTCache(resolution);
-    spectrum = new float[resolution];
+    spectrum = new float[resolution + 2];
 }
 
 FilterAnalyzer* DLL_EXPORT FilterAnalyzer_Create(const int sampleRate, const double maxGain, const double minGain, const double gainPrecision, const double startQ, const int iterations) {
@@ -3,7 +3,7 @@
 
 #include "../../Cavern/Utilities/complex.h"
 #include "../../Cavern/Utilities/fftcache.h"
-#include "../../Cavern/Filters/peakingFilter.h"
+#include "../../Cavern/Filters/biquadFilter.h"
 
 /// Class
 // Measures properties of a filter, like frequency/impulse response, gain, or delay.
@@ -27,6 +27,7 @@ public:
     void Reset(PeakingFilter *filter, const int sampleRate);
     void ClearFilter();
     int GetSampleRate() { return sampleRate; }
+    // Get the magnitudes of the resolution / 2 + 1 frequency bins from DC to Nyquist.
     float* GetSpectrum();
     ~FilterAnalyzer();
 
@@ -154,12 +154,10 @@ std::vector<FilterGraphNode*> FilterGraphNodeUtils::TopologicalSort(
 
 void FilterGraphNodeUtils::ConvertToConvolution(
     FilterGraphNode* node, int sampleRate, int filterLength) {
-    float* impulse = new float[filterLength]();
-    impulse[0] = 1;
-
+    std::vector<Filter*> chain;
     FilterGraphNode* downmergeUntil = node;
     while (true) {
-        downmergeUntil->pFilter->Process(impulse, filterLength);
+        chain.push_back(downmergeUntil->pFilter);
         const auto& children = downmergeUntil->GetChildren();
         if (children.size() != 1 || downmergeUntil->GetParents().size() != 1) {
             break;
@@ -171,8 +169,22 @@ void FilterGraphNodeUtils::ConvertToConvolution(
     std::vector<FilterGraphNode*> newChildren(newChildrenList.begin(), newChildrenList.end());
     downmergeUntil->DetachChildren();
 
-    node->pFilter = new FastConvolver(impulse, filterLength, 0);
-    delete[] impulse;
+    // Chains of only biquads, like equalizers, are cheaper to run sample by sample than to convolve
+    Filter* merged = BiquadCascade::Merge(chain, true);
+    if (merged) {
+        node->pFilter = merged;
+    } else {
+        float* impulse = new float[filterLength]();
+        impulse[0] = 1;
+        for (size_t i = 0; i < chain.size(); i++) {
+            chain[i]->Process(impulse, filterLength);
+        }
+
+        // Band-limited chains, like subwoofer and LFE filters, are convolved at a fraction of the sample rate
+        Filter* convolver = MultirateConvolver::CreateIfBandLimited(impulse, filterLength);
+        node->pFilter = convolver ? convolver : new FastConvolver(impulse, filterLength, 0);
+        delete[] impulse;
+    }
 
     node->DetachChildren();
     for (size_t i = 0; i < newChildren.size(); i++) {
@@ -8,13 +8,17 @@
 #include <vector>
 
 #include "../../../export.h"
+#include "../biquadCascade.h"
 #include "../fastConvolver.h"
+#include "../multirateConvolver.h"
 #include "filterGraphNode.h"
 
 /// \brief Special functions for handling FilterGraphNodes.
 class DLL_EXPORT FilterGraphNodeUtils {
 public:
     /// Convert the filter graph's filters to convolutions, and merge chains together to a single filter.
+    /// Chains without high frequency content are convolved at a reduced sample rate, and chains of only biquads are
+    /// merged to a single BiquadCascade instead.
     /// \param rootNodes All root nodes (nodes with no parents)
     /// \param sampleRate Audio sample rate
     /// \param filterLength Length of the convolution filter
@@ -64,7 +68,7 @@ public:
     static std::vector<FilterGraphNode*> TopologicalSort(const std::vector<FilterGraphNode*>& rootNodes);
 
 private:
-    /// Converts this filter to a convolution and upmerges all children until possible.
+    /// Converts this filter to a convolution (or a biquad cascade) and upmerges all children until possible.
     static void ConvertToConvolution(FilterGraphNode* node, int sampleRate, int filterLength);
 
     /// Starting from a single node, checks if the graph has cycles.
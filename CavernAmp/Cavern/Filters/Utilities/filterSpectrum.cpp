@@ -0,0 +1,73 @@
+#include <cstring>
+
+#include "filterSpectrum.h"
+#include "../../Utilities/measurements.h"
+
+// Sum of the memory usage of all existing spectra.
+static std::atomic<long long> totalMemory { 0 };
+
+FilterSpectrum::FilterSpectrum(const int filterLength) : references(1), filterLength(filterLength),
+    bins(new Complex[(filterLength >> 1) + 1]) {
+    totalMemory += MemoryUsage();
+}
+
+FilterSpectrum::~FilterSpectrum() {
+    totalMemory -= MemoryUsage();
+    delete[] bins;
+}
+
+long long FilterSpectrum::MemoryUsage() const {
+    return ((filterLength >> 1) + 1) * (long long)sizeof(Complex);
+}
+
+void FilterSpectrum::Fill(const float *impulse, const int len, FFTCache *cache) {
+    float *samples = (float*)bins,
+        multiplier = 1.f / filterLength; // The normalization of the inverse transform is done by the filter
+    for (int sample = 0; sample < len; sample++) {
+        samples[sample] = impulse[sample] * multiplier;
+    }
+    memset(samples + len, 0, (filterLength - len) * sizeof(float));
+    ProcessRealFFT(samples, filterLength, cache);
+}
+
+FilterSpectrum* FilterSpectrum::Create(const float *impulse, const int len, const int filterLength, FFTCache *cache) {
+    FilterSpectrum *spectrum = new FilterSpectrum(filterLength);
+    spectrum->Fill(impulse, len, cache);
+    return spectrum;
+}
+
+FilterSpectrum* FilterSpectrum::Recreate(FilterSpectrum *spare, const float *impulse, const int len, const int filterLength,
+    FFTCache *cache) {
+    if (spare) {
+        if (spare->filterLength == filterLength) {
+            spare->Fill(impulse, len, cache);
+            return spare;
+        }
+        Release(spare);
+    }
+    return Create(impulse, len, filterLength, cache);
+}
+
+FilterSpectrum* FilterSpectrum::Reclaim(const FilterSpectrum *spectrum) {
+    // With a single reference, no one else can read the spectrum, so it's safe to overwrite it
+    if (spectrum->references.load(std::memory_order_acquire) == 1) {
+        return const_cast<FilterSpectrum*>(spectrum);
+    }
+    Release(spectrum);
+    return nullptr;
+}
+
+const FilterSpectrum* FilterSpectrum::Acquire(const FilterSpectrum *spectrum) {
+    spectrum->references.fetch_add(1, std::memory_order_relaxed);
+    return spectrum;
+}
+
+void FilterSpectrum::Release(const FilterSpectrum *spectrum) {
+    if (spectrum->references.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        delete spectrum;
+    }
+}
+
+long long DLL_EXPORT FilterSpectrum_GetMemoryUsage() {
+    return totalMemory;
+}
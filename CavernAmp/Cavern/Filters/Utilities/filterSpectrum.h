@@ -0,0 +1,60 @@
+#ifndef FILTERSPECTRUM_H
+#define FILTERSPECTRUM_H
+
+#include <atomic>
+
+#include "../../../export.h"
+#include "../../Utilities/complex.h"
+#include "../../Utilities/fftcache.h"
+
+/// Transformed impulse of a convolution filter, shared between the copies of the filter. A spectrum is only written while
+/// it has a single owner: a const spectrum is shared and read-only, and replacing a filter's impulse writes a spectrum that
+/// no copy of the filter can read, so the copies keep the one they had.
+class FilterSpectrum {
+    // Number of filters using this spectrum.
+    mutable std::atomic<int> references;
+
+    FilterSpectrum(const int filterLength);
+    ~FilterSpectrum();
+
+    // Transform an impulse to the bins.
+    void Fill(const float *impulse, const int len, FFTCache *cache);
+
+public:
+    // Length of the real signal the impulse was zero padded to before the transform.
+    const int filterLength;
+    // The filterLength / 2 + 1 bins of the real transform, prescaled by the inverse transform's normalization.
+    Complex *const bins;
+
+    // Size of the spectrum in memory in bytes.
+    long long MemoryUsage() const;
+
+    // Transform an impulse of len samples zero padded to filterLength, which shall be supported by the cache.
+    // The created spectrum has a single reference.
+    static FilterSpectrum* Create(const float *impulse, const int len, const int filterLength, FFTCache *cache);
+    // Create a spectrum like Create, but overwrite an owned spare spectrum if it has the same length.
+    // Otherwise, the spare is released.
+    static FilterSpectrum* Recreate(FilterSpectrum *spare, const float *impulse, const int len, const int filterLength,
+        FFTCache *cache);
+    // Get a spectrum back for writing if the caller holds its only reference. Otherwise, the caller's reference is
+    // released, and nullptr is returned.
+    static FilterSpectrum* Reclaim(const FilterSpectrum *spectrum);
+    // Get another reference to a spectrum.
+    static const FilterSpectrum* Acquire(const FilterSpectrum *spectrum);
+    // Release a reference to a spectrum, which is freed when the last reference is released.
+    static void Release(const FilterSpectrum *spectrum);
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Exports
+// Memory used by all filter spectra in bytes, spectra shared by multiple filters are only counted once.
+long long DLL_EXPORT FilterSpectrum_GetMemoryUsage();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // FILTERSPECTRUM_H
@@ -0,0 +1,205 @@
+#include <algorithm>
+#include <cstring>
+#include <immintrin.h>
+
+#include "biquadBank.h"
+
+using namespace std;
+
+// Maximum number of frames processed at once, a run of a group fits in the L1 cache.
+static const int runLength = 256;
+
+BiquadBank::BiquadBank(const int channels, const int bands) {
+    if (channels <= 0 || bands <= 0) {
+        this->channels = 0;
+        this->bands = 0;
+        groups = 0;
+        coefficients = nullptr;
+        state = nullptr;
+        work = nullptr;
+        return;
+    }
+
+    this->channels = channels;
+    this->bands = bands;
+    groups = (channels + 7) >> 3;
+    coefficients = (float*)_mm_malloc(groups * bands * 5 * 8 * sizeof(float), 32);
+    for (int filter = 0; filter < groups * bands; filter++) {
+        float *target = coefficients + filter * 40;
+        memset(target, 0, 40 * sizeof(float));
+        for (int lane = 0; lane < 8; lane++) {
+            target[lane] = 1; // b0 of pass-through
+        }
+    }
+    state = (float*)_mm_malloc(groups * bands * 2 * 8 * sizeof(float), 32);
+    memset(state, 0, groups * bands * 2 * 8 * sizeof(float));
+    work = (float*)_mm_malloc(runLength * 8 * sizeof(float), 32);
+}
+
+BiquadBank::BiquadBank(const BiquadBank &other) {
+    channels = other.channels;
+    bands = other.bands;
+    groups = other.groups;
+    if (!other.coefficients) {
+        coefficients = nullptr;
+        state = nullptr;
+        work = nullptr;
+        return;
+    }
+    coefficients = (float*)_mm_malloc(groups * bands * 5 * 8 * sizeof(float), 32);
+    memcpy(coefficients, other.coefficients, groups * bands * 5 * 8 * sizeof(float));
+    state = (float*)_mm_malloc(groups * bands * 2 * 8 * sizeof(float), 32);
+    memset(state, 0, groups * bands * 2 * 8 * sizeof(float));
+    work = (float*)_mm_malloc(runLength * 8 * sizeof(float), 32);
+}
+
+int BiquadBank::GetChannels() const {
+    return channels;
+}
+
+int BiquadBank::GetBands() const {
+    return bands;
+}
+
+bool BiquadBank::SetBiquad(const int channel, const int band, const float b0, const float b1, const float b2,
+    const float a1, const float a2) {
+    if (channel < 0 || channel >= channels || band < 0 || band >= bands) {
+        return false;
+    }
+
+    float *target = coefficients + ((channel >> 3) * bands + band) * 40 + (channel & 7);
+    target[0] = b0;
+    target[8] = b1;
+    target[16] = b2;
+    target[24] = a1;
+    target[32] = a2;
+    return true;
+}
+
+void BiquadBank::Reset() {
+    if (state) {
+        memset(state, 0, groups * bands * 2 * 8 * sizeof(float));
+    }
+}
+
+void BiquadBank::Process(float *samples, int len) {
+    Process(samples, len, 0, channels);
+}
+
+void BiquadBank::Process(float *samples, int len, int channel, int channels) {
+    if (!samples || len <= 0 || channel < 0 || channel + this->channels > channels || !coefficients) {
+        return;
+    }
+
+    int frames = len / channels;
+    for (int start = 0; start < frames; start += runLength) {
+        ProcessRun(samples + start * channels, min(frames - start, runLength), channel, channels);
+    }
+}
+
+void BiquadBank::ProcessRun(float *samples, int frames, int channel, int channels) {
+    for (int group = 0; group < groups; group++) {
+        // The last group might not have all 8 channels, its other lanes are neither read nor written
+        int lanes = min(this->channels - (group << 3), 8);
+        __m256i mask = _mm256_castps_si256(_mm256_cmp_ps(_mm256_setr_ps(0, 1, 2, 3, 4, 5, 6, 7),
+            _mm256_set1_ps((float)lanes), _CMP_LT_OQ));
+        float *source = samples + channel + (group << 3);
+        if (lanes == 8) {
+            for (int frame = 0; frame < frames; frame++) {
+                _mm256_store_ps(work + frame * 8, _mm256_loadu_ps(source + frame * channels));
+            }
+        } else {
+            for (int frame = 0; frame < frames; frame++) {
+                _mm256_store_ps(work + frame * 8, _mm256_maskload_ps(source + frame * channels, mask));
+            }
+        }
+
+        // Bands run through the whole run in pairs with their coefficients and state in registers. The recurrences of
+        // the two bands don't depend on each other, so they hide each other's latency.
+        int band = 0;
+        for (; band + 1 < bands; band += 2) {
+            const float *filter = coefficients + (group * bands + band) * 40;
+            __m256 b0 = _mm256_load_ps(filter), b1 = _mm256_load_ps(filter + 8), b2 = _mm256_load_ps(filter + 16),
+                a1 = _mm256_load_ps(filter + 24), a2 = _mm256_load_ps(filter + 32),
+                nextB0 = _mm256_load_ps(filter + 40), nextB1 = _mm256_load_ps(filter + 48),
+                nextB2 = _mm256_load_ps(filter + 56), nextA1 = _mm256_load_ps(filter + 64),
+                nextA2 = _mm256_load_ps(filter + 72);
+            float *filterState = state + (group * bands + band) * 16;
+            __m256 s1 = _mm256_load_ps(filterState), s2 = _mm256_load_ps(filterState + 8),
+                nextS1 = _mm256_load_ps(filterState + 16), nextS2 = _mm256_load_ps(filterState + 24);
+            for (int frame = 0; frame < frames; frame++) {
+                __m256 x = _mm256_load_ps(work + frame * 8),
+                    y = _mm256_add_ps(_mm256_mul_ps(b0, x), s1);
+                s1 = _mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(b1, x), _mm256_mul_ps(a1, y)), s2);
+                s2 = _mm256_sub_ps(_mm256_mul_ps(b2, x), _mm256_mul_ps(a2, y));
+                __m256 z = _mm256_add_ps(_mm256_mul_ps(nextB0, y), nextS1);
+                nextS1 = _mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(nextB1, y), _mm256_mul_ps(nextA1, z)), nextS2);
+                nextS2 = _mm256_sub_ps(_mm256_mul_ps(nextB2, y), _mm256_mul_ps(nextA2, z));
+                _mm256_store_ps(work + frame * 8, z);
+            }
+            _mm256_store_ps(filterState, s1);
+            _mm256_store_ps(filterState + 8, s2);
+            _mm256_store_ps(filterState + 16, nextS1);
+            _mm256_store_ps(filterState + 24, nextS2);
+        }
+        if (band < bands) {
+            const float *filter = coefficients + (group * bands + band) * 40;
+            __m256 b0 = _mm256_load_ps(filter), b1 = _mm256_load_ps(filter + 8), b2 = _mm256_load_ps(filter + 16),
+                a1 = _mm256_load_ps(filter + 24), a2 = _mm256_load_ps(filter + 32);
+            float *filterState = state + (group * bands + band) * 16;
+            __m256 s1 = _mm256_load_ps(filterState), s2 = _mm256_load_ps(filterState + 8);
+            for (int frame = 0; frame < frames; frame++) {
+                __m256 x = _mm256_load_ps(work + frame * 8),
+                    y = _mm256_add_ps(_mm256_mul_ps(b0, x), s1);
+                s1 = _mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(b1, x), _mm256_mul_ps(a1, y)), s2);
+                s2 = _mm256_sub_ps(_mm256_mul_ps(b2, x), _mm256_mul_ps(a2, y));
+                _mm256_store_ps(work + frame * 8, y);
+            }
+            _mm256_store_ps(filterState, s1);
+            _mm256_store_ps(filterState + 8, s2);
+        }
+
+        if (lanes == 8) {
+            for (int frame = 0; frame < frames; frame++) {
+                _mm256_storeu_ps(source + frame * channels, _mm256_load_ps(work + frame * 8));
+            }
+        } else {
+            for (int frame = 0; frame < frames; frame++) {
+                _mm256_maskstore_ps(source + frame * channels, mask, _mm256_load_ps(work + frame * 8));
+            }
+        }
+    }
+}
+
+Filter* BiquadBank::Clone() const {
+    return new BiquadBank(*this);
+}
+
+BiquadBank::~BiquadBank() {
+    if (coefficients) {
+        _mm_free(coefficients);
+        _mm_free(state);
+        _mm_free(work);
+    }
+}
+
+BiquadBank* DLL_EXPORT BiquadBank_Create(const int channels, const int bands) {
+    return new BiquadBank(channels, bands);
+}
+
+bool DLL_EXPORT BiquadBank_SetBiquad(BiquadBank *instance, int channel, int band, float b0, float b1, float b2,
+    float a1, float a2) {
+    return instance->SetBiquad(channel, band, b0, b1, b2, a1, a2);
+}
+
+void DLL_EXPORT BiquadBank_Reset(BiquadBank *instance) {
+    instance->Reset();
+}
+
+void DLL_EXPORT BiquadBank_Process(BiquadBank *instance, float *samples, int len) {
+    instance->Process(samples, len);
+}
+
+void DLL_EXPORT BiquadBank_Dispose(BiquadBank *instance) {
+    delete instance;
+}
@@ -0,0 +1,83 @@
+#ifndef BIQUADBANK_H
+#define BIQUADBANK_H
+
+#include "../../export.h"
+#include "filter.h"
+
+/// \brief A chain of biquad filters for each channel of an interleaved signal, processed in a single pass. Groups of 8
+/// channels are filtered together in the lanes of AVX registers, with the coefficients of each channel in its own lane,
+/// so a whole multichannel PEQ costs about as much as filtering one group of channels.
+class BiquadBank : public Filter {
+private:
+    /// Number of channels filtered.
+    int channels;
+
+    /// Number of biquads in the chain of each channel, unused ones pass the signal through.
+    int bands;
+
+    /// Number of 8 channel groups.
+    int groups;
+
+    /// b0, b1, b2, a1, a2 of each group's bands, 8 lanes each, for group * bands + band.
+    float *coefficients;
+
+    /// The two states of the transposed direct form II of each group's bands, 8 lanes each, for group * bands + band.
+    float *state;
+
+    /// A run of frames of the group being filtered.
+    float *work;
+
+    /// Filter the channels of a run of frames.
+    void ProcessRun(float *samples, int frames, int channel, int channels);
+
+public:
+    /// Constructs a filter bank for each channel with pass-through bands.
+    BiquadBank(const int channels, const int bands);
+
+    /// Copy the coefficients of another BiquadBank.
+    BiquadBank(const BiquadBank &other);
+
+    BiquadBank& operator=(const BiquadBank&) = delete;
+
+    /// Number of channels filtered.
+    int GetChannels() const;
+
+    /// Number of biquads in the chain of each channel.
+    int GetBands() const;
+
+    /// Set the coefficients of a band of a channel, normalized by a0. Returns false if the channel or the band is out of range.
+    bool SetBiquad(const int channel, const int band, const float b0, const float b1, const float b2,
+        const float a1, const float a2);
+
+    /// Clear the state of all filters.
+    void Reset();
+
+    /// Filter all channels of an interleaved signal.
+    void Process(float *samples, int len);
+    /// Filter the interleaved channels from the given channel of a signal with more channels.
+    void Process(float *samples, int len, int channel, int channels);
+    Filter* Clone() const override;
+    ~BiquadBank();
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Constructs a filter bank for each channel with pass-through bands.
+BiquadBank* DLL_EXPORT BiquadBank_Create(const int channels, const int bands);
+/// Set the coefficients of a band of a channel, normalized by a0. Returns false if the channel or the band is out of range.
+bool DLL_EXPORT BiquadBank_SetBiquad(BiquadBank *instance, int channel, int band, float b0, float b1, float b2,
+    float a1, float a2);
+/// Clear the state of all filters.
+void DLL_EXPORT BiquadBank_Reset(BiquadBank *instance);
+/// Filter all channels of an interleaved signal.
+void DLL_EXPORT BiquadBank_Process(BiquadBank *instance, float *samples, int len);
+/// Free up the filter bank's memory.
+void DLL_EXPORT BiquadBank_Dispose(BiquadBank *instance);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BIQUADBANK_H
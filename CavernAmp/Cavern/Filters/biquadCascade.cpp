@@ -0,0 +1,210 @@
+#include <algorithm>
+#include <cstring>
+
+#include "biquadCascade.h"
+#include "biquadFilter.h"
+
+using namespace std;
+
+// Maximum number of samples processed at once, a run is filtered by each group of sections while it's in the L1 cache.
+static const int runLength = 256;
+// Number of sections filtered together, which is enough for their independent recurrences to fill the pipeline.
+static const int sectionsPerGroup = 4;
+
+// Run a group of sections on a run of samples with their coefficients and state in registers.
+template<typename T, int count>
+static inline void RunSections(T *work, int frames, const float *filter, T *sectionState) {
+    T b0[count], b1[count], b2[count], a1[count], a2[count], s1[count], s2[count];
+    for (int section = 0; section < count; section++) {
+        b0[section] = filter[section * 5];
+        b1[section] = filter[section * 5 + 1];
+        b2[section] = filter[section * 5 + 2];
+        a1[section] = filter[section * 5 + 3];
+        a2[section] = filter[section * 5 + 4];
+        s1[section] = sectionState[section * 2];
+        s2[section] = sectionState[section * 2 + 1];
+    }
+    for (int frame = 0; frame < frames; frame++) {
+        T x = work[frame];
+#pragma GCC unroll 4
+        for (int section = 0; section < count; section++) {
+            T y = b0[section] * x + s1[section];
+            s1[section] = (b1[section] * x + s2[section]) - a1[section] * y;
+            s2[section] = b2[section] * x - a2[section] * y;
+            x = y;
+        }
+        work[frame] = x;
+    }
+    for (int section = 0; section < count; section++) {
+        sectionState[section * 2] = s1[section];
+        sectionState[section * 2 + 1] = s2[section];
+    }
+}
+
+BiquadCascade::BiquadCascade(const int sections, const bool doublePrecision) {
+    this->sections = sections > 0 ? sections : 0;
+    coefficients = new float[this->sections * 5]();
+    for (int section = 0; section < this->sections; section++) {
+        coefficients[section * 5] = 1; // b0 of pass-through
+    }
+    state = doublePrecision ? nullptr : new float[this->sections * 2]();
+    preciseState = doublePrecision ? new double[this->sections * 2]() : nullptr;
+    work = doublePrecision ? nullptr : new float[runLength];
+    preciseWork = doublePrecision ? new double[runLength] : nullptr;
+}
+
+BiquadCascade::BiquadCascade(const BiquadCascade &other) {
+    sections = other.sections;
+    coefficients = new float[sections * 5];
+    memcpy(coefficients, other.coefficients, sections * 5 * sizeof(float));
+    state = other.state ? new float[sections * 2]() : nullptr;
+    preciseState = other.preciseState ? new double[sections * 2]() : nullptr;
+    work = other.work ? new float[runLength] : nullptr;
+    preciseWork = other.preciseWork ? new double[runLength] : nullptr;
+}
+
+BiquadCascade* BiquadCascade::Merge(const std::vector<Filter*> &filters, const bool doublePrecision) {
+    int total = 0;
+    for (size_t i = 0; i < filters.size(); i++) {
+        if (dynamic_cast<BiquadFilter*>(filters[i])) {
+            total++;
+        } else if (BiquadCascade *cascade = dynamic_cast<BiquadCascade*>(filters[i])) {
+            total += cascade->sections;
+        } else {
+            return nullptr;
+        }
+    }
+
+    BiquadCascade *result = new BiquadCascade(total, doublePrecision);
+    float *target = result->coefficients;
+    for (size_t i = 0; i < filters.size(); i++) {
+        if (BiquadFilter *biquad = dynamic_cast<BiquadFilter*>(filters[i])) {
+            const BiquadCoefficients &source = biquad->GetCoefficients();
+            target[0] = source.b0;
+            target[1] = source.b1;
+            target[2] = source.b2;
+            target[3] = source.a1;
+            target[4] = source.a2;
+            target += 5;
+        } else {
+            BiquadCascade *cascade = (BiquadCascade*)filters[i];
+            memcpy(target, cascade->coefficients, cascade->sections * 5 * sizeof(float));
+            target += cascade->sections * 5;
+        }
+    }
+    return result;
+}
+
+int BiquadCascade::GetSections() const {
+    return sections;
+}
+
+bool BiquadCascade::IsDoublePrecision() const {
+    return preciseState != nullptr;
+}
+
+bool BiquadCascade::SetSection(const int section, const float b0, const float b1, const float b2, const float a1,
+    const float a2) {
+    if (section < 0 || section >= sections) {
+        return false;
+    }
+
+    float *target = coefficients + section * 5;
+    target[0] = b0;
+    target[1] = b1;
+    target[2] = b2;
+    target[3] = a1;
+    target[4] = a2;
+    return true;
+}
+
+void BiquadCascade::Reset() {
+    if (state) {
+        memset(state, 0, sections * 2 * sizeof(float));
+    } else {
+        memset(preciseState, 0, sections * 2 * sizeof(double));
+    }
+}
+
+void BiquadCascade::Process(float *samples, int len) {
+    Process(samples, len, 0, 1);
+}
+
+void BiquadCascade::Process(float *samples, int len, int channel, int channels) {
+    if (!samples || len <= 0 || channel < 0 || channels <= 0 || !sections) {
+        return;
+    }
+
+    if (state) {
+        ProcessSamples(samples + channel, len - channel, channels, state, work);
+    } else {
+        ProcessSamples(samples + channel, len - channel, channels, preciseState, preciseWork);
+    }
+}
+
+template<typename T>
+void BiquadCascade::ProcessSamples(float *samples, int len, int stride, T *sectionState, T *work) {
+    int frames = (len + stride - 1) / stride;
+    for (int start = 0; start < frames; start += runLength) {
+        int count = min(frames - start, runLength);
+        float *source = samples + start * stride;
+        for (int frame = 0; frame < count; frame++) {
+            work[frame] = source[frame * stride];
+        }
+
+        // The recurrence of a single section is a chain of dependent operations, the sections of a group hide each
+        // other's latency
+        int section = 0;
+        for (int end = sections - sectionsPerGroup; section <= end; section += sectionsPerGroup) {
+            RunSections<T, sectionsPerGroup>(work, count, coefficients + section * 5, sectionState + section * 2);
+        }
+        switch (sections - section) {
+        case 3:
+            RunSections<T, 3>(work, count, coefficients + section * 5, sectionState + section * 2);
+            break;
+        case 2:
+            RunSections<T, 2>(work, count, coefficients + section * 5, sectionState + section * 2);
+            break;
+        case 1:
+            RunSections<T, 1>(work, count, coefficients + section * 5, sectionState + section * 2);
+            break;
+        }
+
+        for (int frame = 0; frame < count; frame++) {
+            source[frame * stride] = (float)work[frame];
+        }
+    }
+}
+
+Filter* BiquadCascade::Clone() const {
+    return new BiquadCascade(*this);
+}
+
+BiquadCascade::~BiquadCascade() {
+    delete[] coefficients;
+    delete[] state;
+    delete[] preciseState;
+    delete[] work;
+    delete[] preciseWork;
+}
+
+BiquadCascade* DLL_EXPORT BiquadCascade_Create(const int sections, const bool doublePrecision) {
+    return new BiquadCascade(sections, doublePrecision);
+}
+
+bool DLL_EXPORT BiquadCascade_SetSection(BiquadCascade *instance, int section, float b0, float b1, float b2, float a1,
+    float a2) {
+    return instance->SetSection(section, b0, b1, b2, a1, a2);
+}
+
+void DLL_EXPORT BiquadCascade_Reset(BiquadCascade *instance) {
+    instance->Reset();
+}
+
+void DLL_EXPORT BiquadCascade_Process(BiquadCascade *instance, float *samples, int len, int channel, int channels) {
+    instance->Process(samples, len, channel, channels);
+}
+
+void DLL_EXPORT BiquadCascade_Dispose(BiquadCascade *instance) {
+    delete instance;
+}
@@ -0,0 +1,88 @@
+#ifndef BIQUADCASCADE_H
+#define BIQUADCASCADE_H
+
+#include <vector>
+
+#include "../../export.h"
+#include "filter.h"
+
+/// \brief A chain of biquad filters in transposed direct form II. The coefficients and the state of all sections are
+/// contiguous, and groups of sections run together on short runs of samples while they're in the cache, so a whole
+/// equalizer is a single pass over the signal instead of one virtual call and one pass for each band.
+class BiquadCascade : public Filter {
+private:
+    /// Number of sections.
+    int sections;
+
+    /// b0, b1, b2, a1, a2 of each section, normalized by a0.
+    float *coefficients;
+
+    /// The two states of each section when single precision is used, or nullptr.
+    float *state;
+
+    /// The two states of each section when double precision is used, or nullptr.
+    double *preciseState;
+
+    /// A run of samples being filtered when single precision is used, or nullptr.
+    float *work;
+
+    /// A run of samples being filtered when double precision is used, or nullptr.
+    double *preciseWork;
+
+    /// Run all sections on runs of samples, with state of the given precision.
+    template<typename T>
+    void ProcessSamples(float *samples, int len, int stride, T *sectionState, T *work);
+
+public:
+    /// Constructs a cascade of pass-through sections. Double precision state reduces the noise of low frequency bands.
+    BiquadCascade(const int sections, const bool doublePrecision = false);
+
+    /// Copy the coefficients of another BiquadCascade.
+    BiquadCascade(const BiquadCascade &other);
+
+    BiquadCascade& operator=(const BiquadCascade&) = delete;
+
+    /// Create a single cascade from a chain of biquad filters (BiquadFilters and BiquadCascades), or return nullptr if
+    /// any of them is something else.
+    static BiquadCascade* Merge(const std::vector<Filter*> &filters, const bool doublePrecision);
+
+    /// Number of sections.
+    int GetSections() const;
+
+    /// Is the state kept in double precision.
+    bool IsDoublePrecision() const;
+
+    /// Set the coefficients of a section, normalized by a0. Returns false if the section is out of range.
+    bool SetSection(const int section, const float b0, const float b1, const float b2, const float a1, const float a2);
+
+    /// Clear the state of all sections.
+    void Reset();
+
+    /// Apply the filters on an array of samples. One filter should be applied to only one continuous stream of samples.
+    void Process(float *samples, int len);
+    void Process(float *samples, int len, int channel, int channels);
+    Filter* Clone() const override;
+    ~BiquadCascade();
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Constructs a cascade of pass-through sections.
+BiquadCascade* DLL_EXPORT BiquadCascade_Create(const int sections, const bool doublePrecision);
+/// Set the coefficients of a section, normalized by a0. Returns false if the section is out of range.
+bool DLL_EXPORT BiquadCascade_SetSection(BiquadCascade *instance, int section, float b0, float b1, float b2, float a1,
+    float a2);
+/// Clear the state of all sections.
+void DLL_EXPORT BiquadCascade_Reset(BiquadCascade *instance);
+/// Apply the filters on an array of samples (interleaved channels).
+void DLL_EXPORT BiquadCascade_Process(BiquadCascade *instance, float *samples, int len, int channel, int channels);
+/// Free up the cascade's memory.
+void DLL_EXPORT BiquadCascade_Dispose(BiquadCascade *instance);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BIQUADCASCADE_H
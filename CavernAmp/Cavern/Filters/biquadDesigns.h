@@ -0,0 +1,146 @@
+#ifndef BIQUADDESIGNS_H
+#define BIQUADDESIGNS_H
+
+#include <cmath>
+
+/// Supported variants of biquad filters, in the order of Cavern's BiquadFilterType.
+enum class BiquadFilterType {
+    /// Only affects the phase of the signal, selectively delay either side of the center frequency.
+    Allpass,
+    /// Filters the signal to a single band.
+    Bandpass,
+    /// Filters the signal to the high frequencies.
+    Highpass,
+    /// Elevates or lowers high frequency components of the signal.
+    HighShelf,
+    /// Filters the signal to the low frequencies.
+    Lowpass,
+    /// Elevates or lowers low frequency components of the signal.
+    LowShelf,
+    /// Removes a single band from the signal.
+    Notch,
+    /// Modifies the spectrum in a bell shape for a single band.
+    PeakingEQ
+};
+
+/// Transfer function of a biquad filter, normalized by a0.
+struct BiquadCoefficients {
+    float b0, b1, b2, a1, a2;
+};
+
+// Coefficient designs of each filter type. Every design gets the cosine of omega0, alpha, and 1 / a0 as it's the same
+// for most types, and the gain in decibels. Only the phase-swappable designs use the phaseSwapped flag.
+
+/// Sets up a lowpass/highpass filter.
+static inline void DesignPass(BiquadCoefficients &target, float cosW0, float alpha, float divisor, double gain,
+    float b1Pre) {
+    target.a1 = -2 * cosW0 * divisor;
+    target.a2 = (1 - alpha) * divisor;
+    target.b1 = b1Pre * divisor;
+    target.b2 = fabsf(target.b1) * .5f;
+    target.b0 = powf(10, (float)gain * .025f) * target.b2;
+}
+
+struct AllpassDesign {
+    static const BiquadFilterType type = BiquadFilterType::Allpass;
+    static const bool phaseSwappable = true;
+    static void Calculate(BiquadCoefficients &target, float cosW0, float alpha, float divisor, double gain,
+        bool phaseSwapped) {
+        if (phaseSwapped) {
+            divisor = 1 / (1 - alpha);
+            target.a2 = (1 + alpha) * divisor;
+        } else {
+            target.a2 = (1 - alpha) * divisor;
+        }
+        target.b0 = (float)pow(10, gain * .025f) * target.a2;
+        target.b2 = 1; // For APF, b2 = a0, and coefficients are divided by a0
+        target.a1 = target.b1 = -2 * cosW0 * divisor;
+    }
+};
+
+struct BandpassDesign {
+    static const BiquadFilterType type = BiquadFilterType::Bandpass;
+    static const bool phaseSwappable = false;
+    static void Calculate(BiquadCoefficients &target, float cosW0, float alpha, float divisor, double gain, bool) {
+        target.b1 = 0;
+        target.b2 = -alpha * divisor;
+        target.b0 = -target.b2 * (float)pow(10, gain * .05f);
+        target.a1 = -2 * cosW0 * divisor;
+        target.a2 = (1 - alpha) * divisor;
+    }
+};
+
+struct HighpassDesign {
+    static const BiquadFilterType type = BiquadFilterType::Highpass;
+    static const bool phaseSwappable = false;
+    static void Calculate(BiquadCoefficients &target, float cosW0, float alpha, float divisor, double gain, bool) {
+        DesignPass(target, cosW0, alpha, divisor, gain, -1 - cosW0);
+    }
+};
+
+struct HighShelfDesign {
+    static const BiquadFilterType type = BiquadFilterType::HighShelf;
+    static const bool phaseSwappable = false;
+    static void Calculate(BiquadCoefficients &target, float cosW0, float alpha, float, double gain, bool) {
+        float a = (float)pow(10, gain * .025f),
+            slope = 2 * sqrtf(a) * alpha,
+            minCos = (a - 1) * cosW0,
+            addCos = (a + 1) * cosW0;
+        float divisor = 1 / (a + 1 - minCos + slope);
+        target.a1 = 2 * (a - 1 - addCos) * divisor;
+        target.a2 = (a + 1 - minCos - slope) * divisor;
+        target.b0 = a * (a + 1 + minCos + slope) * divisor;
+        target.b1 = -2 * a * (a - 1 + addCos) * divisor;
+        target.b2 = a * (a + 1 + minCos - slope) * divisor;
+    }
+};
+
+struct LowpassDesign {
+    static const BiquadFilterType type = BiquadFilterType::Lowpass;
+    static const bool phaseSwappable = false;
+    static void Calculate(BiquadCoefficients &target, float cosW0, float alpha, float divisor, double gain, bool) {
+        DesignPass(target, cosW0, alpha, divisor, gain, 1 - cosW0);
+    }
+};
+
+struct LowShelfDesign {
+    static const BiquadFilterType type = BiquadFilterType::LowShelf;
+    static const bool phaseSwappable = false;
+    static void Calculate(BiquadCoefficients &target, float cosW0, float alpha, float, double gain, bool) {
+        float a = (float)pow(10, gain * .025f),
+            slope = 2 * sqrtf(a) * alpha,
+            minCos = (a - 1) * cosW0,
+            addCos = (a + 1) * cosW0;
+        float divisor = 1 / (a + 1 + minCos + slope);
+        target.a1 = -2 * (a - 1 + addCos) * divisor;
+        target.a2 = (a + 1 + minCos - slope) * divisor;
+        target.b0 = a * (a + 1 - minCos + slope) * divisor;
+        target.b1 = 2 * a * (a - 1 - addCos) * divisor;
+        target.b2 = a * (a + 1 - minCos - slope) * divisor;
+    }
+};
+
+struct NotchDesign {
+    static const BiquadFilterType type = BiquadFilterType::Notch;
+    static const bool phaseSwappable = false;
+    static void Calculate(BiquadCoefficients &target, float cosW0, float alpha, float divisor, double gain, bool) {
+        target.b0 = (float)pow(10, gain * .025f) * divisor;
+        target.a1 = target.b1 = -2 * cosW0 * (target.b2 = divisor);
+        target.a2 = (1 - alpha) * divisor;
+    }
+};
+
+struct PeakingDesign {
+    static const BiquadFilterType type = BiquadFilterType::PeakingEQ;
+    static const bool phaseSwappable = false;
+    static void Calculate(BiquadCoefficients &target, float cosW0, float alpha, float, double gain, bool) {
+        float a = (float)pow(10, gain * .025f); // A = sqrt(gain), hence /40 instead of /20
+        float divisor = 1 / (1 + alpha / a);
+        target.b0 = (1 + alpha * a) * divisor;
+        target.b2 = (1 - alpha * a) * divisor;
+        target.a1 = target.b1 = -2 * cosW0 * divisor;
+        target.a2 = (1 - alpha / a) * divisor;
+    }
+};
+
+#endif // BIQUADDESIGNS_H
@@ -0,0 +1,350 @@
+#include <algorithm>
+#include <cmath>
+#include <immintrin.h>
+
+#include "biquadFilter.h"
+
+using namespace std;
+
+BiquadFilter::BiquadFilter(int sampleRate) : sampleRate(sampleRate), centerFreq(0), q(Q_REF), gain(0),
+    phaseSwapped(false), coefficients { 1, 0, 0, 0, 0 }, x1(0), x2(0), y1(0), y2(0), blockMatrix(nullptr) { }
+
+BiquadFilter::BiquadFilter(const BiquadFilter &other) : Filter(other), sampleRate(other.sampleRate),
+    centerFreq(other.centerFreq), q(other.q), gain(other.gain), phaseSwapped(other.phaseSwapped),
+    coefficients(other.coefficients), x1(other.x1), x2(other.x2), y1(other.y1), y2(other.y2), blockMatrix(nullptr) {
+    if (other.blockMatrix) {
+        SetBlockProcessing(true);
+    }
+}
+
+BiquadFilter* BiquadFilter::Create(BiquadFilterType type, int sampleRate, double centerFreq, double q, double gain) {
+    switch (type) {
+    case BiquadFilterType::Allpass:
+        return new Allpass(sampleRate, centerFreq, q, gain);
+    case BiquadFilterType::Bandpass:
+        return new Bandpass(sampleRate, centerFreq, q, gain);
+    case BiquadFilterType::Highpass:
+        return new Highpass(sampleRate, centerFreq, q, gain);
+    case BiquadFilterType::HighShelf:
+        return new HighShelf(sampleRate, centerFreq, q, gain);
+    case BiquadFilterType::Lowpass:
+        return new Lowpass(sampleRate, centerFreq, q, gain);
+    case BiquadFilterType::LowShelf:
+        return new LowShelf(sampleRate, centerFreq, q, gain);
+    case BiquadFilterType::Notch:
+        return new Notch(sampleRate, centerFreq, q, gain);
+    case BiquadFilterType::PeakingEQ:
+        return new PeakingFilter(sampleRate, centerFreq, q, gain);
+    default:
+        return nullptr;
+    }
+}
+
+int BiquadFilter::GetSampleRate() const {
+    return sampleRate;
+}
+
+void BiquadFilter::SetSampleRate(int sampleRate) {
+    this->sampleRate = sampleRate;
+    Reset(centerFreq, q, gain);
+}
+
+double BiquadFilter::GetCenterFreq() const {
+    return centerFreq;
+}
+
+void BiquadFilter::SetCenterFreq(double centerFreq) {
+    Reset(centerFreq, q, gain);
+}
+
+double BiquadFilter::GetQ() const {
+    return q;
+}
+
+void BiquadFilter::SetQ(double q) {
+    Reset(centerFreq, q, gain);
+}
+
+double BiquadFilter::GetGain() const {
+    return gain;
+}
+
+void BiquadFilter::SetGain(double gain) {
+    Reset(centerFreq, q, gain);
+}
+
+bool BiquadFilter::GetPhaseSwapped() const {
+    return phaseSwapped;
+}
+
+void BiquadFilter::SetPhaseSwapped(bool phaseSwapped) {
+    if (IsPhaseSwappable()) {
+        this->phaseSwapped = phaseSwapped;
+        Reset(centerFreq, q, gain);
+    }
+}
+
+const BiquadCoefficients& BiquadFilter::GetCoefficients() const {
+    return coefficients;
+}
+
+bool BiquadFilter::GetBlockProcessing() const {
+    return blockMatrix != nullptr;
+}
+
+void BiquadFilter::SetBlockProcessing(bool enabled) {
+    if (enabled && !blockMatrix) {
+        blockMatrix = (float*)_mm_malloc(8 * 8 * sizeof(float) + 4 * 8 * sizeof(double), 32);
+        UpdateBlockMatrix();
+    } else if (!enabled && blockMatrix) {
+        _mm_free(blockMatrix);
+        blockMatrix = nullptr;
+    }
+}
+
+void BiquadFilter::UpdateBlockMatrix() {
+    // Each column is the response of the 8 outputs to a single nonzero input or history sample
+    double b0 = coefficients.b0, b1 = coefficients.b1, b2 = coefficients.b2, a1 = coefficients.a1, a2 = coefficients.a2;
+    double *historyMatrix = (double*)(blockMatrix + 64);
+    for (int column = 0; column < 12; column++) {
+        double input[8] = { 0 }, px1 = column == 8, px2 = column == 9, py1 = column == 10, py2 = column == 11;
+        if (column < 8) {
+            input[column] = 1;
+        }
+        for (int sample = 0; sample < 8; sample++) {
+            double result = b0 * input[sample] + b1 * px1 + b2 * px2 - a1 * py1 - a2 * py2;
+            if (column < 8) {
+                blockMatrix[column * 8 + sample] = (float)result;
+            } else {
+                historyMatrix[(column - 8) * 8 + sample] = result;
+            }
+            px2 = px1;
+            px1 = input[sample];
+            py2 = py1;
+            py1 = result;
+        }
+    }
+}
+
+void BiquadFilter::Reset() {
+    x1 = 0;
+    x2 = 0;
+    y1 = 0;
+    y2 = 0;
+}
+
+void BiquadFilter::Reset(double centerFreq, double q, double gain) {
+    this->centerFreq = centerFreq;
+    this->q = q;
+    this->gain = gain;
+    float w0 = (float)((float)M_PI * 2 * centerFreq / sampleRate), cosW0 = (float)cos(w0),
+        alpha = (float)(sin(w0) / (q + q)), divisor = 1 / (1 + alpha);
+    Design(cosW0, alpha, divisor);
+    if (blockMatrix) {
+        UpdateBlockMatrix();
+    }
+}
+
+BiquadFilter* BiquadFilter::GetInverse() const {
+    BiquadFilter *inverse = Create(GetFilterType(), sampleRate, centerFreq, q, -gain);
+    inverse->SetPhaseSwapped(phaseSwapped);
+    return inverse;
+}
+
+float BiquadFilter::GetPoleRadius() const {
+    float a1 = coefficients.a1, a2 = coefficients.a2, discriminant = a1 * a1 - 4 * a2;
+    return discriminant >= 0 ?
+        max(fabsf((-a1 + sqrtf(discriminant)) * .5f), fabsf((-a1 - sqrtf(discriminant)) * .5f)) :
+        sqrtf(a2);
+}
+
+void BiquadFilter::Process(float *samples, int len) {
+    Process(samples, len, 0, 1);
+}
+
+void BiquadFilter::Process(float *samples, int len, int channel, int channels) {
+    if (blockMatrix && channels == 1) {
+        int processed = ProcessBlocks(samples, len);
+        samples += processed;
+        len -= processed;
+    }
+
+    // The history is kept in locals, as it could alias the samples. The feedforward part and the older feedback are
+    // summed first, which leaves a single multiplication and subtraction on the path from one output to the next.
+    float b0 = coefficients.b0, b1 = coefficients.b1, b2 = coefficients.b2, a1 = coefficients.a1, a2 = coefficients.a2,
+        x1 = this->x1, x2 = this->x2, y1 = this->y1, y2 = this->y2;
+    for (int sample = channel; sample < len; sample += channels) {
+        float thisSample = samples[sample],
+            result = (b2 * x2 + b1 * x1 + b0 * thisSample - a2 * y2) - a1 * y1;
+        samples[sample] = result;
+        y2 = y1;
+        y1 = result;
+        x2 = x1;
+        x1 = thisSample;
+    }
+    this->x1 = x1;
+    this->x2 = x2;
+    this->y1 = y1;
+    this->y2 = y2;
+}
+
+int BiquadFilter::ProcessBlocks(float *samples, int len) {
+    __m256 inputColumns[8];
+    for (int column = 0; column < 8; column++) {
+        inputColumns[column] = _mm256_load_ps(blockMatrix + column * 8);
+    }
+    const double *historyMatrix = (const double*)(blockMatrix + 64);
+    __m256d historyColumns[8];
+    for (int half = 0; half < 8; half++) {
+        historyColumns[half] = _mm256_load_pd(historyMatrix + half * 4);
+    }
+    float x1 = this->x1, x2 = this->x2;
+    __m256d py1 = _mm256_set1_pd(this->y1), py2 = _mm256_set1_pd(this->y2);
+
+    // The history columns cancel each other out for poles close to the unit circle, so they're summed in double
+    // precision, and the feedback is kept in double between blocks. Only the feedback depends on the previous block,
+    // everything else is summed before it's available.
+    int sample = 0;
+    for (int end = len - 7; sample < end; sample += 8) {
+        float *block = samples + sample;
+        __m256 even = _mm256_mul_ps(inputColumns[0], _mm256_broadcast_ss(block)),
+            odd = _mm256_mul_ps(inputColumns[1], _mm256_broadcast_ss(block + 1));
+        even = _mm256_add_ps(even, _mm256_mul_ps(inputColumns[2], _mm256_broadcast_ss(block + 2)));
+        odd = _mm256_add_ps(odd, _mm256_mul_ps(inputColumns[3], _mm256_broadcast_ss(block + 3)));
+        even = _mm256_add_ps(even, _mm256_mul_ps(inputColumns[4], _mm256_broadcast_ss(block + 4)));
+        odd = _mm256_add_ps(odd, _mm256_mul_ps(inputColumns[5], _mm256_broadcast_ss(block + 5)));
+        even = _mm256_add_ps(even, _mm256_mul_ps(inputColumns[6], _mm256_broadcast_ss(block + 6)));
+        odd = _mm256_add_ps(odd, _mm256_mul_ps(inputColumns[7], _mm256_broadcast_ss(block + 7)));
+        __m256 inputs = _mm256_add_ps(even, odd);
+        __m256d px1 = _mm256_set1_pd(x1), px2 = _mm256_set1_pd(x2),
+            low = _mm256_add_pd(_mm256_cvtps_pd(_mm256_castps256_ps128(inputs)),
+                _mm256_add_pd(_mm256_mul_pd(historyColumns[0], px1), _mm256_mul_pd(historyColumns[2], px2))),
+            high = _mm256_add_pd(_mm256_cvtps_pd(_mm256_extractf128_ps(inputs, 1)),
+                _mm256_add_pd(_mm256_mul_pd(historyColumns[1], px1), _mm256_mul_pd(historyColumns[3], px2)));
+        low = _mm256_add_pd(low,
+            _mm256_add_pd(_mm256_mul_pd(historyColumns[4], py1), _mm256_mul_pd(historyColumns[6], py2)));
+        high = _mm256_add_pd(high,
+            _mm256_add_pd(_mm256_mul_pd(historyColumns[5], py1), _mm256_mul_pd(historyColumns[7], py2)));
+        x1 = block[7];
+        x2 = block[6];
+        _mm256_storeu_ps(block,
+            _mm256_insertf128_ps(_mm256_castps128_ps256(_mm256_cvtpd_ps(low)), _mm256_cvtpd_ps(high), 1));
+
+        // The last two outputs are the feedback of the next block
+        __m256d last = _mm256_permute2f128_pd(high, high, 0x11);
+        py1 = _mm256_permute_pd(last, 0xF);
+        py2 = _mm256_permute_pd(last, 0x0);
+    }
+
+    double y1, y2;
+    _mm_store_sd(&y1, _mm256_castpd256_pd128(py1));
+    _mm_store_sd(&y2, _mm256_castpd256_pd128(py2));
+    this->x1 = x1;
+    this->x2 = x2;
+    this->y1 = (float)y1;
+    this->y2 = (float)y2;
+    return sample;
+}
+
+BiquadFilter::~BiquadFilter() {
+    if (blockMatrix) {
+        _mm_free(blockMatrix);
+    }
+}
+
+BiquadFilter* DLL_EXPORT BiquadFilter_Create(int type, int sampleRate, double centerFreq, double q, double gain) {
+    return BiquadFilter::Create((BiquadFilterType)type, sampleRate, centerFreq, q, gain);
+}
+
+int DLL_EXPORT BiquadFilter_GetFilterType(BiquadFilter *instance) {
+    return (int)instance->GetFilterType();
+}
+
+int DLL_EXPORT BiquadFilter_GetSampleRate(BiquadFilter *instance) {
+    return instance->GetSampleRate();
+}
+
+void DLL_EXPORT BiquadFilter_SetSampleRate(BiquadFilter *instance, int sampleRate) {
+    instance->SetSampleRate(sampleRate);
+}
+
+double DLL_EXPORT BiquadFilter_GetCenterFreq(BiquadFilter *instance) {
+    return instance->GetCenterFreq();
+}
+
+void DLL_EXPORT BiquadFilter_SetCenterFreq(BiquadFilter *instance, double centerFreq) {
+    instance->SetCenterFreq(centerFreq);
+}
+
+double DLL_EXPORT BiquadFilter_GetQ(BiquadFilter *instance) {
+    return instance->GetQ();
+}
+
+void DLL_EXPORT BiquadFilter_SetQ(BiquadFilter *instance, double q) {
+    instance->SetQ(q);
+}
+
+double DLL_EXPORT BiquadFilter_GetGain(BiquadFilter *instance) {
+    return instance->GetGain();
+}
+
+void DLL_EXPORT BiquadFilter_SetGain(BiquadFilter *instance, double gain) {
+    instance->SetGain(gain);
+}
+
+bool DLL_EXPORT BiquadFilter_GetPhaseSwapped(BiquadFilter *instance) {
+    return instance->GetPhaseSwapped();
+}
+
+bool DLL_EXPORT BiquadFilter_SetPhaseSwapped(BiquadFilter *instance, bool phaseSwapped) {
+    instance->SetPhaseSwapped(phaseSwapped);
+    return instance->IsPhaseSwappable();
+}
+
+float DLL_EXPORT BiquadFilter_GetA1(BiquadFilter *instance) {
+    return instance->GetCoefficients().a1;
+}
+
+float DLL_EXPORT BiquadFilter_GetA2(BiquadFilter *instance) {
+    return instance->GetCoefficients().a2;
+}
+
+float DLL_EXPORT BiquadFilter_GetB0(BiquadFilter *instance) {
+    return instance->GetCoefficients().b0;
+}
+
+float DLL_EXPORT BiquadFilter_GetB1(BiquadFilter *instance) {
+    return instance->GetCoefficients().b1;
+}
+
+float DLL_EXPORT BiquadFilter_GetB2(BiquadFilter *instance) {
+    return instance->GetCoefficients().b2;
+}
+
+void DLL_EXPORT BiquadFilter_Reset(BiquadFilter *instance) {
+    instance->Reset();
+}
+
+void DLL_EXPORT BiquadFilter_ResetParameters(BiquadFilter *instance, double centerFreq, double q, double gain) {
+    instance->Reset(centerFreq, q, gain);
+}
+
+BiquadFilter* DLL_EXPORT BiquadFilter_GetInverse(BiquadFilter *instance) {
+    return instance->GetInverse();
+}
+
+float DLL_EXPORT BiquadFilter_GetPoleRadius(BiquadFilter *instance) {
+    return instance->GetPoleRadius();
+}
+
+BiquadFilter* DLL_EXPORT BiquadFilter_CloneWithSampleRate(BiquadFilter *instance, int sampleRate) {
+    return instance->Clone(sampleRate);
+}
+
+bool DLL_EXPORT BiquadFilter_GetBlockProcessing(BiquadFilter *instance) {
+    return instance->GetBlockProcessing();
+}
+
+void DLL_EXPORT BiquadFilter_SetBlockProcessing(BiquadFilter *instance, bool enabled) {
+    instance->SetBlockProcessing(enabled);
+}
@@ -0,0 +1,233 @@
+#ifndef BIQUADFILTER_H
+#define BIQUADFILTER_H
+
+#include "../../export.h"
+#include "biquadDesigns.h"
+#include "filter.h"
+
+#define Q_REF 0.7071067811865475
+
+/// \brief Simple first-order biquad filter, the common part of all types. The coefficients are designed by the Biquad
+/// template, which calls the design of its type directly.
+class BiquadFilter : public Filter {
+protected:
+    /// Audio sample rate.
+    int sampleRate;
+
+    /// Center frequency (-3 dB point) of the filter.
+    double centerFreq;
+
+    /// Q-factor of the filter.
+    double q;
+
+    /// Gain of the filter in decibels.
+    double gain;
+
+    /// Delay higher frequencies instead of lower ones, for the types that support it.
+    bool phaseSwapped;
+
+    /// Transfer function of the filter.
+    BiquadCoefficients coefficients;
+
+    /// History samples.
+    float x1, x2, y1, y2;
+
+    /// When block processing is enabled, the contribution of each input sample of a block to its 8 outputs (8 columns),
+    /// followed by the contribution of x1, x2, y1, and y2 in double precision (4 columns), or nullptr otherwise.
+    float *blockMatrix;
+
+    /// Set up a filter with cleared history, the derived constructor designs it.
+    BiquadFilter(int sampleRate);
+
+    /// Copy the parameters and the history of another filter.
+    BiquadFilter(const BiquadFilter &other);
+
+    /// Calculate the block matrix from the current coefficients.
+    void UpdateBlockMatrix();
+
+    /// Process a single channel 8 samples at a time with the block matrix, returns the number of processed samples.
+    int ProcessBlocks(float *samples, int len);
+
+    /// Regenerate the transfer function for the derived filter type.
+    /// \param cosW0 Cosine of omega0
+    /// \param alpha Value of the alpha parameter
+    /// \param divisor 1 / a0, as a0 is the same for most biquad filters
+    virtual void Design(float cosW0, float alpha, float divisor) = 0;
+
+public:
+    BiquadFilter& operator=(const BiquadFilter&) = delete;
+
+    /// Create a biquad filter of the given type.
+    static BiquadFilter* Create(BiquadFilterType type, int sampleRate, double centerFreq, double q = Q_REF,
+        double gain = 0);
+
+    /// The enumerated type of this filter.
+    virtual BiquadFilterType GetFilterType() const = 0;
+
+    /// Can the phase response of this filter type be swapped.
+    virtual bool IsPhaseSwappable() const = 0;
+
+    /// Audio sample rate.
+    int GetSampleRate() const;
+    /// Change the sample rate and regenerate the transfer function.
+    void SetSampleRate(int sampleRate);
+
+    /// Center frequency (-3 dB point) of the filter.
+    double GetCenterFreq() const;
+    /// Change the center frequency and regenerate the transfer function.
+    void SetCenterFreq(double centerFreq);
+
+    /// Q-factor of the filter.
+    double GetQ() const;
+    /// Change the Q-factor and regenerate the transfer function.
+    void SetQ(double q);
+
+    /// Gain of the filter in decibels.
+    double GetGain() const;
+    /// Change the gain and regenerate the transfer function.
+    void SetGain(double gain);
+
+    /// Is the phase response swapped, delaying higher frequencies.
+    bool GetPhaseSwapped() const;
+    /// Swap the phase response and regenerate the transfer function. Ignored for types that are not phase-swappable.
+    void SetPhaseSwapped(bool phaseSwapped);
+
+    /// Transfer function of the filter, normalized by a0.
+    const BiquadCoefficients& GetCoefficients() const;
+
+    /// Is the block state-space processing enabled for single channel signals.
+    bool GetBlockProcessing() const;
+    /// Process single channel signals in blocks of 8 samples, each block is calculated from its inputs and the history
+    /// with a matrix-vector product. This removes the sample-by-sample recurrence, which can't use SIMD.
+    void SetBlockProcessing(bool enabled);
+
+    /// Clear the history of the filter.
+    void Reset();
+
+    /// Regenerate the transfer function.
+    void Reset(double centerFreq, double q = Q_REF, double gain = 0);
+
+    /// Create a filter of the same type with an inverse gain.
+    BiquadFilter* GetInverse() const;
+
+    /// Calculate the maximum distance of the filter's poles from the origin.
+    float GetPoleRadius() const;
+
+    using Filter::Clone;
+    /// Create a copy of this filter with a changed sample rate.
+    virtual BiquadFilter* Clone(int sampleRate) const = 0;
+
+    /// Apply the filter on an array of samples. One filter should be applied to only one continuous stream of samples.
+    void Process(float *samples, int len);
+    void Process(float *samples, int len, int channel, int channels);
+    virtual ~BiquadFilter();
+};
+
+/// A biquad filter of the type designed by the Policy (one of the design structs), which is resolved at compile time.
+template<typename Policy>
+class Biquad : public BiquadFilter {
+protected:
+    void Design(float cosW0, float alpha, float divisor) override {
+        Policy::Calculate(coefficients, cosW0, alpha, divisor, gain, phaseSwapped);
+    }
+
+public:
+    /// Simple first-order biquad filter.
+    /// \param sampleRate Audio sample rate
+    /// \param centerFreq Center frequency (-3 dB point) of the filter
+    /// \param q Q-factor of the filter
+    /// \param gain Gain of the filter in decibels
+    Biquad(int sampleRate, double centerFreq, double q = Q_REF, double gain = 0) : BiquadFilter(sampleRate) {
+        Reset(centerFreq, q, gain);
+    }
+
+    BiquadFilterType GetFilterType() const override {
+        return Policy::type;
+    }
+
+    bool IsPhaseSwappable() const override {
+        return Policy::phaseSwappable;
+    }
+
+    /// Copy of the filter with cleared history.
+    Filter* Clone() const override {
+        Biquad *clone = new Biquad(*this);
+        clone->Reset();
+        return clone;
+    }
+
+    BiquadFilter* Clone(int sampleRate) const override {
+        Biquad *clone = new Biquad(*this);
+        clone->Reset();
+        clone->SetSampleRate(sampleRate);
+        return clone;
+    }
+};
+
+typedef Biquad<AllpassDesign> Allpass;
+typedef Biquad<BandpassDesign> Bandpass;
+typedef Biquad<HighpassDesign> Highpass;
+typedef Biquad<HighShelfDesign> HighShelf;
+typedef Biquad<LowpassDesign> Lowpass;
+typedef Biquad<LowShelfDesign> LowShelf;
+typedef Biquad<NotchDesign> Notch;
+typedef Biquad<PeakingDesign> PeakingFilter;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Create a biquad filter of the given BiquadFilterType.
+BiquadFilter* DLL_EXPORT BiquadFilter_Create(int type, int sampleRate, double centerFreq, double q, double gain);
+/// The enumerated type of the filter.
+int DLL_EXPORT BiquadFilter_GetFilterType(BiquadFilter *instance);
+/// Audio sample rate.
+int DLL_EXPORT BiquadFilter_GetSampleRate(BiquadFilter *instance);
+/// Change the sample rate and regenerate the transfer function.
+void DLL_EXPORT BiquadFilter_SetSampleRate(BiquadFilter *instance, int sampleRate);
+/// Center frequency (-3 dB point) of the filter.
+double DLL_EXPORT BiquadFilter_GetCenterFreq(BiquadFilter *instance);
+/// Change the center frequency and regenerate the transfer function.
+void DLL_EXPORT BiquadFilter_SetCenterFreq(BiquadFilter *instance, double centerFreq);
+/// Q-factor of the filter.
+double DLL_EXPORT BiquadFilter_GetQ(BiquadFilter *instance);
+/// Change the Q-factor and regenerate the transfer function.
+void DLL_EXPORT BiquadFilter_SetQ(BiquadFilter *instance, double q);
+/// Gain of the filter in decibels.
+double DLL_EXPORT BiquadFilter_GetGain(BiquadFilter *instance);
+/// Change the gain and regenerate the transfer function.
+void DLL_EXPORT BiquadFilter_SetGain(BiquadFilter *instance, double gain);
+/// Is the phase response swapped, delaying higher frequencies.
+bool DLL_EXPORT BiquadFilter_GetPhaseSwapped(BiquadFilter *instance);
+/// Swap the phase response, returns false if the type is not phase-swappable.
+bool DLL_EXPORT BiquadFilter_SetPhaseSwapped(BiquadFilter *instance, bool phaseSwapped);
+/// Transfer function variable.
+float DLL_EXPORT BiquadFilter_GetA1(BiquadFilter *instance);
+/// Transfer function variable.
+float DLL_EXPORT BiquadFilter_GetA2(BiquadFilter *instance);
+/// Transfer function variable.
+float DLL_EXPORT BiquadFilter_GetB0(BiquadFilter *instance);
+/// Transfer function variable.
+float DLL_EXPORT BiquadFilter_GetB1(BiquadFilter *instance);
+/// Transfer function variable.
+float DLL_EXPORT BiquadFilter_GetB2(BiquadFilter *instance);
+/// Clear the history of the filter.
+void DLL_EXPORT BiquadFilter_Reset(BiquadFilter *instance);
+/// Regenerate the transfer function.
+void DLL_EXPORT BiquadFilter_ResetParameters(BiquadFilter *instance, double centerFreq, double q, double gain);
+/// Create a filter of the same type with an inverse gain.
+BiquadFilter* DLL_EXPORT BiquadFilter_GetInverse(BiquadFilter *instance);
+/// Calculate the maximum distance of the filter's poles from the origin.
+float DLL_EXPORT BiquadFilter_GetPoleRadius(BiquadFilter *instance);
+/// Create a copy of the filter with a changed sample rate.
+BiquadFilter* DLL_EXPORT BiquadFilter_CloneWithSampleRate(BiquadFilter *instance, int sampleRate);
+/// Is the block state-space processing enabled for single channel signals.
+bool DLL_EXPORT BiquadFilter_GetBlockProcessing(BiquadFilter *instance);
+/// Process single channel signals in blocks of 8 samples with a matrix-vector product.
+void DLL_EXPORT BiquadFilter_SetBlockProcessing(BiquadFilter *instance, bool enabled);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BIQUADFILTER_H
@@ -0,0 +1,171 @@
+#include <algorithm>
+#include <cstring>
+#include <thread>
+
+#include "../Utilities/complexArray.h"
+#include "convolutionMatrix.h"
+#include "../Utilities/fftFallbackCache.h"
+#include "../Utilities/measurements.h"
+#include "../Utilities/Threading/parallelizer.h"
+
+using namespace std;
+
+ConvolutionMatrix::ConvolutionMatrix(const int inputs, const int outputs, const int maxLength) : multithreaded(false) {
+    if (inputs <= 0 || outputs <= 0 || maxLength <= 0) {
+        this->inputs = 0;
+        this->outputs = 0;
+        filterLength = 0;
+        filters = nullptr;
+        inputSpectra = nullptr;
+        outputSpectra = nullptr;
+        future = nullptr;
+        futureStart = 0;
+        cache = nullptr;
+        return;
+    }
+
+    this->inputs = inputs;
+    this->outputs = outputs;
+    filterLength = FFTPlan::PaddedLength(2 * maxLength); // Zero padding for the falloff to have space, at the cheapest size
+    int bins = (filterLength >> 1) + 1;
+    filters = new Complex*[inputs * outputs]();
+    inputSpectra = new Complex[inputs * bins];
+    outputSpectra = new Complex[outputs * bins];
+    future = new float[filterLength * outputs]();
+    futureStart = 0;
+    cache = new FFTCache(filterLength);
+}
+
+int ConvolutionMatrix::GetMaxLength() const {
+    return filterLength >> 1;
+}
+
+bool ConvolutionMatrix::SetFilter(const int input, const int output, const float *impulse, const int len) {
+    if (input < 0 || input >= inputs || output < 0 || output >= outputs || (impulse && (len <= 0 || len > GetMaxLength()))) {
+        return false;
+    }
+
+    Complex *&route = filters[input * outputs + output];
+    if (!impulse) {
+        delete[] route;
+        route = nullptr;
+        return true;
+    }
+    if (!route) {
+        route = new Complex[(filterLength >> 1) + 1];
+    }
+    float *filterSamples = (float*)route,
+        multiplier = 1.f / filterLength; // The normalization of the inverse transform is done by the filter
+    for (int sample = 0; sample < len; sample++) {
+        filterSamples[sample] = impulse[sample] * multiplier;
+    }
+    memset(filterSamples + len, 0, (filterLength - len) * sizeof(float));
+    ProcessRealFFT(filterSamples, filterLength, cache);
+    return true;
+}
+
+void ConvolutionMatrix::SetMultithreaded(const bool multithreaded) {
+    this->multithreaded = multithreaded;
+}
+
+void ConvolutionMatrix::Process(const float *input, float *output, int frames) {
+    if (!input || !output || frames <= 0 || !filters) {
+        return;
+    }
+
+    for (int start = 0; start < frames; start += filterLength >> 1) {
+        ProcessTimeslot(input + start * inputs, output + start * outputs, min(frames - start, filterLength >> 1));
+    }
+}
+
+void ConvolutionMatrix::ProcessTimeslot(const float *input, float *output, int frames) {
+    int bins = (filterLength >> 1) + 1;
+    // Worker threads use their own fallback caches, which share the plan of the same size through the plan registry
+    thread::id caller = this_thread::get_id();
+
+    // Transform each input once
+    Parallelizer::For(0, inputs, [&](int channel) {
+        float *samples = (float*)(inputSpectra + channel * bins);
+        const float *source = input + channel;
+        for (int frame = 0; frame < frames; frame++) {
+            samples[frame] = source[frame * inputs];
+        }
+        memset(samples + frames, 0, (filterLength - frames) * sizeof(float));
+        ProcessRealFFT(samples, filterLength, this_thread::get_id() == caller ? cache : GetFallbackFFTCache(filterLength));
+    }, multithreaded);
+
+    // Mix the filtered input spectra of each output, transform them back, and add them to the future
+    int resultLength = frames + (filterLength >> 1);
+    Parallelizer::For(0, outputs, [&](int channel) {
+        Complex *spectrum = outputSpectra + channel * bins;
+        bool routed = false;
+        for (int source = 0; source < inputs; source++) {
+            const Complex *filter = filters[source * outputs + channel];
+            if (!filter) {
+                continue;
+            }
+            if (routed) {
+                ConvolveAccumulate(spectrum, inputSpectra + source * bins, filter, bins);
+            } else {
+                memcpy(spectrum, inputSpectra + source * bins, bins * sizeof(Complex));
+                Convolve(spectrum, (Complex*)filter, bins);
+                routed = true;
+            }
+        }
+        if (!routed) {
+            return;
+        }
+
+        float *samples = (float*)spectrum;
+        ProcessRealIFFT(samples, filterLength, this_thread::get_id() == caller ? cache : GetFallbackFFTCache(filterLength));
+        for (int frame = 0, position = futureStart; frame < resultLength; frame++) {
+            future[position * outputs + channel] += samples[frame];
+            position = position + 1 == filterLength ? 0 : position + 1;
+        }
+    }, multithreaded);
+
+    // Output the oldest frames of the future, and clear their place for the end of the future
+    for (int frame = 0; frame < frames; frame++) {
+        float *source = future + futureStart * outputs;
+        memcpy(output + frame * outputs, source, outputs * sizeof(float));
+        memset(source, 0, outputs * sizeof(float));
+        futureStart = futureStart + 1 == filterLength ? 0 : futureStart + 1;
+    }
+}
+
+ConvolutionMatrix::~ConvolutionMatrix() {
+    if (filters) {
+        for (int route = 0; route < inputs * outputs; route++) {
+            delete[] filters[route];
+        }
+    }
+    delete[] filters;
+    delete[] inputSpectra;
+    delete[] outputSpectra;
+    delete[] future;
+    delete cache;
+}
+
+ConvolutionMatrix* DLL_EXPORT ConvolutionMatrix_Create(const int inputs, const int outputs, const int maxLength) {
+    return new ConvolutionMatrix(inputs, outputs, maxLength);
+}
+
+int DLL_EXPORT ConvolutionMatrix_GetMaxLength(ConvolutionMatrix *instance) {
+    return instance->GetMaxLength();
+}
+
+bool DLL_EXPORT ConvolutionMatrix_SetFilter(ConvolutionMatrix *instance, int input, int output, const float *impulse, int len) {
+    return instance->SetFilter(input, output, impulse, len);
+}
+
+void DLL_EXPORT ConvolutionMatrix_SetMultithreaded(ConvolutionMatrix *instance, bool multithreaded) {
+    instance->SetMultithreaded(multithreaded);
+}
+
+void DLL_EXPORT ConvolutionMatrix_Process(ConvolutionMatrix *instance, const float *input, float *output, int frames) {
+    instance->Process(input, output, frames);
+}
+
+void DLL_EXPORT ConvolutionMatrix_Dispose(ConvolutionMatrix *instance) {
+    delete instance;
+}
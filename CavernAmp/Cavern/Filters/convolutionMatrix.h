@@ -0,0 +1,91 @@
+#ifndef CONVOLUTIONMATRIX_H
+#define CONVOLUTIONMATRIX_H
+
+#include "../../export.h"
+#include "../Utilities/complex.h"
+#include "../Utilities/fftcache.h"
+
+/// \brief Convolves each of N input channels with a filter for each of M output channels, and mixes the results of each
+/// output. Each input is transformed once, and each output spectrum is accumulated from the input spectra before a single
+/// inverse transform, so a block costs N + M transforms instead of N * M.
+class ConvolutionMatrix {
+private:
+    /// Number of input channels.
+    int inputs;
+
+    /// Number of output channels.
+    int outputs;
+
+    /// Length of the real signals transformed, the longest possible filter is half of this.
+    int filterLength;
+
+    /// Spectrum of the filter of each route, at input * outputs + output, nullptr where the input is not routed to the output.
+    Complex **filters;
+
+    /// Spectra of the last block of each input, filterLength / 2 + 1 bins each.
+    Complex *inputSpectra;
+
+    /// Spectra of the last block of each output, filterLength / 2 + 1 bins each.
+    Complex *outputSpectra;
+
+    /// Overlap samples from previous runs, filterLength interleaved frames of all outputs in a ring buffer.
+    float *future;
+
+    /// First frame of the future.
+    int futureStart;
+
+    /// FFT optimization.
+    FFTCache *cache;
+
+    /// Transform the channels on multiple threads.
+    bool multithreaded;
+
+    /// Convolve a block of frames not longer than half the filter length.
+    void ProcessTimeslot(const float *input, float *output, int frames);
+
+public:
+    /// Constructs a matrix without any routes, which accepts filters of up to maxLength samples.
+    ConvolutionMatrix(const int inputs, const int outputs, const int maxLength);
+
+    ConvolutionMatrix(const ConvolutionMatrix&) = delete;
+    ConvolutionMatrix& operator=(const ConvolutionMatrix&) = delete;
+
+    /// Longest filter a route can have.
+    int GetMaxLength() const;
+
+    /// Route an input to an output through a filter of at most GetMaxLength samples, or remove the route if the impulse
+    /// is nullptr. Returns false if the channels or the length are out of range.
+    bool SetFilter(const int input, const int output, const float *impulse, const int len);
+
+    /// Transform the channels on multiple threads.
+    void SetMultithreaded(const bool multithreaded);
+
+    /// Convolve frames of interleaved input channels to the interleaved output channels.
+    void Process(const float *input, float *output, int frames);
+
+    ~ConvolutionMatrix();
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Constructs a convolution matrix without any routes, which accepts filters of up to maxLength samples.
+ConvolutionMatrix* DLL_EXPORT ConvolutionMatrix_Create(const int inputs, const int outputs, const int maxLength);
+/// Longest filter a route can have.
+int DLL_EXPORT ConvolutionMatrix_GetMaxLength(ConvolutionMatrix *instance);
+/// Route an input to an output through a filter, or remove the route if the impulse is null.
+/// Returns false if the channels or the length are out of range.
+bool DLL_EXPORT ConvolutionMatrix_SetFilter(ConvolutionMatrix *instance, int input, int output, const float *impulse, int len);
+/// Transform the channels on multiple threads.
+void DLL_EXPORT ConvolutionMatrix_SetMultithreaded(ConvolutionMatrix *instance, bool multithreaded);
+/// Convolve frames of interleaved input channels to the interleaved output channels.
+void DLL_EXPORT ConvolutionMatrix_Process(ConvolutionMatrix *instance, const float *input, float *output, int frames);
+/// Free up the convolution matrix's memory.
+void DLL_EXPORT ConvolutionMatrix_Dispose(ConvolutionMatrix *instance);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CONVOLUTIONMATRIX_H
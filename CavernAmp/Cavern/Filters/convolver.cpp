@@ -0,0 +1,168 @@
+#include <algorithm>
+#include <cstring>
+#include <immintrin.h>
+
+#include "convolver.h"
+#include "fastConvolver.h"
+#include "../Utilities/fftPlan.h"
+
+using namespace std;
+
+// Samples processed at once when the history is short, longer histories are moved back after runs of their length.
+static const int minimumRunLength = 256;
+// Cost of a FastConvolver timeslot in the time of a multiply-add of the direct form, divided by N * log2(N) for its
+// transform length N. Measured on AVX with 8 to 1024 taps and blocks of 32 to 2048 samples, where it was between 7 and 12.
+static const int fftCostRatio = 9;
+
+Convolver::Convolver(const float *impulse, const int len, const int delay) {
+    Initialize(impulse, len, delay);
+}
+
+Convolver::Convolver(const Convolver &other) {
+    len = other.len;
+    delay = other.delay;
+    historyLength = other.historyLength;
+    runLength = other.runLength;
+    if (!other.impulse) {
+        impulse = nullptr;
+        history = nullptr;
+        return;
+    }
+    impulse = new float[len];
+    memcpy(impulse, other.impulse, len * sizeof(float));
+    history = new float[historyLength + runLength]();
+}
+
+void Convolver::Initialize(const float *impulse, const int len, const int delay) {
+    if (!impulse || len <= 0 || delay < 0) {
+        this->impulse = nullptr;
+        this->len = 0;
+        this->delay = 0;
+        history = nullptr;
+        historyLength = 0;
+        runLength = 0;
+        return;
+    }
+
+    this->len = len;
+    this->delay = delay;
+    this->impulse = new float[len];
+    for (int tap = 0; tap < len; tap++) {
+        this->impulse[tap] = impulse[len - 1 - tap];
+    }
+    historyLength = len - 1 + delay;
+    runLength = max(historyLength, minimumRunLength);
+    history = new float[historyLength + runLength]();
+}
+
+Filter* Convolver::CreateOptimal(const float *impulse, const int len, const int delay, const int blockSize) {
+    // The direct form costs len operations for each sample, while FastConvolver costs a fixed amount for each timeslot,
+    // which lasts for a block, but at most half of its transform
+    int fftSize = FFTPlan::PaddedLength(2 * len), timeslot = fftSize >> 1;
+    if (blockSize > 0 && blockSize < timeslot) {
+        timeslot = blockSize;
+    }
+    int log2 = 0;
+    while ((1 << (log2 + 1)) <= fftSize) {
+        log2++;
+    }
+    if ((long long)len * timeslot < (long long)fftCostRatio * fftSize * log2) {
+        return new Convolver(impulse, len, delay);
+    }
+    return new FastConvolver(impulse, len, delay);
+}
+
+void Convolver::Process(float *samples, int len) {
+    Process(samples, len, 0, 1);
+}
+
+void Convolver::Process(float *samples, int len, int channel, int channels) {
+    if (!samples || len <= 0 || channel < 0 || channels <= 0 || !impulse) {
+        return;
+    }
+
+    samples += channel;
+    for (int remaining = len / channels; remaining > 0; remaining -= runLength) {
+        int count = min(remaining, runLength);
+        ProcessRun(samples, count, channels);
+        samples += count * channels;
+    }
+}
+
+void Convolver::ProcessRun(float *samples, int count, int stride) {
+    float *input = history + historyLength;
+    for (int i = 0; i < count; i++) {
+        input[i] = samples[i * stride];
+    }
+
+    // Output sample i is the dot product of the reversed impulse and the samples from i in the history. Four independent
+    // sums of 8 outputs are calculated together to hide the latency of the additions.
+    int sample = 0;
+    for (int endSimd = count - 31; sample < endSimd; sample += 32) {
+        __m256 sum0 = _mm256_setzero_ps(), sum1 = _mm256_setzero_ps(),
+            sum2 = _mm256_setzero_ps(), sum3 = _mm256_setzero_ps();
+        const float *window = history + sample;
+        for (int tap = 0; tap < len; tap++) {
+            __m256 weight = _mm256_set1_ps(impulse[tap]);
+            sum0 = _mm256_add_ps(sum0, _mm256_mul_ps(weight, _mm256_loadu_ps(window + tap)));
+            sum1 = _mm256_add_ps(sum1, _mm256_mul_ps(weight, _mm256_loadu_ps(window + tap + 8)));
+            sum2 = _mm256_add_ps(sum2, _mm256_mul_ps(weight, _mm256_loadu_ps(window + tap + 16)));
+            sum3 = _mm256_add_ps(sum3, _mm256_mul_ps(weight, _mm256_loadu_ps(window + tap + 24)));
+        }
+        float results[32];
+        _mm256_storeu_ps(results, sum0);
+        _mm256_storeu_ps(results + 8, sum1);
+        _mm256_storeu_ps(results + 16, sum2);
+        _mm256_storeu_ps(results + 24, sum3);
+        for (int i = 0; i < 32; i++) {
+            samples[(sample + i) * stride] = results[i];
+        }
+    }
+    for (int endSimd = count - 7; sample < endSimd; sample += 8) {
+        __m256 sum = _mm256_setzero_ps();
+        const float *window = history + sample;
+        for (int tap = 0; tap < len; tap++) {
+            sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_set1_ps(impulse[tap]), _mm256_loadu_ps(window + tap)));
+        }
+        float results[8];
+        _mm256_storeu_ps(results, sum);
+        for (int i = 0; i < 8; i++) {
+            samples[(sample + i) * stride] = results[i];
+        }
+    }
+    for (; sample < count; sample++) {
+        float sum = 0;
+        const float *window = history + sample;
+        for (int tap = 0; tap < len; tap++) {
+            sum += impulse[tap] * window[tap];
+        }
+        samples[sample * stride] = sum;
+    }
+
+    memmove(history, history + count, historyLength * sizeof(float));
+}
+
+Filter* Convolver::Clone() const {
+    return new Convolver(*this);
+}
+
+Convolver::~Convolver() {
+    delete[] impulse;
+    delete[] history;
+}
+
+Convolver* DLL_EXPORT Convolver_Create(const float *impulse, const int len, const int delay) {
+    return new Convolver(impulse, len, delay);
+}
+
+Filter* DLL_EXPORT Convolver_CreateOptimal(const float *impulse, const int len, const int delay, const int blockSize) {
+    return Convolver::CreateOptimal(impulse, len, delay, blockSize);
+}
+
+void DLL_EXPORT Convolver_Process(Convolver *instance, float *samples, int len, int channel, int channels) {
+    instance->Process(samples, len, channel, channels);
+}
+
+void DLL_EXPORT Convolver_Dispose(Convolver *instance) {
+    delete instance;
+}
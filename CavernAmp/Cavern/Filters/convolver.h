@@ -0,0 +1,71 @@
+#ifndef CONVOLVER_H
+#define CONVOLVER_H
+
+#include "../../export.h"
+#include "filter.h"
+
+/// \brief Convolution by definition, vectorized over 8 output samples at a time. It's free of latency and its cost doesn't
+/// depend on the block size, which makes it faster than FastConvolver for short impulses and small blocks.
+class Convolver : public Filter {
+private:
+    /// Taps of the impulse in reverse order.
+    float *impulse;
+
+    /// Number of taps.
+    int len;
+
+    /// Delay applied with the convolution.
+    int delay;
+
+    /// The last len - 1 + delay input samples, followed by the input samples of the current run.
+    float *history;
+
+    /// Number of past samples kept in the history.
+    int historyLength;
+
+    /// Maximum number of samples processed at once, the history is moved back after each run.
+    int runLength;
+
+    /// Internal constructor behavior.
+    void Initialize(const float *impulse, const int len, const int delay);
+
+    /// Convolve at most runLength samples.
+    void ProcessRun(float *samples, int count, int stride);
+
+public:
+    /// Constructs a direct convolution with added delay.
+    Convolver(const float *impulse, const int len, const int delay);
+
+    /// Copy the impulse of another Convolver.
+    Convolver(const Convolver &other);
+
+    /// Create the convolution filter that's faster for the impulse when processing blocks of the given size:
+    /// a Convolver for short impulses or small blocks, a FastConvolver otherwise.
+    static Filter* CreateOptimal(const float *impulse, const int len, const int delay, const int blockSize);
+
+    /// Apply convolution on an array of samples. One filter should be applied to only one continuous stream of samples.
+    void Process(float *samples, int len);
+    void Process(float *samples, int len, int channel, int channels);
+    Filter* Clone() const override;
+    ~Convolver();
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Constructs a direct convolution with added delay.
+Convolver* DLL_EXPORT Convolver_Create(const float *impulse, const int len, const int delay);
+/// Create the convolution filter that's faster for the impulse when processing blocks of the given size. The result can be
+/// used with the Filter exports.
+Filter* DLL_EXPORT Convolver_CreateOptimal(const float *impulse, const int len, const int delay, const int blockSize);
+/// Apply convolution on an array of samples (interleaved channels).
+void DLL_EXPORT Convolver_Process(Convolver *instance, float *samples, int len, int channel, int channels);
+/// Free up the convolution filter's memory.
+void DLL_EXPORT Convolver_Dispose(Convolver *instance);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CONVOLVER_H
@@ -1,8 +1,10 @@
 #include <algorithm>
 #include <cstring>
+#include <thread>
 
 #include "../Utilities/complexArray.h"
 #include "fastConvolver.h"
+#include "../Utilities/fftFallbackCache.h"
 #include "../Utilities/measurements.h"
 #include "../Utilities/qmath.h"
 
@@ -16,43 +18,47 @@ FastConvolver::FastConvolver(const float *impulse, const int len, const int dela
     Initialize(impulse, len, delay);
 }
 
-FastConvolver::FastConvolver(const FastConvolver &other) {
+FastConvolver::FastConvolver(const FastConvolver &other) : pending(nullptr), retired(nullptr), swapping(false),
+    crossfade(nullptr) {
     filterLength = other.filterLength;
-    cache = new FFTCache(filterLength);
-    filter = new Complex[filterLength];
-    memcpy(filter, other.filter, filterLength * sizeof(Complex));
-    present = new Complex[filterLength];
+    cache = other.cache ? new FFTCache(*other.cache) : nullptr; // Only the work array is separate, the plan is shared
+    filter = other.filter ? FilterSpectrum::Acquire(other.filter) : nullptr; // The spectrum is read-only, it's shared
+    present = new Complex[(filterLength >> 1) + 1];
     future = new float[filterLength + other.delay]();
+    futureStart = 0;
     this->delay = other.delay;
+    tail = 0;
+    timeslots = 0;
+    skippedTimeslots = 0;
+    drainedTimeslots = 0;
 }
 
 void FastConvolver::Initialize(const float *impulse, const int len, const int delay) {
+    pending = nullptr;
+    retired = nullptr;
+    swapping = false;
+    crossfade = nullptr;
+    tail = 0;
+    timeslots = 0;
+    skippedTimeslots = 0;
+    drainedTimeslots = 0;
     if (!impulse || len <= 0) {
         filterLength = 0;
         cache = nullptr;
         filter = nullptr;
         present = nullptr;
         future = nullptr;
+        futureStart = 0;
         this->delay = 0;
         return;
     }
 
-    filterLength = 2 << Log2Ceil(len); // Zero padding for the falloff to have space
+    filterLength = FFTPlan::PaddedLength(2 * len); // Zero padding for the falloff to have space, at the cheapest FFT size
     cache = new FFTCache(filterLength);
-    filter = new Complex[filterLength];
-    for (int sample = 0; sample < len; sample++) {
-        filter[sample].real = impulse[sample];
-        filter[sample].imaginary = 0;
-    }
-    if (filterLength > len) {
-        for (int i = len; i < filterLength; i++) {
-            filter[i].real = 0;
-            filter[i].imaginary = 0;
-        }
-    }
-    ProcessFFT(filter, filterLength, cache, log2(filterLength) - 1);
-    present = new Complex[filterLength]();
+    filter = FilterSpectrum::Create(impulse, len, filterLength, cache);
+    present = new Complex[(filterLength >> 1) + 1]();
     future = new float[filterLength + delay]();
+    futureStart = 0;
     this->delay = delay;
 }
 
@@ -60,21 +66,67 @@ int FastConvolver::GetLength() const {
     return filterLength;
 }
 
+long long FastConvolver::GetMemoryUsage() const {
+    if (!filter) {
+        return sizeof(FastConvolver);
+    }
+    long long floats = (crossfade ? 2 : 1) * (filterLength + 2) + filterLength + delay; // Present, crossfade, and future
+    floats += 2LL * cache->work->length + (cache->scratch ? 2LL * cache->scratch->length : 0);
+    return sizeof(FastConvolver) + sizeof(FFTCache) + floats * sizeof(float);
+}
+
 void FastConvolver::GetFilter(float *output) const {
     if (!output || !filter || !cache) {
         return;
     }
 
-    Complex* ifft = new Complex[filterLength];
-    memcpy(ifft, filter, filterLength * sizeof(Complex));
-    InPlaceIFFT(ifft, filterLength, cache);
-    int outLength = filterLength >> 1;
-    for (int i = 0; i < outLength; i++) {
-        output[i] = ifft[i].real;
-    }
+    int bins = (filterLength >> 1) + 1;
+    Complex* ifft = new Complex[bins];
+    memcpy(ifft, filter->bins, bins * sizeof(Complex));
+    float *ifftSamples = (float*)ifft;
+    ProcessRealIFFT(ifftSamples, filterLength, cache); // The filter is prescaled by the inverse of the normalization
+    memcpy(output, ifftSamples, (filterLength >> 1) * sizeof(float));
     delete[] ifft;
 }
 
+bool FastConvolver::SetImpulse(const float *impulse, const int len) {
+    if (!impulse || len <= 0 || !filter || len > (filterLength >> 1)) {
+        return false;
+    }
+
+    // A spectrum that wasn't swapped in yet was never read, it can be overwritten
+    FilterSpectrum *next = pending.exchange(nullptr, std::memory_order_acquire);
+    if (!next) {
+        if (swapping) {
+            // The processing thread took the last spectrum, and retires the old filter at the end of the timeslot
+            const FilterSpectrum *old;
+            while (!(old = retired.exchange(nullptr, std::memory_order_acquire))) {
+                this_thread::yield();
+            }
+            next = FilterSpectrum::Reclaim(old); // If a clone still uses it, only the reference is released
+        }
+    }
+    if (!crossfade) {
+        crossfade = new Complex[(filterLength >> 1) + 1]; // Published to the processing thread with the pending filter
+    }
+    next = FilterSpectrum::Recreate(next, impulse, len, filterLength, GetFallbackFFTCache(filterLength));
+    pending.store(next, std::memory_order_release);
+    swapping = true;
+    return true;
+}
+
+long long FastConvolver::GetTimeslots() const {
+    return timeslots;
+}
+
+long long FastConvolver::GetSkippedTimeslots() const {
+    return skippedTimeslots;
+}
+
+long long FastConvolver::GetDrainedTimeslots() const {
+    return drainedTimeslots;
+}
+
 void FastConvolver::Process(float *samples, int len) {
     if (!samples || len <= 0 || !filter || !present || !future || !cache) {
         return;
@@ -106,51 +158,107 @@ void FastConvolver::ProcessTimeslot(float *samples, int channel, int channels, i
     int sourceLength = to - from;
     float *sample = samples + from * channels + channel,
         *lastSample = sample + sourceLength * channels;
-    Complex* timeslot = present;
+    float *timeslot = (float*)present;
+    bool silent = true;
     while (sample != lastSample) {
-        timeslot->real = *sample;
-        timeslot->imaginary = 0;
-        timeslot++;
+        silent &= *sample == 0;
+        *timeslot++ = *sample;
         sample += channels;
     }
-    for (int i = sourceLength; i < filterLength; i++) {
-        present[i].real = 0;
-        present[i].imaginary = 0;
+    timeslots++;
+
+    // The convolution of silence is silence, which would add nothing to the future
+    if (silent) {
+        skippedTimeslots++;
+        // A new filter can be swapped in without a crossfade, as this timeslot has no output to fade
+        FilterSpectrum *next = pending.load(std::memory_order_relaxed) ?
+            pending.exchange(nullptr, std::memory_order_acquire) : nullptr;
+        if (next) {
+            ReplaceFilter(next);
+        }
+    } else {
+        memset(timeslot, 0, (filterLength - sourceLength) * sizeof(float));
+        ProcessCache(sourceLength + (filterLength >> 1));
+        tail = max(tail, sourceLength + (filterLength >> 1) + delay);
     }
 
-    ProcessCache(sourceLength + (filterLength >> 1));
+    int futureLength = filterLength + delay;
+    if (silent && !tail) { // The future is all zeros, and the samples are already silent, so there's nothing to output
+        drainedTimeslots++;
+        futureStart = (futureStart + sourceLength) % futureLength;
+        return;
+    }
 
-    float *source = future;
+    // Output the oldest samples of the future, and clear their place for the end of the future
     sample = samples + from * channels + channel;
     lastSample = sample + sourceLength * channels;
+    float *source = future + futureStart,
+        *end = future + futureLength;
     while (sample != lastSample) {
-        *sample = *source++;
+        *sample = *source;
+        *source++ = 0;
+        if (source == end) {
+            source = future;
+        }
         sample += channels;
     }
-    to -= from;
+    futureStart = (int)(source - future);
+    tail = max(tail - sourceLength, 0);
+}
 
-    int futureLength = filterLength + delay;
-    for (int i = 0; i < futureLength - to; i++) {
-        future[i] = future[i + to];
+void FastConvolver::ProcessCache(const int maxResultLength) {
+    // Perform the convolution
+    float *presentSamples = (float*)present;
+    ProcessRealFFT(presentSamples, filterLength, cache);
+    FilterSpectrum *next = pending.load(std::memory_order_relaxed) ?
+        pending.exchange(nullptr, std::memory_order_acquire) : nullptr;
+    if (next) {
+        SwapFilter(next, maxResultLength - (filterLength >> 1));
+    } else {
+        Convolve(present, filter->bins, (filterLength >> 1) + 1);
+        ProcessRealIFFT(presentSamples, filterLength, cache);
     }
-    for (int i = futureLength - to; i < futureLength; i++) {
-        future[i] = 0;
+
+    // Add the result to the future, which might wrap around the end of the ring buffer
+    int futureLength = filterLength + delay,
+        position = futureStart + delay;
+    position -= position >= futureLength ? futureLength : 0;
+    int firstPart = min(maxResultLength, futureLength - position);
+    float *source = presentSamples,
+        *destination = future + position;
+    for (int i = 0; i < firstPart; i++) {
+        destination[i] += source[i];
+    }
+    source += firstPart;
+    for (int i = 0, secondPart = maxResultLength - firstPart; i < secondPart; i++) {
+        future[i] += source[i];
     }
 }
 
-void FastConvolver::ProcessCache(const int maxResultLength) {
-    // Perform the convolution
-    ProcessFFT(present, filterLength, cache, log2(filterLength) - 1);
-    Convolve(present, filter, filterLength);
-    InPlaceIFFT(present, filterLength, cache);
+void FastConvolver::SwapFilter(const FilterSpectrum *next, const int sourceLength) {
+    int bins = (filterLength >> 1) + 1;
+    memcpy(crossfade, present, bins * sizeof(Complex));
+    Convolve(crossfade, filter->bins, bins);
+    Convolve(present, next->bins, bins);
+    float *oldSamples = (float*)crossfade, *newSamples = (float*)present;
+    ProcessRealIFFT(oldSamples, filterLength, cache);
+    ProcessRealIFFT(newSamples, filterLength, cache);
 
-    // Append the result to the future
-    Complex *source = present;
-    float *destination = future + delay,
-        *end = destination + maxResultLength;
-    while (destination != end) {
-        *destination++ += (*source++).real;
+    // The tails of earlier timeslots are left as they were, only this timeslot's contribution fades to the new filter,
+    // and what it leaves for the next timeslots is already fully the new filter's
+    float step = 1.f / (sourceLength + 1);
+    for (int i = 0; i < sourceLength; i++) {
+        newSamples[i] = oldSamples[i] + (newSamples[i] - oldSamples[i]) * ((i + 1) * step);
     }
+
+    ReplaceFilter(next);
+}
+
+void FastConvolver::ReplaceFilter(const FilterSpectrum *next) {
+    // SetImpulse collects the last retired filter before it sets a new one, so the slot is always empty here, and nothing
+    // has to be freed on the processing thread
+    retired.store(filter, std::memory_order_release);
+    filter = next;
 }
 
 Filter* FastConvolver::Clone() const {
@@ -158,7 +266,13 @@ Filter* FastConvolver::Clone() const {
 }
 
 FastConvolver::~FastConvolver() {
-    delete[] filter;
+    const FilterSpectrum *spectra[] = { filter, pending.load(), retired.load() };
+    for (const FilterSpectrum *spectrum : spectra) {
+        if (spectrum) {
+            FilterSpectrum::Release(spectrum);
+        }
+    }
+    delete[] crossfade;
     delete[] present;
     delete[] future;
     delete cache;
@@ -172,6 +286,34 @@ int DLL_EXPORT FastConvolver_GetLength(FastConvolver *instance) {
     return instance->GetLength();
 }
 
+long long DLL_EXPORT FastConvolver_GetMemoryUsage(FastConvolver *instance) {
+    return instance->GetMemoryUsage();
+}
+
 void DLL_EXPORT FastConvolver_GetFilter(FastConvolver *instance, float *output) {
     instance->GetFilter(output);
 }
+
+bool DLL_EXPORT FastConvolver_SetImpulse(FastConvolver *instance, const float *impulse, const int len) {
+    return instance->SetImpulse(impulse, len);
+}
+
+long long DLL_EXPORT FastConvolver_GetTimeslots(FastConvolver *instance) {
+    return instance->GetTimeslots();
+}
+
+long long DLL_EXPORT FastConvolver_GetSkippedTimeslots(FastConvolver *instance) {
+    return instance->GetSkippedTimeslots();
+}
+
+long long DLL_EXPORT FastConvolver_GetDrainedTimeslots(FastConvolver *instance) {
+    return instance->GetDrainedTimeslots();
+}
+
+void DLL_EXPORT FastConvolver_Process(FastConvolver *instance, float *samples, int len, int channel, int channels) {
+    instance->Process(samples, len, channel, channels);
+}
+
+void DLL_EXPORT FastConvolver_Dispose(FastConvolver *instance) {
+    delete instance;
+}
@@ -1,34 +1,64 @@
 #ifndef FASTCONVOLVER_H
 #define FASTCONVOLVER_H
 
+#include <atomic>
+
 #include "../../export.h"
 #include "../Utilities/complex.h"
 #include "../Utilities/fftcache.h"
 #include "filter.h"
+#include "Utilities/filterSpectrum.h"
 
 #define Q_REF 0.7071067811865475
 
 /// \brief Performs an optimized convolution.
 class FastConvolver : public Filter {
 private:
-    /// Created convolution filter in Fourier-space.
-    Complex *filter;
+    /// Created convolution filter in Fourier-space, the filterLength / 2 + 1 bins of a real transform, shared with clones.
+    const FilterSpectrum *filter;
+
+    /// Spectrum set by SetImpulse, swapped in by the processing thread at the start of the next timeslot.
+    std::atomic<FilterSpectrum*> pending;
+
+    /// Spectrum swapped out by the processing thread, collected by the next SetImpulse, and reused if no clone shares it.
+    std::atomic<const FilterSpectrum*> retired;
+
+    /// A spectrum was set by SetImpulse, and the filter it replaces was not yet collected from retired.
+    bool swapping;
+
+    /// Transform of the timeslot with the old filter while crossfading to a new one, allocated by the first SetImpulse.
+    Complex *crossfade;
 
-    /// Cache to perform the FFT in.
+    /// Cache to perform the FFT in, holds filterLength real samples or filterLength / 2 + 1 bins.
     Complex *present;
 
-    /// Length of filter and present.
+    /// Length of the real signals transformed to filter and present.
     int filterLength;
 
-    /// Overlap samples from previous runs.
+    /// Overlap samples from previous runs, a ring buffer of filterLength + delay samples starting at futureStart.
     float *future;
 
+    /// Position of the next output sample in the future.
+    int futureStart;
+
     /// FFT optimization.
     FFTCache *cache;
 
     /// Delay applied with the convolution.
     int delay;
 
+    /// Number of samples from futureStart that might not be zero. When it's 0, silence doesn't have to be convolved.
+    int tail;
+
+    /// Number of timeslots processed since the creation of the filter.
+    long long timeslots;
+
+    /// Number of timeslots with silent input, where the transforms were skipped.
+    long long skippedTimeslots;
+
+    /// Number of skipped timeslots where the future was also silent, and zeros were written without reading it.
+    long long drainedTimeslots;
+
     /// Internal constructor behavior.
     void Initialize(const float *impulse, const int len, const int delay);
 
@@ -38,6 +68,13 @@ private:
     /// When present is filled with the source samples, it will be convolved and put into the future.
     void ProcessCache(const int maxResultLength);
 
+    /// Convolve the timeslot in present with both the old and the pending filter, crossfade the results over the
+    /// timeslot, and make the pending filter the current one.
+    void SwapFilter(const FilterSpectrum *next, const int sourceLength);
+
+    /// Make the pending filter the current one, and pass the old one to SetImpulse for reuse.
+    void ReplaceFilter(const FilterSpectrum *next);
+
 public:
     /// Constructs an optimized convolution with no delay.
     FastConvolver(const float *impulse, const int len);
@@ -51,9 +88,28 @@ public:
     /// Returns the actually allocated filter length.
     int GetLength() const;
 
+    /// Memory used by this instance in bytes, without the filter spectrum, which might be shared with other instances.
+    long long GetMemoryUsage() const;
+
     /// Deconstruct the filter and move it to the preallocated output buffer. Needs a buffer that's half the length of GetLength.
     void GetFilter(float *output) const;
 
+    /// Replace the impulse without interrupting the processing on another thread. The new filter is transformed on the
+    /// calling thread, and is swapped in at the start of the next processed block, where the outputs of the old and new
+    /// filters are crossfaded. The impulse can be at most half of GetLength long. The buffers of the swap are allocated
+    /// here when they're first needed, so the processing thread never allocates or frees memory. Returns false if the
+    /// impulse doesn't fit. Only call from one thread at a time.
+    bool SetImpulse(const float *impulse, const int len);
+
+    /// Number of timeslots (blocks of at most half of GetLength samples) processed since the creation of the filter.
+    long long GetTimeslots() const;
+
+    /// Number of processed timeslots with silent input, where the transforms were skipped.
+    long long GetSkippedTimeslots() const;
+
+    /// Number of skipped timeslots where the remaining tail of earlier timeslots has also ended, and only zeros were output.
+    long long GetDrainedTimeslots() const;
+
     /// Apply convolution on an array of samples. One filter should be applied to only one continuous stream of samples.
     void Process(float *samples, int len);
     void Process(float *samples, int len, int channel, int channels);
@@ -69,8 +125,24 @@ extern "C" {
 FastConvolver* DLL_EXPORT FastConvolver_Create(const float *impulse, const int len, const int delay);
 /// Returns the actually allocated filter length.
 int DLL_EXPORT FastConvolver_GetLength(FastConvolver *instance);
+/// Memory used by the instance in bytes, without the filter spectrum, which might be shared with clones.
+/// The memory of all spectra is reported by FilterSpectrum_GetMemoryUsage.
+long long DLL_EXPORT FastConvolver_GetMemoryUsage(FastConvolver *instance);
 /// Deconstruct the filter and move it to the preallocated output buffer. Needs a buffer that's half the length of GetLength.
-void FastConvolver_GetFilter(FastConvolver *instance, float *output);
+void DLL_EXPORT FastConvolver_GetFilter(FastConvolver *instance, float *output);
+/// Replace the impulse with a crossfade in the next processed block. The impulse can be at most half of GetLength long.
+/// Returns false if the impulse doesn't fit.
+bool DLL_EXPORT FastConvolver_SetImpulse(FastConvolver *instance, const float *impulse, const int len);
+/// Number of timeslots (blocks of at most half of GetLength samples) processed since the creation of the filter.
+long long DLL_EXPORT FastConvolver_GetTimeslots(FastConvolver *instance);
+/// Number of processed timeslots with silent input, where the transforms were skipped.
+long long DLL_EXPORT FastConvolver_GetSkippedTimeslots(FastConvolver *instance);
+/// Number of skipped timeslots where the remaining tail has also ended, and only zeros were output.
+long long DLL_EXPORT FastConvolver_GetDrainedTimeslots(FastConvolver *instance);
+/// Apply convolution on an array of samples (interleaved channels).
+void DLL_EXPORT FastConvolver_Process(FastConvolver *instance, float *samples, int len, int channel, int channels);
+/// Free up the convolution filter's memory.
+void DLL_EXPORT FastConvolver_Dispose(FastConvolver *instance);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,219 @@
+#include <algorithm>
+#include <cstring>
+#include <immintrin.h>
+
+#include "multichannelConvolver.h"
+#include "../Utilities/measurements.h"
+#include "../Utilities/Threading/parallelizer.h"
+
+using namespace std;
+
+MultichannelConvolver::MultichannelConvolver(const float *const *impulses, const int len, const int channels) {
+    Initialize(impulses, len, channels);
+}
+
+MultichannelConvolver::MultichannelConvolver(const MultichannelConvolver &other) {
+    channels = other.channels;
+    pairs = other.pairs;
+    filterLength = other.filterLength;
+    multithreaded = other.multithreaded;
+    if (!other.sums) {
+        cache = nullptr;
+        sums = nullptr;
+        differences = nullptr;
+        present = nullptr;
+        presentPairs = nullptr;
+        future = nullptr;
+        futureStart = 0;
+        return;
+    }
+    cache = new FFTCache(*other.cache); // Only the work array is separate, the plan is shared
+    sums = new Complex[pairs * filterLength];
+    memcpy(sums, other.sums, pairs * filterLength * sizeof(Complex));
+    differences = new Complex[pairs * filterLength];
+    memcpy(differences, other.differences, pairs * filterLength * sizeof(Complex));
+    AllocateState();
+}
+
+void MultichannelConvolver::Initialize(const float *const *impulses, const int len, const int channels) {
+    multithreaded = true;
+    if (!impulses || len <= 0 || channels <= 0) {
+        this->channels = 0;
+        pairs = 0;
+        filterLength = 0;
+        cache = nullptr;
+        sums = nullptr;
+        differences = nullptr;
+        present = nullptr;
+        presentPairs = nullptr;
+        future = nullptr;
+        futureStart = 0;
+        return;
+    }
+
+    this->channels = channels;
+    pairs = (channels + 1) >> 1;
+    filterLength = FFTPlan::PaddedLength(2 * len); // Zero padding for the falloff to have space, at the cheapest FFT size
+    cache = new FFTCache(filterLength);
+    sums = new Complex[pairs * filterLength];
+    differences = new Complex[pairs * filterLength];
+
+    // The packed signal a + ib has the spectrum Z = A + iB, so the filtered A * Ha + iB * Hb can be written as
+    // Z * (Ha + Hb) / 2 + conj(Z[-k]) * (Ha - Hb) / 2, using that A and B are the Hermitian parts of Z.
+    Complex *first = new Complex[filterLength], *second = new Complex[filterLength];
+    for (int pair = 0; pair < pairs; pair++) {
+        for (int i = 0; i < filterLength; i++) {
+            first[i] = { i < len && impulses[2 * pair] ? impulses[2 * pair][i] : 0, 0 };
+            bool hasSecond = 2 * pair + 1 < channels && impulses[2 * pair + 1];
+            second[i] = { i < len && hasSecond ? impulses[2 * pair + 1][i] : 0, 0 };
+        }
+        InPlaceFFT(first, filterLength, cache);
+        InPlaceFFT(second, filterLength, cache);
+        Complex *pairSums = sums + pair * filterLength, *pairDifferences = differences + pair * filterLength;
+        for (int i = 0; i < filterLength; i++) {
+            pairSums[i] = { (first[i].real + second[i].real) * .5f, (first[i].imaginary + second[i].imaginary) * .5f };
+            pairDifferences[i] = { (first[i].real - second[i].real) * .5f,
+                (first[i].imaginary - second[i].imaginary) * .5f };
+        }
+    }
+    delete[] first;
+    delete[] second;
+    AllocateState();
+}
+
+void MultichannelConvolver::AllocateState() {
+    present = (Complex*)_mm_malloc(pairs * filterLength * sizeof(Complex), 32);
+    presentPairs = new Complex*[pairs];
+    for (int pair = 0; pair < pairs; pair++) {
+        presentPairs[pair] = present + pair * filterLength;
+    }
+    future = new float[filterLength * channels]();
+    futureStart = 0;
+}
+
+int MultichannelConvolver::GetChannels() const {
+    return channels;
+}
+
+void MultichannelConvolver::SetMultithreaded(const bool multithreaded) {
+    this->multithreaded = multithreaded;
+}
+
+void MultichannelConvolver::Process(float *samples, int len) {
+    Process(samples, len, 0, channels);
+}
+
+void MultichannelConvolver::Process(float *samples, int len, int channel, int channels) {
+    if (!samples || len <= 0 || channel < 0 || channel + this->channels > channels || !sums) {
+        return;
+    }
+
+    int frames = len / channels;
+    for (int start = 0; start < frames; start += filterLength >> 1) {
+        ProcessTimeslot(samples + start * channels, min(frames - start, filterLength >> 1), channel, channels);
+    }
+}
+
+void MultichannelConvolver::ProcessTimeslot(float *samples, int frames, int channel, int channels) {
+    // Deinterleave each pair to its planar work array, where both channels of the pair are next to each other
+    Parallelizer::For(0, pairs, [&](int pair) {
+        Complex *target = presentPairs[pair];
+        const float *source = samples + channel + 2 * pair;
+        if (2 * pair + 1 < this->channels) {
+            for (int frame = 0; frame < frames; frame++) {
+                target[frame] = { source[frame * channels], source[frame * channels + 1] };
+            }
+        } else {
+            for (int frame = 0; frame < frames; frame++) {
+                target[frame] = { source[frame * channels], 0 };
+            }
+        }
+        memset(target + frames, 0, (filterLength - frames) * sizeof(Complex));
+    }, multithreaded);
+
+    InPlaceFFTBatch(presentPairs, pairs, filterLength, cache, multithreaded);
+    Parallelizer::For(0, pairs, [&](int pair) {
+        ConvolvePair(pair);
+    }, multithreaded);
+    InPlaceIFFTBatch(presentPairs, pairs, filterLength, cache, multithreaded);
+
+    // Add the results to the future, the real parts are the first, the imaginary parts are the second channels of pairs
+    int resultLength = frames + (filterLength >> 1);
+    Parallelizer::For(0, pairs, [&](int pair) {
+        const Complex *source = presentPairs[pair];
+        bool second = 2 * pair + 1 < this->channels;
+        for (int frame = 0, position = futureStart; frame < resultLength; frame++) {
+            float *target = future + position * this->channels + 2 * pair;
+            target[0] += source[frame].real;
+            if (second) {
+                target[1] += source[frame].imaginary;
+            }
+            position = position + 1 == filterLength ? 0 : position + 1;
+        }
+    }, multithreaded);
+
+    // Output the oldest frames of the future, and clear their place for the end of the future
+    for (int frame = 0; frame < frames; frame++) {
+        float *source = future + futureStart * this->channels, *target = samples + frame * channels + channel;
+        memcpy(target, source, this->channels * sizeof(float));
+        memset(source, 0, this->channels * sizeof(float));
+        futureStart = futureStart + 1 == filterLength ? 0 : futureStart + 1;
+    }
+}
+
+void MultichannelConvolver::ConvolvePair(const int pair) {
+    // Bins k and -k depend on each other, so they are calculated together
+    Complex *spectrum = presentPairs[pair];
+    const Complex *pairSums = sums + pair * filterLength, *pairDifferences = differences + pair * filterLength;
+    for (int bin = 0, half = filterLength >> 1; bin <= half; bin++) {
+        int mirror = bin ? filterLength - bin : 0;
+        Complex value = spectrum[bin], mirrored = spectrum[mirror];
+        const Complex &sum = pairSums[bin], &difference = pairDifferences[bin];
+        spectrum[bin] = {
+            value.real * sum.real - value.imaginary * sum.imaginary +
+                mirrored.real * difference.real + mirrored.imaginary * difference.imaginary,
+            value.real * sum.imaginary + value.imaginary * sum.real +
+                mirrored.real * difference.imaginary - mirrored.imaginary * difference.real
+        };
+        if (mirror != bin) {
+            const Complex &mirrorSum = pairSums[mirror], &mirrorDifference = pairDifferences[mirror];
+            spectrum[mirror] = {
+                mirrored.real * mirrorSum.real - mirrored.imaginary * mirrorSum.imaginary +
+                    value.real * mirrorDifference.real + value.imaginary * mirrorDifference.imaginary,
+                mirrored.real * mirrorSum.imaginary + mirrored.imaginary * mirrorSum.real +
+                    value.real * mirrorDifference.imaginary - value.imaginary * mirrorDifference.real
+            };
+        }
+    }
+}
+
+Filter* MultichannelConvolver::Clone() const {
+    return new MultichannelConvolver(*this);
+}
+
+MultichannelConvolver::~MultichannelConvolver() {
+    delete[] sums;
+    delete[] differences;
+    if (present) {
+        _mm_free(present);
+    }
+    delete[] presentPairs;
+    delete[] future;
+    delete cache;
+}
+
+MultichannelConvolver* DLL_EXPORT MultichannelConvolver_Create(const float **impulses, const int len, const int channels) {
+    return new MultichannelConvolver(impulses, len, channels);
+}
+
+void DLL_EXPORT MultichannelConvolver_SetMultithreaded(MultichannelConvolver *instance, bool multithreaded) {
+    instance->SetMultithreaded(multithreaded);
+}
+
+void DLL_EXPORT MultichannelConvolver_Process(MultichannelConvolver *instance, float *samples, int len) {
+    instance->Process(samples, len);
+}
+
+void DLL_EXPORT MultichannelConvolver_Dispose(MultichannelConvolver *instance) {
+    delete instance;
+}
@@ -0,0 +1,99 @@
+#ifndef MULTICHANNELCONVOLVER_H
+#define MULTICHANNELCONVOLVER_H
+
+#include "../../export.h"
+#include "../Utilities/complex.h"
+#include "../Utilities/fftcache.h"
+#include "filter.h"
+
+/// \brief Convolution of all channels of an interleaved signal with a different filter for each channel, in a single pass.
+/// Two real channels are transformed as the real and imaginary parts of a single complex signal, and the channel pairs
+/// are transformed together in SIMD lanes.
+class MultichannelConvolver : public Filter {
+private:
+    /// Number of convolved channels.
+    int channels;
+
+    /// Number of complex signals the channels are packed to, the last one is only half used for an odd channel count.
+    int pairs;
+
+    /// Length of the transforms, the same for all channels, as the shorter filters are padded to the longest.
+    int filterLength;
+
+    /// For each pair, the spectrum the packed signal is multiplied with: the mean of the two channels' filters.
+    Complex *sums;
+
+    /// For each pair, the spectrum the mirrored conjugate of the packed signal is multiplied with: half the difference
+    /// of the two channels' filters.
+    Complex *differences;
+
+    /// Planar work arrays of each pair, filterLength elements each, 32-byte aligned.
+    Complex *present;
+
+    /// Pointers to each pair in present.
+    Complex **presentPairs;
+
+    /// Overlap samples from previous runs, filterLength interleaved frames of all channels in a ring buffer.
+    float *future;
+
+    /// First frame of the future.
+    int futureStart;
+
+    /// FFT optimization.
+    FFTCache *cache;
+
+    /// Process the channel pairs on multiple threads.
+    bool multithreaded;
+
+    /// Internal constructor behavior.
+    void Initialize(const float *const *impulses, const int len, const int channels);
+
+    /// Allocate the work arrays and the future, all cleared.
+    void AllocateState();
+
+    /// Convolve a block of frames not longer than half the filter length.
+    void ProcessTimeslot(float *samples, int frames, int channel, int channels);
+
+    /// Apply the filters of a pair to its packed spectrum.
+    void ConvolvePair(const int pair);
+
+public:
+    /// Constructs a multichannel convolution with one impulse of len samples for each channel.
+    MultichannelConvolver(const float *const *impulses, const int len, const int channels);
+
+    /// Copy the filters of another MultichannelConvolver.
+    MultichannelConvolver(const MultichannelConvolver &other);
+
+    /// Number of convolved channels.
+    int GetChannels() const;
+
+    /// Process the channel pairs on multiple threads.
+    void SetMultithreaded(const bool multithreaded);
+
+    /// Convolve all channels of an interleaved signal, which has exactly as many channels as this filter.
+    void Process(float *samples, int len);
+    /// Convolve the interleaved signal's channels starting from the given channel, there have to be at least as many
+    /// channels from there as this filter has.
+    void Process(float *samples, int len, int channel, int channels);
+    Filter* Clone() const override;
+    ~MultichannelConvolver();
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Constructs a multichannel convolution with one impulse of len samples for each channel.
+MultichannelConvolver* DLL_EXPORT MultichannelConvolver_Create(const float **impulses, const int len, const int channels);
+/// Process the channel pairs on multiple threads.
+void DLL_EXPORT MultichannelConvolver_SetMultithreaded(MultichannelConvolver *instance, bool multithreaded);
+/// Convolve all channels of an interleaved signal, which has exactly as many channels as the filter.
+void DLL_EXPORT MultichannelConvolver_Process(MultichannelConvolver *instance, float *samples, int len);
+/// Free up the convolution filter's memory.
+void DLL_EXPORT MultichannelConvolver_Dispose(MultichannelConvolver *instance);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MULTICHANNELCONVOLVER_H
@@ -0,0 +1,287 @@
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <immintrin.h>
+
+#include "convolver.h"
+#include "multirateConvolver.h"
+
+using namespace std;
+
+// Taps of each polyphase component of the resampling filters, their length is this many periods of the factor.
+static const int phaseLength = 16;
+// Cutoff frequency of the resampling filters relative to the reduced sample rate. The Blackman window's transition band
+// is about 0.34 wide at this length, so the passband ends near 0.23, and the stopband starts at 0.57, close enough to
+// the reduced Nyquist frequency (0.5) to only alias into the transition band.
+static const double cutoff = .4;
+// Factors tried when detecting a band-limited impulse, from the most to the least efficient.
+static const int candidateFactors[] = { 16, 8 };
+// The impulse has to be this many times longer than the head to be worth convolving at a lower rate.
+static const int minimumHeadRatio = 16;
+// Maximum energy of the difference between the impulse and the multirate filter's response relative to the impulse (-60 dB).
+static const double maximumError = 1e-6;
+
+// Dot product of two arrays with AVX.
+static inline float DotProduct(const float *a, const float *b, int len) {
+    __m256 sum = _mm256_setzero_ps();
+    int i = 0;
+    for (int endSimd = len - 7; i < endSimd; i += 8) {
+        sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+    }
+    __m128 half = _mm_add_ps(_mm256_castps256_ps128(sum), _mm256_extractf128_ps(sum, 1));
+    half = _mm_add_ps(half, _mm_movehl_ps(half, half));
+    float result = _mm_cvtss_f32(_mm_add_ss(half, _mm_shuffle_ps(half, half, 1)));
+    for (; i < len; i++) {
+        result += a[i] * b[i];
+    }
+    return result;
+}
+
+MultirateConvolver::MultirateConvolver(const float *impulse, const int len, const int factor) {
+    Initialize(impulse, len, factor);
+}
+
+MultirateConvolver::MultirateConvolver(const MultirateConvolver &other) {
+    factor = other.factor;
+    resamplerLength = other.resamplerLength;
+    runLength = other.runLength;
+    if (!other.head) {
+        antiAlias = nullptr;
+        interpolator = nullptr;
+        head = nullptr;
+        tail = nullptr;
+        history = nullptr;
+        lowHistory = nullptr;
+        result = nullptr;
+        phase = 0;
+        return;
+    }
+    antiAlias = new float[resamplerLength];
+    memcpy(antiAlias, other.antiAlias, resamplerLength * sizeof(float));
+    interpolator = new float[factor * phaseLength];
+    memcpy(interpolator, other.interpolator, factor * phaseLength * sizeof(float));
+    head = other.head->Clone();
+    tail = other.tail ? new FastConvolver(*other.tail) : nullptr;
+    AllocateState();
+}
+
+void MultirateConvolver::Initialize(const float *impulse, const int len, const int factor) {
+    this->factor = factor;
+    if (!impulse || len <= 0 || factor < 2) {
+        resamplerLength = 0;
+        antiAlias = nullptr;
+        interpolator = nullptr;
+        head = nullptr;
+        tail = nullptr;
+        history = nullptr;
+        lowHistory = nullptr;
+        result = nullptr;
+        phase = 0;
+        runLength = 0;
+        return;
+    }
+
+    // Blackman-windowed sinc lowpass with unity gain, its group delay is an integer as the length is odd
+    resamplerLength = phaseLength * factor - 1;
+    int delay = resamplerLength >> 1;
+    double frequency = cutoff / factor, sum = 0;
+    double *design = new double[resamplerLength];
+    for (int tap = 0; tap < resamplerLength; tap++) {
+        int x = tap - delay;
+        double sinc = x ? sin(2 * M_PI * frequency * x) / (M_PI * x) : 2 * frequency;
+        design[tap] = sinc * (.42 - .5 * cos(2 * M_PI * tap / (resamplerLength - 1)) +
+            .08 * cos(4 * M_PI * tap / (resamplerLength - 1)));
+        sum += design[tap];
+    }
+    antiAlias = new float[resamplerLength];
+    for (int tap = 0; tap < resamplerLength; tap++) {
+        antiAlias[tap] = (float)(design[tap] / sum);
+    }
+    delete[] design;
+
+    // Each output sample is interpolated from every factor-th tap of the anti-image filter, starting from its distance
+    // from the last reduced rate sample, which is multiplied by the factor to compensate the zeros between the samples
+    interpolator = new float[factor * phaseLength];
+    for (int offset = 0; offset < factor; offset++) {
+        for (int sample = 0; sample < phaseLength; sample++) {
+            int tap = offset + sample * factor;
+            interpolator[offset * phaseLength + phaseLength - 1 - sample] =
+                tap < resamplerLength ? factor * antiAlias[tap] : 0;
+        }
+    }
+
+    // The tail has to start later than the group delay of the resampling (2 * delay), which it's advanced by, and the
+    // spread of its band-limited version, so it's faded in after 4 times the group delay of a filter
+    int split = 4 * (delay + 1), fade = split, headLength = min(len, split + fade);
+    float *weights = new float[len];
+    for (int tap = 0; tap < len; tap++) {
+        weights[tap] = tap < split ? 0 : tap >= split + fade ? 1 :
+            (float)(.5 - .5 * cos(M_PI * (tap - split + .5) / fade));
+    }
+    float *headImpulse = new float[headLength];
+    for (int tap = 0; tap < headLength; tap++) {
+        headImpulse[tap] = impulse[tap] * (1 - weights[tap]);
+    }
+    head = Convolver::CreateOptimal(headImpulse, headLength, 0, 0);
+    delete[] headImpulse;
+
+    // The reduced rate tail is every factor-th sample of the band-limited tail, advanced by the group delays of both the
+    // anti-alias filter applied here, and the two resampling filters in the signal path
+    tail = nullptr;
+    if (len > split) {
+        int advance = 3 * delay, filteredLength = len + resamplerLength - 1,
+            tailLength = (filteredLength - advance + factor - 1) / factor;
+        float *tailImpulse = new float[tailLength];
+        for (int sample = 0; sample < tailLength; sample++) {
+            int position = sample * factor + advance;
+            double value = 0;
+            for (int tap = max(0, position - len + 1), end = min(resamplerLength - 1, position - split); tap <= end; tap++) {
+                value += antiAlias[tap] * impulse[position - tap] * weights[position - tap];
+            }
+            tailImpulse[sample] = (float)(factor * value);
+        }
+        tail = new FastConvolver(tailImpulse, tailLength);
+        delete[] tailImpulse;
+    }
+    runLength = tail ? (tail->GetLength() >> 1) * factor : 0;
+    delete[] weights;
+    AllocateState();
+}
+
+void MultirateConvolver::AllocateState() {
+    history = new float[resamplerLength - 1 + runLength]();
+    lowHistory = new float[phaseLength + runLength / factor + 1]();
+    result = new float[runLength];
+    phase = 0;
+}
+
+MultirateConvolver* MultirateConvolver::CreateIfBandLimited(const float *impulse, const int len) {
+    if (!impulse || len <= 0) {
+        return nullptr;
+    }
+
+    double energy = 0;
+    for (int i = 0; i < len; i++) {
+        energy += impulse[i] * impulse[i];
+    }
+    float *response = new float[len];
+    for (int factor : candidateFactors) {
+        if (len < minimumHeadRatio * 4 * phaseLength * factor) { // The head is 8 times the group delay of a filter
+            continue;
+        }
+
+        MultirateConvolver *candidate = new MultirateConvolver(impulse, len, factor);
+        memset(response, 0, len * sizeof(float));
+        response[0] = 1;
+        candidate->Process(response, len);
+        double error = 0;
+        for (int i = 0; i < len; i++) {
+            error += (response[i] - impulse[i]) * (response[i] - impulse[i]);
+        }
+        if (error <= maximumError * energy) {
+            MultirateConvolver *result = new MultirateConvolver(*candidate); // Without the state of the test
+            delete candidate;
+            delete[] response;
+            return result;
+        }
+        delete candidate;
+    }
+    delete[] response;
+    return nullptr;
+}
+
+int MultirateConvolver::GetFactor() const {
+    return factor;
+}
+
+void MultirateConvolver::Process(float *samples, int len) {
+    Process(samples, len, 0, 1);
+}
+
+void MultirateConvolver::Process(float *samples, int len, int channel, int channels) {
+    if (!samples || len <= 0 || channel < 0 || channels <= 0 || !head) {
+        return;
+    }
+    if (!tail) { // The impulse ends before the split, the head is the whole filter, and there's nothing to resample
+        head->Process(samples, len, channel, channels);
+        return;
+    }
+
+    for (int remaining = len / channels; remaining > 0; remaining -= runLength) {
+        int count = min(remaining, runLength);
+        ProcessRun(samples, count, channel, channels);
+        samples += count * channels;
+    }
+}
+
+void MultirateConvolver::ProcessRun(float *samples, int count, int channel, int channels) {
+    float *input = history + resamplerLength - 1;
+    for (int i = 0; i < count; i++) {
+        input[i] = samples[i * channels + channel];
+    }
+
+    // Decimate the input at the last sample of each period, and convolve it at the reduced rate
+    float *low = lowHistory + phaseLength;
+    int lowCount = 0;
+    for (int i = factor - 1 - phase; i < count; i += factor) {
+        low[lowCount++] = DotProduct(antiAlias, history + i, resamplerLength);
+    }
+    if (lowCount) {
+        tail->Process(low, lowCount);
+    }
+
+    // Interpolate each output sample from the reduced rate samples that were available at that time
+    for (int i = 0, produced = 0, position = phase; i < count; i++) {
+        if (position == factor - 1) {
+            produced++;
+            position = 0;
+        } else {
+            position++;
+        }
+        result[i] = DotProduct(interpolator + position * phaseLength, lowHistory + produced, phaseLength);
+    }
+
+    head->Process(samples, count * channels, channel, channels);
+    for (int i = 0; i < count; i++) {
+        samples[i * channels + channel] += result[i];
+    }
+
+    memmove(history, history + count, (resamplerLength - 1) * sizeof(float));
+    memmove(lowHistory, lowHistory + lowCount, phaseLength * sizeof(float));
+    phase = (phase + count) % factor;
+}
+
+Filter* MultirateConvolver::Clone() const {
+    return new MultirateConvolver(*this);
+}
+
+MultirateConvolver::~MultirateConvolver() {
+    delete[] antiAlias;
+    delete[] interpolator;
+    delete head;
+    delete tail;
+    delete[] history;
+    delete[] lowHistory;
+    delete[] result;
+}
+
+MultirateConvolver* DLL_EXPORT MultirateConvolver_Create(const float *impulse, const int len, const int factor) {
+    return new MultirateConvolver(impulse, len, factor);
+}
+
+MultirateConvolver* DLL_EXPORT MultirateConvolver_CreateIfBandLimited(const float *impulse, const int len) {
+    return MultirateConvolver::CreateIfBandLimited(impulse, len);
+}
+
+int DLL_EXPORT MultirateConvolver_GetFactor(MultirateConvolver *instance) {
+    return instance->GetFactor();
+}
+
+void DLL_EXPORT MultirateConvolver_Process(MultirateConvolver *instance, float *samples, int len, int channel,
+    int channels) {
+    instance->Process(samples, len, channel, channels);
+}
+
+void DLL_EXPORT MultirateConvolver_Dispose(MultirateConvolver *instance) {
+    delete instance;
+}
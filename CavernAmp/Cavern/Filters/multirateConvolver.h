@@ -0,0 +1,101 @@
+#ifndef MULTIRATECONVOLVER_H
+#define MULTIRATECONVOLVER_H
+
+#include "../../export.h"
+#include "fastConvolver.h"
+#include "filter.h"
+
+/// \brief Convolution with a band-limited impulse, like subwoofer or LFE correction, at a fraction of the sample rate.
+/// The impulse is split with a crossfade to a short head, which is convolved at the full rate, and a tail, which is
+/// convolved after decimating the signal with a polyphase anti-alias filter, then interpolated back. The tail impulse is
+/// advanced by the group delay of the resampling filters, which the head covers, so the filter has no latency or
+/// added delay.
+class MultirateConvolver : public Filter {
+private:
+    /// Ratio of the full and the reduced sample rate.
+    int factor;
+
+    /// Number of taps of the anti-alias and anti-image filters, one less than a multiple of the factor.
+    int resamplerLength;
+
+    /// Taps of the anti-alias filter in reverse order, which is also the anti-image filter, as it's symmetric.
+    float *antiAlias;
+
+    /// Polyphase decomposition of the anti-image filter multiplied by the factor, factor phases of (resamplerLength + 1) /
+    /// factor taps each, every phase in reverse order.
+    float *interpolator;
+
+    /// Convolution of the head of the impulse at the full rate.
+    Filter *head;
+
+    /// Convolution of the tail of the impulse at the reduced rate, nullptr if the impulse ends before the split, when the
+    /// head is the whole filter.
+    FastConvolver *tail;
+
+    /// The last resamplerLength - 1 input samples, followed by the input samples of the current run.
+    float *history;
+
+    /// The last samples of the tail's output needed by the interpolator, followed by the ones of the current run.
+    float *lowHistory;
+
+    /// Output of the tail for the current run.
+    float *result;
+
+    /// Position of the next input sample in its decimation period.
+    int phase;
+
+    /// Maximum number of samples processed at once, a timeslot of the tail at the full rate, so each transform of the
+    /// tail covers as many samples as it can.
+    int runLength;
+
+    /// Internal constructor behavior.
+    void Initialize(const float *impulse, const int len, const int factor);
+
+    /// Allocate the histories and the buffers, all cleared.
+    void AllocateState();
+
+    /// Convolve at most a run of samples.
+    void ProcessRun(float *samples, int count, int channel, int channels);
+
+public:
+    /// Constructs a convolution for an impulse with no content above a fraction of about 1 / (4 * factor) of the sample
+    /// rate, which is convolved at 1 / factor of the sample rate. Higher frequencies are removed from the tail.
+    MultirateConvolver(const float *impulse, const int len, const int factor);
+
+    /// Copy the filters of another MultirateConvolver.
+    MultirateConvolver(const MultirateConvolver &other);
+
+    /// Create a MultirateConvolver with the lowest rate that reproduces the impulse within -60 dB of error, or return
+    /// nullptr if the impulse is too short to be worth it, or has too much content at high frequencies.
+    static MultirateConvolver* CreateIfBandLimited(const float *impulse, const int len);
+
+    /// Ratio of the full and the reduced sample rate.
+    int GetFactor() const;
+
+    /// Apply convolution on an array of samples. One filter should be applied to only one continuous stream of samples.
+    void Process(float *samples, int len);
+    void Process(float *samples, int len, int channel, int channels);
+    Filter* Clone() const override;
+    ~MultirateConvolver();
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Constructs a convolution for a band-limited impulse, which is convolved at 1 / factor of the sample rate.
+MultirateConvolver* DLL_EXPORT MultirateConvolver_Create(const float *impulse, const int len, const int factor);
+/// Create a multirate convolution if the impulse is long enough and band-limited enough, or return null.
+MultirateConvolver* DLL_EXPORT MultirateConvolver_CreateIfBandLimited(const float *impulse, const int len);
+/// Ratio of the full and the reduced sample rate.
+int DLL_EXPORT MultirateConvolver_GetFactor(MultirateConvolver *instance);
+/// Apply convolution on an array of samples (interleaved channels).
+void DLL_EXPORT MultirateConvolver_Process(MultirateConvolver *instance, float *samples, int len, int channel, int channels);
+/// Free up the convolution filter's memory.
+void DLL_EXPORT MultirateConvolver_Dispose(MultirateConvolver *instance);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MULTIRATECONVOLVER_H
@@ -0,0 +1,167 @@
+#include <algorithm>
+#include <cstring>
+
+#include "../Utilities/complexArray.h"
+#include "partitionedConvolver.h"
+#include "../Utilities/measurements.h"
+
+using namespace std;
+
+PartitionedConvolver::PartitionedConvolver(const float *impulse, const int len, const int blockSize) {
+    Initialize(impulse, len, blockSize);
+}
+
+PartitionedConvolver::PartitionedConvolver(const PartitionedConvolver &other) {
+    blockSize = other.blockSize;
+    partitions = other.partitions;
+    cache = other.cache ? new FFTCache(*other.cache) : nullptr; // Only the work array is separate, the plan is shared
+    if (!other.filter) {
+        filter = nullptr;
+        delayLine = nullptr;
+        present = nullptr;
+        input = nullptr;
+        output = nullptr;
+        head = filled = 0;
+        return;
+    }
+    int bins = blockSize + 1;
+    filter = new Complex[partitions * bins];
+    memcpy(filter, other.filter, partitions * bins * sizeof(Complex));
+    AllocateState();
+}
+
+void PartitionedConvolver::Initialize(const float *impulse, const int len, const int blockSize) {
+    if (!impulse || len <= 0 || blockSize <= 0) {
+        this->blockSize = 0;
+        partitions = 0;
+        cache = nullptr;
+        filter = nullptr;
+        delayLine = nullptr;
+        present = nullptr;
+        input = nullptr;
+        output = nullptr;
+        head = filled = 0;
+        return;
+    }
+
+    this->blockSize = blockSize;
+    partitions = (len + blockSize - 1) / blockSize;
+    int fftSize = 2 * blockSize, bins = blockSize + 1;
+    cache = new FFTCache(fftSize);
+    filter = new Complex[partitions * bins];
+    float multiplier = 1.f / fftSize; // The normalization of the inverse transform is done by the filter
+    for (int partition = 0; partition < partitions; partition++) {
+        // Each partition is zero padded to the transform size, as only the second half of the result is kept
+        float *partitionSamples = (float*)(filter + partition * bins);
+        int offset = partition * blockSize, count = min(blockSize, len - offset);
+        for (int sample = 0; sample < count; sample++) {
+            partitionSamples[sample] = impulse[offset + sample] * multiplier;
+        }
+        memset(partitionSamples + count, 0, (fftSize - count) * sizeof(float));
+        ProcessRealFFT(partitionSamples, fftSize, cache);
+    }
+    AllocateState();
+}
+
+void PartitionedConvolver::AllocateState() {
+    int bins = blockSize + 1;
+    delayLine = new Complex[partitions * bins]();
+    present = new Complex[bins]();
+    input = new float[2 * blockSize]();
+    output = new float[blockSize]();
+    head = 0;
+    filled = 0;
+}
+
+int PartitionedConvolver::GetLatency() const {
+    return blockSize;
+}
+
+int PartitionedConvolver::GetPartitions() const {
+    return partitions;
+}
+
+void PartitionedConvolver::Process(float *samples, int len) {
+    Process(samples, len, 0, 1);
+}
+
+void PartitionedConvolver::Process(float *samples, int len, int channel, int channels) {
+    if (!samples || len <= 0 || channel < 0 || channels <= 0 || !filter || !cache) {
+        return;
+    }
+
+    float *sample = samples + channel,
+        *lastSample = sample + (len / channels) * channels;
+    while (sample != lastSample) {
+        int count = min(blockSize - filled, (int)((lastSample - sample) / channels));
+        float *newInput = input + blockSize + filled,
+            *result = output + filled;
+        for (int i = 0; i < count; i++) {
+            newInput[i] = *sample;
+            *sample = result[i];
+            sample += channels;
+        }
+        filled += count;
+        if (filled == blockSize) {
+            ProcessBlock();
+            filled = 0;
+        }
+    }
+}
+
+void PartitionedConvolver::ProcessBlock() {
+    // Transform the last two blocks, and push the spectrum to the delay line
+    int fftSize = 2 * blockSize, bins = blockSize + 1;
+    float *presentSamples = (float*)present;
+    memcpy(presentSamples, input, fftSize * sizeof(float));
+    ProcessRealFFT(presentSamples, fftSize, cache);
+    head = head ? head - 1 : partitions - 1;
+    memcpy(delayLine + head * bins, present, bins * sizeof(Complex));
+
+    // Each spectrum in the delay line meets the partition of its age
+    Convolve(present, filter, bins);
+    for (int partition = 1; partition < partitions; partition++) {
+        int slot = head + partition;
+        slot -= slot >= partitions ? partitions : 0;
+        ConvolveAccumulate(present, delayLine + slot * bins, filter + partition * bins, bins);
+    }
+
+    // The first half of the result is the circular wrap of the partitions, only the second half is valid
+    ProcessRealIFFT(presentSamples, fftSize, cache);
+    memcpy(output, presentSamples + blockSize, blockSize * sizeof(float));
+    memcpy(input, input + blockSize, blockSize * sizeof(float));
+}
+
+Filter* PartitionedConvolver::Clone() const {
+    return new PartitionedConvolver(*this);
+}
+
+PartitionedConvolver::~PartitionedConvolver() {
+    delete[] filter;
+    delete[] delayLine;
+    delete[] present;
+    delete[] input;
+    delete[] output;
+    delete cache;
+}
+
+PartitionedConvolver* DLL_EXPORT PartitionedConvolver_Create(const float *impulse, const int len, const int blockSize) {
+    return new PartitionedConvolver(impulse, len, blockSize);
+}
+
+int DLL_EXPORT PartitionedConvolver_GetLatency(PartitionedConvolver *instance) {
+    return instance->GetLatency();
+}
+
+int DLL_EXPORT PartitionedConvolver_GetPartitions(PartitionedConvolver *instance) {
+    return instance->GetPartitions();
+}
+
+void DLL_EXPORT PartitionedConvolver_Process(PartitionedConvolver *instance, float *samples, int len, int channel,
+    int channels) {
+    instance->Process(samples, len, channel, channels);
+}
+
+void DLL_EXPORT PartitionedConvolver_Dispose(PartitionedConvolver *instance) {
+    delete instance;
+}
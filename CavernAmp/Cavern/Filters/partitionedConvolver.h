@@ -0,0 +1,94 @@
+#ifndef PARTITIONEDCONVOLVER_H
+#define PARTITIONEDCONVOLVER_H
+
+#include "../../export.h"
+#include "../Utilities/complex.h"
+#include "../Utilities/fftcache.h"
+#include "filter.h"
+
+/// \brief Uniformly partitioned overlap-save convolution. The impulse is split to partitions of the block size, and the
+/// spectra of the last input blocks are kept in a frequency-domain delay line, where each one meets its partition.
+/// Latency is a single block, and each block costs the same two transforms of twice the block size, regardless of
+/// the length of the impulse.
+class PartitionedConvolver : public Filter {
+private:
+    /// Spectra of the partitions of the impulse, each with blockSize + 1 bins of a real transform.
+    Complex *filter;
+
+    /// Spectra of the last partitions input blocks, a ring buffer with the newest at head.
+    Complex *delayLine;
+
+    /// Cache to perform the FFT in, holds 2 * blockSize real samples or blockSize + 1 bins.
+    Complex *present;
+
+    /// The last two input blocks, the second one is being filled.
+    float *input;
+
+    /// Result of the last full block, returned while the next block is being filled.
+    float *output;
+
+    /// Number of samples in a block, the latency of the filter.
+    int blockSize;
+
+    /// Number of partitions of the impulse.
+    int partitions;
+
+    /// Position of the newest spectrum in the delay line.
+    int head;
+
+    /// Number of samples in the block being filled.
+    int filled;
+
+    /// FFT optimization.
+    FFTCache *cache;
+
+    /// Internal constructor behavior.
+    void Initialize(const float *impulse, const int len, const int blockSize);
+
+    /// Allocate the delay line and the buffers, all cleared.
+    void AllocateState();
+
+    /// When the input block is filled, convolve it and put the result in the output.
+    void ProcessBlock();
+
+public:
+    /// Constructs a partitioned convolution with the given block size.
+    PartitionedConvolver(const float *impulse, const int len, const int blockSize);
+
+    /// Copy the partitions of another PartitionedConvolver.
+    PartitionedConvolver(const PartitionedConvolver &other);
+
+    /// Number of samples the output is delayed by, the block size.
+    int GetLatency() const;
+
+    /// Number of partitions the impulse was split to.
+    int GetPartitions() const;
+
+    /// Apply convolution on an array of samples. One filter should be applied to only one continuous stream of samples.
+    void Process(float *samples, int len);
+    void Process(float *samples, int len, int channel, int channels);
+    Filter* Clone() const override;
+    ~PartitionedConvolver();
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Constructs a partitioned convolution with the given block size, which is also its latency.
+PartitionedConvolver* DLL_EXPORT PartitionedConvolver_Create(const float *impulse, const int len, const int blockSize);
+/// Number of samples the output is delayed by.
+int DLL_EXPORT PartitionedConvolver_GetLatency(PartitionedConvolver *instance);
+/// Number of partitions the impulse was split to.
+int DLL_EXPORT PartitionedConvolver_GetPartitions(PartitionedConvolver *instance);
+/// Apply convolution on an array of samples (interleaved channels).
+void DLL_EXPORT PartitionedConvolver_Process(PartitionedConvolver *instance, float *samples, int len, int channel,
+    int channels);
+/// Free up the convolution filter's memory.
+void DLL_EXPORT PartitionedConvolver_Dispose(PartitionedConvolver *instance);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // PARTITIONEDCONVOLVER_H
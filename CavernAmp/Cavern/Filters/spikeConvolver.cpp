@@ -0,0 +1,141 @@
+#include <algorithm>
+#include <cstring>
+#include <immintrin.h>
+
+#include "spikeConvolver.h"
+
+using namespace std;
+
+// Maximum number of samples processed at once, the output of a run is accumulated in the result array.
+static const int runLength = 256;
+
+SpikeConvolver::SpikeConvolver(const float *impulse, const int len, const int delay) {
+    Initialize(impulse, len, delay);
+}
+
+SpikeConvolver::SpikeConvolver(const SpikeConvolver &other) {
+    spikes = other.spikes;
+    ringLength = other.ringLength;
+    ringPosition = 0;
+    if (!other.ring) {
+        offsets = nullptr;
+        gains = nullptr;
+        ring = nullptr;
+        result = nullptr;
+        return;
+    }
+    offsets = new int[spikes];
+    memcpy(offsets, other.offsets, spikes * sizeof(int));
+    gains = new float[spikes];
+    memcpy(gains, other.gains, spikes * sizeof(float));
+    ring = new float[2 * ringLength]();
+    result = new float[runLength];
+}
+
+void SpikeConvolver::Initialize(const float *impulse, const int len, const int delay) {
+    spikes = 0;
+    ringPosition = 0;
+    if (!impulse || len <= 0 || delay < 0) {
+        offsets = nullptr;
+        gains = nullptr;
+        ring = nullptr;
+        ringLength = 0;
+        result = nullptr;
+        return;
+    }
+
+    int lastSpike = 0;
+    for (int tap = 0; tap < len; tap++) {
+        if (impulse[tap] != 0) {
+            spikes++;
+            lastSpike = tap;
+        }
+    }
+    offsets = new int[spikes];
+    gains = new float[spikes];
+    for (int tap = 0, spike = 0; tap < len; tap++) {
+        if (impulse[tap] != 0) {
+            offsets[spike] = tap + delay;
+            gains[spike++] = impulse[tap];
+        }
+    }
+    ringLength = lastSpike + delay + runLength;
+    ring = new float[2 * ringLength]();
+    result = new float[runLength];
+}
+
+int SpikeConvolver::GetSpikes() const {
+    return spikes;
+}
+
+void SpikeConvolver::Process(float *samples, int len) {
+    Process(samples, len, 0, 1);
+}
+
+void SpikeConvolver::Process(float *samples, int len, int channel, int channels) {
+    if (!samples || len <= 0 || channel < 0 || channels <= 0 || !ring) {
+        return;
+    }
+
+    samples += channel;
+    for (int remaining = len / channels; remaining > 0; remaining -= runLength) {
+        int count = min(remaining, runLength);
+        ProcessRun(samples, count, channels);
+        samples += count * channels;
+    }
+}
+
+void SpikeConvolver::ProcessRun(float *samples, int count, int stride) {
+    int start = ringPosition;
+    for (int i = 0; i < count; i++) {
+        ring[ringPosition] = ring[ringPosition + ringLength] = samples[i * stride];
+        ringPosition = ringPosition + 1 == ringLength ? 0 : ringPosition + 1;
+    }
+
+    // Each spike adds the input from offset samples ago, which is a continuous window in the mirrored ring
+    memset(result, 0, count * sizeof(float));
+    for (int spike = 0; spike < spikes; spike++) {
+        int from = start - offsets[spike];
+        const float *source = ring + (from < 0 ? from + ringLength : from);
+        __m256 gain = _mm256_set1_ps(gains[spike]);
+        int sample = 0;
+        for (int endSimd = count - 7; sample < endSimd; sample += 8) {
+            _mm256_storeu_ps(result + sample,
+                _mm256_add_ps(_mm256_loadu_ps(result + sample), _mm256_mul_ps(gain, _mm256_loadu_ps(source + sample))));
+        }
+        for (; sample < count; sample++) {
+            result[sample] += gains[spike] * source[sample];
+        }
+    }
+
+    for (int i = 0; i < count; i++) {
+        samples[i * stride] = result[i];
+    }
+}
+
+Filter* SpikeConvolver::Clone() const {
+    return new SpikeConvolver(*this);
+}
+
+SpikeConvolver::~SpikeConvolver() {
+    delete[] offsets;
+    delete[] gains;
+    delete[] ring;
+    delete[] result;
+}
+
+SpikeConvolver* DLL_EXPORT SpikeConvolver_Create(const float *impulse, const int len, const int delay) {
+    return new SpikeConvolver(impulse, len, delay);
+}
+
+int DLL_EXPORT SpikeConvolver_GetSpikes(SpikeConvolver *instance) {
+    return instance->GetSpikes();
+}
+
+void DLL_EXPORT SpikeConvolver_Process(SpikeConvolver *instance, float *samples, int len, int channel, int channels) {
+    instance->Process(samples, len, channel, channels);
+}
+
+void DLL_EXPORT SpikeConvolver_Dispose(SpikeConvolver *instance) {
+    delete instance;
+}
@@ -0,0 +1,74 @@
+#ifndef SPIKECONVOLVER_H
+#define SPIKECONVOLVER_H
+
+#include "../../export.h"
+#include "filter.h"
+
+/// \brief Convolution with an impulse that's mostly zeros, like delays, echoes, or sparse reflections. Only the non-zero
+/// taps are stored, and each of them adds a delayed and scaled copy of the input to the output, so the cost depends on
+/// the number of spikes, not the length of the impulse. It has no latency.
+class SpikeConvolver : public Filter {
+private:
+    /// Positions of the non-zero taps in the impulse, with the added delay.
+    int *offsets;
+
+    /// Values of the non-zero taps.
+    float *gains;
+
+    /// Number of non-zero taps.
+    int spikes;
+
+    /// Input samples in a ring buffer of ringLength, which is mirrored after itself, so any window of the last ringLength
+    /// samples can be read without wrapping.
+    float *ring;
+
+    /// Number of samples held by the ring, the longest offset and a run.
+    int ringLength;
+
+    /// Position of the next input sample in the ring.
+    int ringPosition;
+
+    /// Output of the current run.
+    float *result;
+
+    /// Internal constructor behavior.
+    void Initialize(const float *impulse, const int len, const int delay);
+
+    /// Convolve at most a run of samples.
+    void ProcessRun(float *samples, int count, int stride);
+
+public:
+    /// Constructs a sparse convolution with added delay.
+    SpikeConvolver(const float *impulse, const int len, const int delay);
+
+    /// Copy the spikes of another SpikeConvolver.
+    SpikeConvolver(const SpikeConvolver &other);
+
+    /// Number of non-zero taps in the impulse.
+    int GetSpikes() const;
+
+    /// Apply convolution on an array of samples. One filter should be applied to only one continuous stream of samples.
+    void Process(float *samples, int len);
+    void Process(float *samples, int len, int channel, int channels);
+    Filter* Clone() const override;
+    ~SpikeConvolver();
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Constructs a sparse convolution with added delay.
+SpikeConvolver* DLL_EXPORT SpikeConvolver_Create(const float *impulse, const int len, const int delay);
+/// Number of non-zero taps in the impulse.
+int DLL_EXPORT SpikeConvolver_GetSpikes(SpikeConvolver *instance);
+/// Apply convolution on an array of samples (interleaved channels).
+void DLL_EXPORT SpikeConvolver_Process(SpikeConvolver *instance, float *samples, int len, int channel, int channels);
+/// Free up the convolution filter's memory.
+void DLL_EXPORT SpikeConvolver_Dispose(SpikeConvolver *instance);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SPIKECONVOLVER_H
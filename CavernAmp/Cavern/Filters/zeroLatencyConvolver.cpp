@@ -0,0 +1,321 @@
+#include <algorithm>
+#include <cstring>
+#include <immintrin.h>
+
+#include "../Utilities/complexArray.h"
+#include "../Utilities/fftcache.h"
+#include "../Utilities/measurements.h"
+#include "../Utilities/Threading/deadlineScheduler.h"
+#include "zeroLatencyConvolver.h"
+
+using namespace std;
+
+// Direct form taps when not given, and the block size of the first segment.
+static const int defaultHeadLength = 64;
+// Block sizes double from segment to segment until this size, the last segment holds all remaining partitions.
+static const int maximumBlockSize = 16384;
+// Sample rate of the stream until it's set.
+static const int defaultSampleRate = 48000;
+
+// Uniformly partitioned convolution of a part of the impulse, with its input blocks given from the outside. The result of
+// each block is written to alternating halves of the results, so the last one can be read while the next is calculated.
+struct ConvolverSegment : public DeadlineTask {
+    // Number of samples in a block, the latency of the segment.
+    int blockSize;
+    // Position of the first tap of the segment in the impulse, at least one block.
+    int offset;
+    // Number of partitions of the segment.
+    int partitions;
+    // The first tap is at least two blocks late, so there's a block of time to calculate the result in the background.
+    bool background;
+    // Spectra of the partitions, each with blockSize + 1 bins of a real transform.
+    Complex *filter;
+    // Spectra of the last partitions input blocks, a ring buffer with the newest at head.
+    Complex *delayLine;
+    // The last two input blocks when the segment is started, then the FFT cache.
+    Complex *present;
+    // Results of the last two blocks.
+    float *results;
+    // Position of the newest spectrum in the delay line.
+    int head;
+    // Half of the results the running block is written to.
+    int target;
+    // FFT optimization.
+    FFTCache *cache;
+
+    ConvolverSegment(const float *impulse, const int len, const int offset, const int blockSize, const int partitions) :
+        blockSize(blockSize), offset(offset), partitions(partitions), background(offset >= 2 * blockSize), head(0), target(0) {
+        int fftSize = 2 * blockSize, bins = blockSize + 1;
+        cache = new FFTCache(fftSize);
+        filter = new Complex[partitions * bins];
+        float multiplier = 1.f / fftSize; // The normalization of the inverse transform is done by the filter
+        for (int partition = 0; partition < partitions; partition++) {
+            float *partitionSamples = (float*)(filter + partition * bins);
+            int first = offset + partition * blockSize, count = min(blockSize, len - first);
+            for (int sample = 0; sample < count; sample++) {
+                partitionSamples[sample] = impulse[first + sample] * multiplier;
+            }
+            memset(partitionSamples + count, 0, (fftSize - count) * sizeof(float));
+            ProcessRealFFT(partitionSamples, fftSize, cache);
+        }
+        AllocateState();
+    }
+
+    ConvolverSegment(const ConvolverSegment &other) : blockSize(other.blockSize), offset(other.offset),
+        partitions(other.partitions), background(other.background), head(0), target(0) {
+        cache = new FFTCache(*other.cache);
+        int bins = blockSize + 1;
+        filter = new Complex[partitions * bins];
+        memcpy(filter, other.filter, partitions * bins * sizeof(Complex));
+        AllocateState();
+    }
+
+    void AllocateState() {
+        int bins = blockSize + 1;
+        delayLine = new Complex[partitions * bins]();
+        present = new Complex[bins]();
+        results = new float[2 * blockSize]();
+    }
+
+    // Convolve the input blocks in present.
+    void Run() override {
+        int fftSize = 2 * blockSize, bins = blockSize + 1;
+        float *presentSamples = (float*)present;
+        ProcessRealFFT(presentSamples, fftSize, cache);
+        head = head ? head - 1 : partitions - 1;
+        memcpy(delayLine + head * bins, present, bins * sizeof(Complex));
+        Convolve(present, filter, bins);
+        for (int partition = 1; partition < partitions; partition++) {
+            int slot = head + partition;
+            slot -= slot >= partitions ? partitions : 0;
+            ConvolveAccumulate(present, delayLine + slot * bins, filter + partition * bins, bins);
+        }
+        ProcessRealIFFT(presentSamples, fftSize, cache);
+        memcpy(results + target * blockSize, presentSamples + blockSize, blockSize * sizeof(float));
+    }
+
+    // Result of the segment for the given time of the output stream.
+    float* Output(const long long time) const {
+        long long block = time / blockSize - offset / blockSize;
+        return results + (block & 1) * blockSize + time % blockSize;
+    }
+
+    ~ConvolverSegment() {
+        delete[] filter;
+        delete[] delayLine;
+        delete[] present;
+        delete[] results;
+        delete cache;
+    }
+};
+
+ZeroLatencyConvolver::ZeroLatencyConvolver(const float *impulse, const int len) {
+    Initialize(impulse, len, defaultHeadLength);
+}
+
+ZeroLatencyConvolver::ZeroLatencyConvolver(const float *impulse, const int len, const int headLength) {
+    Initialize(impulse, len, headLength > 0 ? headLength : defaultHeadLength);
+}
+
+ZeroLatencyConvolver::ZeroLatencyConvolver(const ZeroLatencyConvolver &other) {
+    sampleRate = other.sampleRate;
+    headLength = other.headLength;
+    historyLength = other.historyLength;
+    if (!other.head) {
+        head = nullptr;
+        headHistory = nullptr;
+        history = nullptr;
+        result = nullptr;
+        time = 0;
+        return;
+    }
+    head = new float[headLength];
+    memcpy(head, other.head, headLength * sizeof(float));
+    for (const ConvolverSegment *segment : other.segments) {
+        segments.push_back(new ConvolverSegment(*segment));
+    }
+    AllocateState();
+}
+
+void ZeroLatencyConvolver::Initialize(const float *impulse, const int len, const int headLength) {
+    sampleRate = defaultSampleRate;
+    if (!impulse || len <= 0) {
+        this->headLength = 0;
+        historyLength = 0;
+        head = nullptr;
+        headHistory = nullptr;
+        history = nullptr;
+        result = nullptr;
+        time = 0;
+        return;
+    }
+
+    this->headLength = min(headLength, len);
+    head = new float[this->headLength];
+    for (int tap = 0; tap < this->headLength; tap++) {
+        head[tap] = impulse[this->headLength - 1 - tap];
+    }
+
+    // A segment with twice the block size can start when the impulse reached twice its block size
+    int offset = this->headLength, blockSize = this->headLength;
+    while (offset < len) {
+        bool last = blockSize >= maximumBlockSize;
+        int end = last ? len : min(4 * blockSize, len),
+            partitions = (end - offset + blockSize - 1) / blockSize;
+        segments.push_back(new ConvolverSegment(impulse, len, offset, blockSize, partitions));
+        offset += partitions * blockSize;
+        if (!last) {
+            blockSize *= 2;
+        }
+    }
+    historyLength = 2 * (segments.empty() ? this->headLength : segments.back()->blockSize);
+    AllocateState();
+}
+
+void ZeroLatencyConvolver::AllocateState() {
+    headHistory = new float[2 * headLength - 1]();
+    history = new float[historyLength]();
+    result = new float[headLength];
+    time = 0;
+}
+
+int ZeroLatencyConvolver::GetSegments() const {
+    return (int)segments.size();
+}
+
+int ZeroLatencyConvolver::GetSampleRate() const {
+    return sampleRate;
+}
+
+void ZeroLatencyConvolver::SetSampleRate(int sampleRate) {
+    if (sampleRate > 0) {
+        this->sampleRate = sampleRate;
+    }
+}
+
+void ZeroLatencyConvolver::Process(float *samples, int len) {
+    Process(samples, len, 0, 1);
+}
+
+void ZeroLatencyConvolver::Process(float *samples, int len, int channel, int channels) {
+    if (!samples || len <= 0 || channel < 0 || channels <= 0 || !head) {
+        return;
+    }
+
+    samples += channel;
+    int remaining = len / channels;
+    while (remaining) {
+        int count = min(remaining, headLength - (int)(time % headLength));
+        ProcessRun(samples, count, channels);
+        samples += count * channels;
+        remaining -= count;
+        if (time % headLength == 0) {
+            StartSegments();
+        }
+    }
+}
+
+void ZeroLatencyConvolver::ProcessRun(float *samples, int count, int stride) {
+    float *input = headHistory + headLength - 1;
+    int historyPosition = (int)(time % historyLength);
+    for (int i = 0; i < count; i++) {
+        input[i] = samples[i * stride];
+        history[historyPosition] = input[i];
+        historyPosition = historyPosition + 1 == historyLength ? 0 : historyPosition + 1;
+    }
+
+    // Direct form head, 8 output samples at a time
+    int sample = 0;
+    for (int endSimd = count - 7; sample < endSimd; sample += 8) {
+        __m256 sum = _mm256_setzero_ps();
+        for (int tap = 0; tap < headLength; tap++) {
+            sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_set1_ps(head[tap]), _mm256_loadu_ps(headHistory + sample + tap)));
+        }
+        _mm256_storeu_ps(result + sample, sum);
+    }
+    for (; sample < count; sample++) {
+        float sum = 0;
+        for (int tap = 0; tap < headLength; tap++) {
+            sum += head[tap] * headHistory[sample + tap];
+        }
+        result[sample] = sum;
+    }
+
+    for (const ConvolverSegment *segment : segments) {
+        float *source = segment->Output(time);
+        for (int i = 0; i < count; i++) {
+            result[i] += source[i];
+        }
+    }
+    for (int i = 0; i < count; i++) {
+        samples[i * stride] = result[i];
+    }
+    memmove(headHistory, headHistory + count, (headLength - 1) * sizeof(float));
+    time += count;
+}
+
+void ZeroLatencyConvolver::StartSegments() {
+    // Background segments are started first, so the worker is busy while the foreground segment is processed
+    for (auto segment = segments.rbegin(); segment != segments.rend(); ++segment) {
+        ConvolverSegment *current = *segment;
+        int blockSize = current->blockSize;
+        if (time % blockSize) {
+            continue;
+        }
+        if (current->background) {
+            DeadlineScheduler::Complete(current); // Its result is output from now on
+        }
+
+        // Copy the last two input blocks, the ones before the start of the stream are silent
+        float *window = (float*)current->present;
+        long long start = time - 2 * blockSize;
+        int silence = start < 0 ? (int)-start : 0,
+            position = (int)((start + silence) % historyLength),
+            firstPart = min(2 * blockSize - silence, historyLength - position);
+        memset(window, 0, silence * sizeof(float));
+        memcpy(window + silence, history + position, firstPart * sizeof(float));
+        memcpy(window + silence + firstPart, history, (2 * blockSize - silence - firstPart) * sizeof(float));
+
+        current->target = (int)((time / blockSize - 1) & 1);
+        if (current->background) {
+            // Deadlines are on the wall clock shared by all convolvers: the result is needed one block from now
+            DeadlineScheduler::Submit(current, blockSize * 1000000000LL / sampleRate);
+        } else {
+            current->Run();
+        }
+    }
+}
+
+Filter* ZeroLatencyConvolver::Clone() const {
+    return new ZeroLatencyConvolver(*this);
+}
+
+ZeroLatencyConvolver::~ZeroLatencyConvolver() {
+    for (ConvolverSegment *segment : segments) {
+        if (segment->background) {
+            DeadlineScheduler::Complete(segment);
+        }
+        delete segment;
+    }
+    delete[] head;
+    delete[] headHistory;
+    delete[] history;
+    delete[] result;
+}
+
+ZeroLatencyConvolver* DLL_EXPORT ZeroLatencyConvolver_Create(const float *impulse, const int len, const int headLength) {
+    return new ZeroLatencyConvolver(impulse, len, headLength);
+}
+
+void DLL_EXPORT ZeroLatencyConvolver_SetSampleRate(ZeroLatencyConvolver *instance, int sampleRate) {
+    instance->SetSampleRate(sampleRate);
+}
+
+void DLL_EXPORT ZeroLatencyConvolver_Process(ZeroLatencyConvolver *instance, float *samples, int len, int channel,
+    int channels) {
+    instance->Process(samples, len, channel, channels);
+}
+
+void DLL_EXPORT ZeroLatencyConvolver_Dispose(ZeroLatencyConvolver *instance) {
+    delete instance;
+}
@@ -0,0 +1,100 @@
+#ifndef ZEROLATENCYCONVOLVER_H
+#define ZEROLATENCYCONVOLVER_H
+
+#include <vector>
+
+#include "../../export.h"
+#include "filter.h"
+
+struct ConvolverSegment;
+
+/// \brief Non-uniformly partitioned convolution without latency. The head of the impulse is convolved in direct form,
+/// the rest is split to segments of uniformly partitioned convolutions with growing block sizes. Each segment starts late
+/// enough in the impulse to cover its block latency, and all but the first one have a block of time to finish, so they
+/// are processed on a background worker, the ones with the earliest deadlines first.
+class ZeroLatencyConvolver : public Filter {
+private:
+    /// Taps of the direct form head in reverse order.
+    float *head;
+
+    /// Number of taps convolved in direct form, also the block size of the first segment.
+    int headLength;
+
+    /// The last headLength - 1 input samples followed by the current run of input samples.
+    float *headHistory;
+
+    /// Partitioned convolutions of the rest of the impulse, in the order of their offsets.
+    std::vector<ConvolverSegment*> segments;
+
+    /// The last 2 * largest block size input samples, where the segments take their input blocks from.
+    float *history;
+
+    /// Length of the history.
+    int historyLength;
+
+    /// Output of the current run.
+    float *result;
+
+    /// Number of samples processed since the creation of the filter.
+    long long time;
+
+    /// Sample rate of the stream, converts the block deadlines of the background segments to wall clock time.
+    int sampleRate;
+
+    /// Internal constructor behavior.
+    void Initialize(const float *impulse, const int len, const int headLength);
+
+    /// Allocate the buffers of the direct form head and the input history, all cleared.
+    void AllocateState();
+
+    /// Convolve a run of samples which doesn't cross the end of a block of the first segment.
+    void ProcessRun(float *samples, int count, int stride);
+
+    /// Start the processing of all segments whose input block was just completed.
+    void StartSegments();
+
+public:
+    /// Constructs a zero latency convolution with a default direct form head length.
+    ZeroLatencyConvolver(const float *impulse, const int len);
+
+    /// Constructs a zero latency convolution with a given number of taps in direct form.
+    ZeroLatencyConvolver(const float *impulse, const int len, const int headLength);
+
+    /// Copy the impulse of another ZeroLatencyConvolver.
+    ZeroLatencyConvolver(const ZeroLatencyConvolver &other);
+
+    /// Number of segments processed on the audio thread and on the background worker.
+    int GetSegments() const;
+
+    /// Sample rate of the filtered stream.
+    int GetSampleRate() const;
+
+    /// Set the sample rate of the filtered stream, which the deadlines of the background segments are calculated with.
+    void SetSampleRate(int sampleRate);
+
+    /// Apply convolution on an array of samples. One filter should be applied to only one continuous stream of samples.
+    void Process(float *samples, int len);
+    void Process(float *samples, int len, int channel, int channels);
+    Filter* Clone() const override;
+    ~ZeroLatencyConvolver();
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Constructs a zero latency convolution with a given number of taps in direct form, or the default for 0.
+ZeroLatencyConvolver* DLL_EXPORT ZeroLatencyConvolver_Create(const float *impulse, const int len, const int headLength);
+/// Set the sample rate of the filtered stream, which the deadlines of the background segments are calculated with.
+void DLL_EXPORT ZeroLatencyConvolver_SetSampleRate(ZeroLatencyConvolver *instance, int sampleRate);
+/// Apply convolution on an array of samples (interleaved channels).
+void DLL_EXPORT ZeroLatencyConvolver_Process(ZeroLatencyConvolver *instance, float *samples, int len, int channel,
+    int channels);
+/// Free up the convolution filter's memory.
+void DLL_EXPORT ZeroLatencyConvolver_Dispose(ZeroLatencyConvolver *instance);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ZEROLATENCYCONVOLVER_H
@@ -0,0 +1,81 @@
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "deadlineScheduler.h"
+
+// The single background worker and its queue.
+class DeadlineWorker {
+public:
+    // Guards the queue and the states of all tasks.
+    std::mutex lock;
+    // Signaled when a task is queued or a task is finished.
+    std::condition_variable queueChanged, finished;
+    // Tasks waiting to be performed, in no particular order.
+    std::vector<DeadlineTask*> queue;
+
+    DeadlineWorker() {
+        std::thread(&DeadlineWorker::Work, this).detach(); // The worker is never destroyed, it ends with the process
+    }
+
+    // Remove a task from the queue.
+    void Dequeue(DeadlineTask *task) {
+        queue.erase(std::find(queue.begin(), queue.end(), task));
+    }
+
+private:
+    void Work() {
+        std::unique_lock<std::mutex> guard(lock);
+        while (true) {
+            queueChanged.wait(guard, [&] { return !queue.empty(); });
+            DeadlineTask *next = *std::min_element(queue.begin(), queue.end(),
+                [](const DeadlineTask *lhs, const DeadlineTask *rhs) { return lhs->deadline < rhs->deadline; });
+            Dequeue(next);
+            next->queued = false;
+            next->running = true;
+            guard.unlock();
+            next->Run();
+            guard.lock();
+            next->running = false;
+            finished.notify_all();
+        }
+    }
+
+    friend class DeadlineScheduler;
+};
+
+// Created on first use and intentionally never freed: joining the thread while the library is unloading could deadlock.
+static DeadlineWorker* GetWorker() {
+    static DeadlineWorker *worker = new DeadlineWorker();
+    return worker;
+}
+
+void DeadlineScheduler::Submit(DeadlineTask *task, const long long nanoseconds) {
+    DeadlineWorker *worker = GetWorker();
+    long long now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+    {
+        std::lock_guard<std::mutex> guard(worker->lock);
+        task->deadline = now + nanoseconds;
+        task->queued = true;
+        worker->queue.push_back(task);
+    }
+    worker->queueChanged.notify_one();
+}
+
+void DeadlineScheduler::Complete(DeadlineTask *task) {
+    DeadlineWorker *worker = GetWorker();
+    std::unique_lock<std::mutex> guard(worker->lock);
+    if (task->queued) {
+        // Waiting for the worker to pick it up would only add its other tasks to the caller's wait
+        worker->Dequeue(task);
+        task->queued = false;
+        guard.unlock();
+        task->Run();
+        return;
+    }
+    worker->finished.wait(guard, [&] { return !task->running; });
+}
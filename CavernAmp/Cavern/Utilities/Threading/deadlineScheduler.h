@@ -0,0 +1,35 @@
+#ifndef DEADLINESCHEDULER_H
+#define DEADLINESCHEDULER_H
+
+/// Class
+// Work that has to be finished by a deadline, run by the DeadlineScheduler or by its owner when the deadline is reached.
+class DeadlineTask {
+public:
+    // Perform the work.
+    virtual void Run() = 0;
+    virtual ~DeadlineTask() { };
+
+private:
+    friend class DeadlineScheduler;
+    friend class DeadlineWorker;
+    // Point of the steady clock in nanoseconds when the results are needed, comparable between all owners.
+    long long deadline = 0;
+    // The task is waiting in the queue.
+    bool queued = false;
+    // The task is being performed by the background worker.
+    bool running = false;
+};
+
+/// Class
+// Runs tasks on a single background worker thread, always the one with the earliest deadline first. Deadlines are absolute
+// points of a shared clock, so tasks of independent owners are ordered by real urgency. The worker is created on first use
+// and kept alive for the lifetime of the process.
+class DeadlineScheduler {
+public:
+    // Queue a task that is not queued or running, to be finished in the given number of nanoseconds from now.
+    static void Submit(DeadlineTask *task, const long long nanoseconds);
+    // Return when the task is finished. If the worker has not started it yet, it's performed on the calling thread.
+    static void Complete(DeadlineTask *task);
+};
+
+#endif // DEADLINESCHEDULER_H
@@ -0,0 +1,117 @@
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "parallelizer.h"
+
+// Set on threads that are currently executing a loop body, nested loops run on them serially.
+static thread_local bool insideLoop = false;
+
+// Worker threads waiting for loops to help with.
+class WorkerPool {
+    std::vector<std::thread> workers;
+    // Only one loop can use the workers at a time.
+    std::mutex dispatchLock;
+    // Guards the fields of the current loop.
+    std::mutex stateLock;
+    std::condition_variable wake, done;
+    // Incremented on each new loop, this is what workers wait for.
+    unsigned generation = 0;
+    // Workers still executing the current loop.
+    int busyWorkers = 0;
+    const std::function<void(int)> *action = nullptr;
+    std::atomic<int> next { 0 };
+    int end = 0;
+
+    // Take indices of the current loop until all are taken.
+    void Drain() {
+        int i;
+        while ((i = next.fetch_add(1, std::memory_order_relaxed)) < end) {
+            (*action)(i);
+        }
+    }
+
+    void Work() {
+        insideLoop = true;
+        unsigned seen = 0;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(stateLock);
+                wake.wait(lock, [&] { return generation != seen; });
+                seen = generation;
+            }
+            Drain();
+            std::lock_guard<std::mutex> lock(stateLock);
+            if (--busyWorkers == 0) {
+                done.notify_one();
+            }
+        }
+    }
+
+public:
+    WorkerPool() {
+        unsigned threads = std::thread::hardware_concurrency();
+        for (unsigned i = 1; i < threads; i++) {
+            workers.emplace_back(&WorkerPool::Work, this);
+            workers.back().detach(); // The pool is never destroyed, workers end with the process
+        }
+    }
+
+    int Threads() const {
+        return (int)workers.size() + 1;
+    }
+
+    // Run the loop on the pool if it's free. Returns false if another loop is running and nothing was done.
+    bool TryFor(const int start, const int end, const std::function<void(int)> &action) {
+        std::unique_lock<std::mutex> dispatch(dispatchLock, std::try_to_lock);
+        if (!dispatch.owns_lock()) {
+            return false;
+        }
+        {
+            std::lock_guard<std::mutex> lock(stateLock);
+            this->action = &action;
+            this->end = end;
+            next.store(start, std::memory_order_relaxed);
+            busyWorkers = (int)workers.size();
+            generation++;
+        }
+        wake.notify_all();
+        insideLoop = true;
+        Drain();
+        insideLoop = false;
+        std::unique_lock<std::mutex> lock(stateLock);
+        done.wait(lock, [&] { return busyWorkers == 0; });
+        return true;
+    }
+};
+
+// Created on first use and intentionally never freed: joining threads while the library is unloading could deadlock.
+static WorkerPool* GetPool() {
+    static WorkerPool *pool = new WorkerPool();
+    return pool;
+}
+
+void Parallelizer::For(const int start, const int end, const std::function<void(int)> &action) {
+    if (end - start > 1 && !insideLoop && GetPool()->Threads() > 1 && GetPool()->TryFor(start, end, action)) {
+        return;
+    }
+    for (int i = start; i < end; i++) {
+        action(i);
+    }
+}
+
+void Parallelizer::For(const int start, const int end, const std::function<void(int)> &action, const bool parallel) {
+    if (parallel) {
+        For(start, end, action);
+    } else {
+        for (int i = start; i < end; i++) {
+            action(i);
+        }
+    }
+}
+
+int Parallelizer::Threads() {
+    return GetPool()->Threads();
+}
@@ -0,0 +1,20 @@
+#ifndef PARALLELIZER_H
+#define PARALLELIZER_H
+
+#include <functional>
+
+/// Class
+// Runs loop bodies on a persistent pool of worker threads, which are created on first use and kept alive for the
+// lifetime of the process, so dispatching doesn't create threads.
+class Parallelizer {
+public:
+    // Run the action for every index in [start, end). The calling thread takes part in the work and returns when all
+    // indices were processed. Nested calls and calls while the pool is busy with another loop run on the calling thread.
+    static void For(const int start, const int end, const std::function<void(int)> &action);
+    // Run the action for every index in [start, end), only on multiple threads if parallel is set.
+    static void For(const int start, const int end, const std::function<void(int)> &action, const bool parallel);
+    // Get the number of threads a parallel loop can run on, including the calling thread.
+    static int Threads();
+};
+
+#endif // PARALLELIZER_H
@@ -1,7 +1,17 @@
+#include <immintrin.h>
+
 #include "complexArray.h"
 
 void Convolve(Complex* source, Complex* other, int len) {
     Complex* end = source + len;
+    // Four complex multiplications at once: real parts in even, imaginary parts in odd lanes
+    for (Complex* endSimd = end - 3; source < endSimd; source += 4, other += 4) {
+        __m256 a = _mm256_loadu_ps((float*)source), b = _mm256_loadu_ps((float*)other);
+        __m256 aSwapped = _mm256_permute_ps(a, _MM_SHUFFLE(2, 3, 0, 1));
+        __m256 realProducts = _mm256_mul_ps(a, _mm256_moveldup_ps(b)),
+            imaginaryProducts = _mm256_mul_ps(aSwapped, _mm256_movehdup_ps(b));
+        _mm256_storeu_ps((float*)source, _mm256_addsub_ps(realProducts, imaginaryProducts));
+    }
     while (source != end) {
         float oldReal = source->real;
         source->real = source->real * other->real - source->imaginary * other->imaginary;
@@ -10,3 +20,22 @@ void Convolve(Complex* source, Complex* other, int len) {
         other++;
     }
 }
+
+void ConvolveAccumulate(Complex* target, const Complex* source, const Complex* other, int len) {
+    Complex* end = target + len;
+    for (Complex* endSimd = end - 3; target < endSimd; target += 4, source += 4, other += 4) {
+        __m256 a = _mm256_loadu_ps((const float*)source), b = _mm256_loadu_ps((const float*)other);
+        __m256 aSwapped = _mm256_permute_ps(a, _MM_SHUFFLE(2, 3, 0, 1));
+        __m256 realProducts = _mm256_mul_ps(a, _mm256_moveldup_ps(b)),
+            imaginaryProducts = _mm256_mul_ps(aSwapped, _mm256_movehdup_ps(b));
+        __m256 sum = _mm256_add_ps(_mm256_loadu_ps((float*)target), _mm256_addsub_ps(realProducts, imaginaryProducts));
+        _mm256_storeu_ps((float*)target, sum);
+    }
+    while (target != end) {
+        target->real += source->real * other->real - source->imaginary * other->imaginary;
+        target->imaginary += source->real * other->imaginary + source->imaginary * other->real;
+        target++;
+        source++;
+        other++;
+    }
+}
@@ -6,4 +6,7 @@
 // Replace the source with its convolution with an other array.
 void Convolve(Complex* source, Complex* other, int len);
 
+// Add the convolution of two arrays to the target.
+void ConvolveAccumulate(Complex* target, const Complex* source, const Complex* other, int len);
+
 #endif
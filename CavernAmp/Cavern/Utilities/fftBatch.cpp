@@ -0,0 +1,166 @@
+#include <immintrin.h>
+#include <memory>
+
+#include "fftBatch.h"
+#include "fftKernels.h"
+#include "splitComplexArray.h"
+
+// Lane interleaved work arrays of the calling thread: sample k of lane l is at index k * fftBatchLanes + l.
+static thread_local std::unique_ptr<SplitComplexArray> laneWork;
+
+SplitComplexArray* GetLaneWork(const int sampleCount) {
+    int length = sampleCount * fftBatchLanes;
+    if (!laneWork || laneWork->length < length) {
+        laneWork.reset(new SplitComplexArray(length));
+    }
+    return laneWork.get();
+}
+
+// Two merged radix-2 stages on lane interleaved samples. As every lane is at the same index of its own transform,
+// each twiddle factor is broadcast to all lanes.
+template<bool inverse>
+static void LaneRadix4Stage(float *real, float *imaginary, int sampleCount, int length, const SplitComplexArray *twiddles) {
+    const float *innerReal = twiddles->real + length - 1, *innerImaginary = twiddles->imaginary + length - 1,
+        *outerReal = twiddles->real + 2 * length - 1, *outerImaginary = twiddles->imaginary + 2 * length - 1;
+    const int step = length * fftBatchLanes;
+    for (int block = 0; block < sampleCount; block += 4 * length) {
+        for (int i = 0; i < length; i++) {
+            __m256 innerCos = _mm256_broadcast_ss(innerReal + i), innerSin = _mm256_broadcast_ss(innerImaginary + i),
+                outerCos = _mm256_broadcast_ss(outerReal + i), outerSin = _mm256_broadcast_ss(outerImaginary + i);
+            float *r0 = real + (block + i) * fftBatchLanes, *r1 = r0 + step, *r2 = r1 + step, *r3 = r2 + step,
+                *i0 = imaginary + (block + i) * fftBatchLanes, *i1 = i0 + step, *i2 = i1 + step, *i3 = i2 + step;
+            __m256 a0r = _mm256_load_ps(r0), a0i = _mm256_load_ps(i0),
+                a1r = _mm256_load_ps(r1), a1i = _mm256_load_ps(i1),
+                a2r = _mm256_load_ps(r2), a2i = _mm256_load_ps(i2),
+                a3r = _mm256_load_ps(r3), a3i = _mm256_load_ps(i3);
+            Rotate<inverse>(a1r, a1i, innerCos, innerSin);
+            Rotate<inverse>(a3r, a3i, innerCos, innerSin);
+            __m256 b0r = _mm256_add_ps(a0r, a1r), b0i = _mm256_add_ps(a0i, a1i),
+                b1r = _mm256_sub_ps(a0r, a1r), b1i = _mm256_sub_ps(a0i, a1i),
+                b2r = _mm256_add_ps(a2r, a3r), b2i = _mm256_add_ps(a2i, a3i),
+                b3r = _mm256_sub_ps(a2r, a3r), b3i = _mm256_sub_ps(a2i, a3i);
+            Rotate<inverse>(b2r, b2i, outerCos, outerSin);
+            Rotate<inverse>(b3r, b3i, outerCos, outerSin);
+            __m256 c3r = inverse ? _mm256_sub_ps(_mm256_setzero_ps(), b3i) : b3i,
+                c3i = inverse ? b3r : _mm256_sub_ps(_mm256_setzero_ps(), b3r);
+            _mm256_store_ps(r0, _mm256_add_ps(b0r, b2r));
+            _mm256_store_ps(i0, _mm256_add_ps(b0i, b2i));
+            _mm256_store_ps(r2, _mm256_sub_ps(b0r, b2r));
+            _mm256_store_ps(i2, _mm256_sub_ps(b0i, b2i));
+            _mm256_store_ps(r1, _mm256_add_ps(b1r, c3r));
+            _mm256_store_ps(i1, _mm256_add_ps(b1i, c3i));
+            _mm256_store_ps(r3, _mm256_sub_ps(b1r, c3r));
+            _mm256_store_ps(i3, _mm256_sub_ps(b1i, c3i));
+        }
+    }
+}
+
+// Single radix-2 stage merging the two halves of lane interleaved signals, used when the number of stages is odd.
+template<bool inverse>
+static void LaneRadix2FinalStage(float *real, float *imaginary, int sampleCount, const SplitComplexArray *twiddles) {
+    int length = sampleCount >> 1;
+    const float *twiddleReal = twiddles->real + length - 1, *twiddleImaginary = twiddles->imaginary + length - 1;
+    float *r1 = real + length * fftBatchLanes, *i1 = imaginary + length * fftBatchLanes;
+    for (int i = 0; i < length * fftBatchLanes; i += fftBatchLanes) {
+        __m256 oddReal = _mm256_load_ps(r1 + i), oddImaginary = _mm256_load_ps(i1 + i),
+            evenReal = _mm256_load_ps(real + i), evenImaginary = _mm256_load_ps(imaginary + i);
+        int twiddle = i / fftBatchLanes;
+        Rotate<inverse>(oddReal, oddImaginary, _mm256_broadcast_ss(twiddleReal + twiddle),
+            _mm256_broadcast_ss(twiddleImaginary + twiddle));
+        _mm256_store_ps(real + i, _mm256_add_ps(evenReal, oddReal));
+        _mm256_store_ps(imaginary + i, _mm256_add_ps(evenImaginary, oddImaginary));
+        _mm256_store_ps(r1 + i, _mm256_sub_ps(evenReal, oddReal));
+        _mm256_store_ps(i1 + i, _mm256_sub_ps(evenImaginary, oddImaginary));
+    }
+}
+
+// The first two radix-2 stages on lane interleaved samples, where all twiddles are 1, except the -i (or i for the inverse)
+// that's the same as in the radix-4 stages.
+template<bool inverse>
+static void LaneRadix4FirstStage(float *real, float *imaginary, int sampleCount) {
+    for (int i = 0; i < sampleCount * fftBatchLanes; i += 4 * fftBatchLanes) {
+        float *r0 = real + i, *i0 = imaginary + i;
+        __m256 a0r = _mm256_load_ps(r0), a0i = _mm256_load_ps(i0),
+            a1r = _mm256_load_ps(r0 + fftBatchLanes), a1i = _mm256_load_ps(i0 + fftBatchLanes),
+            a2r = _mm256_load_ps(r0 + 2 * fftBatchLanes), a2i = _mm256_load_ps(i0 + 2 * fftBatchLanes),
+            a3r = _mm256_load_ps(r0 + 3 * fftBatchLanes), a3i = _mm256_load_ps(i0 + 3 * fftBatchLanes);
+        __m256 b0r = _mm256_add_ps(a0r, a1r), b0i = _mm256_add_ps(a0i, a1i),
+            b1r = _mm256_sub_ps(a0r, a1r), b1i = _mm256_sub_ps(a0i, a1i),
+            b2r = _mm256_add_ps(a2r, a3r), b2i = _mm256_add_ps(a2i, a3i),
+            b3r = _mm256_sub_ps(a2r, a3r), b3i = _mm256_sub_ps(a2i, a3i);
+        __m256 c3r = inverse ? _mm256_sub_ps(_mm256_setzero_ps(), b3i) : b3i,
+            c3i = inverse ? b3r : _mm256_sub_ps(_mm256_setzero_ps(), b3r);
+        _mm256_store_ps(r0, _mm256_add_ps(b0r, b2r));
+        _mm256_store_ps(i0, _mm256_add_ps(b0i, b2i));
+        _mm256_store_ps(r0 + 2 * fftBatchLanes, _mm256_sub_ps(b0r, b2r));
+        _mm256_store_ps(i0 + 2 * fftBatchLanes, _mm256_sub_ps(b0i, b2i));
+        _mm256_store_ps(r0 + fftBatchLanes, _mm256_add_ps(b1r, c3r));
+        _mm256_store_ps(i0 + fftBatchLanes, _mm256_add_ps(b1i, c3i));
+        _mm256_store_ps(r0 + 3 * fftBatchLanes, _mm256_sub_ps(b1r, c3r));
+        _mm256_store_ps(i0 + 3 * fftBatchLanes, _mm256_sub_ps(b1i, c3i));
+    }
+}
+
+template<bool inverse>
+static void ProcessLaneButterflies(float *real, float *imaginary, int sampleCount, const FFTPlan *plan) {
+    int length = 1;
+    if (sampleCount >= 4) {
+        LaneRadix4FirstStage<inverse>(real, imaginary, sampleCount);
+        length = 4;
+    }
+    for (; length * 4 <= sampleCount; length <<= 2) {
+        LaneRadix4Stage<inverse>(real, imaginary, sampleCount, length, plan->twiddles);
+    }
+    if (length < sampleCount) {
+        LaneRadix2FinalStage<inverse>(real, imaginary, sampleCount, plan->twiddles);
+    }
+}
+
+void ProcessLaneButterflies(float *real, float *imaginary, int sampleCount, const FFTPlan *plan, bool inverse) {
+    if (inverse) {
+        ProcessLaneButterflies<true>(real, imaginary, sampleCount, plan);
+    } else {
+        ProcessLaneButterflies<false>(real, imaginary, sampleCount, plan);
+    }
+}
+
+void ProcessLanes(Complex **signals, int channels, int sampleCount, const FFTPlan *plan, bool inverse, float scale) {
+    SplitComplexArray *work = GetLaneWork(sampleCount);
+    float *real = work->real, *imaginary = work->imaginary;
+
+    // 4 complex samples of all 8 lanes are transposed at once, after which register 2 * j holds the real, 2 * j + 1 holds
+    // the imaginary parts of the j-th sample. Unused lanes transform the first signal again, so the butterflies don't have
+    // to care about the channel count.
+    const Complex *sources[fftBatchLanes];
+    for (int lane = 0; lane < fftBatchLanes; lane++) {
+        sources[lane] = signals[lane < channels ? lane : 0];
+    }
+    int shift = ReversalShift(sampleCount, plan);
+    const int *reversal = plan->reversal;
+    __m256 rows[fftBatchLanes];
+    for (int i = 0; i < sampleCount; i += 4) {
+        for (int lane = 0; lane < fftBatchLanes; lane++) {
+            rows[lane] = _mm256_loadu_ps((const float*)(sources[lane] + i));
+        }
+        Transpose8x8(rows);
+        for (int j = 0; j < 4; j++) {
+            int target = (reversal[i + j] >> shift) * fftBatchLanes;
+            _mm256_store_ps(real + target, rows[2 * j]);
+            _mm256_store_ps(imaginary + target, rows[2 * j + 1]);
+        }
+    }
+
+    ProcessLaneButterflies(real, imaginary, sampleCount, plan, inverse);
+
+    __m256 multiplier = _mm256_set1_ps(scale);
+    for (int i = 0; i < sampleCount; i += 4) {
+        for (int j = 0; j < 4; j++) {
+            rows[2 * j] = _mm256_mul_ps(_mm256_load_ps(real + (i + j) * fftBatchLanes), multiplier);
+            rows[2 * j + 1] = _mm256_mul_ps(_mm256_load_ps(imaginary + (i + j) * fftBatchLanes), multiplier);
+        }
+        Transpose8x8(rows);
+        for (int lane = 0; lane < channels; lane++) {
+            _mm256_storeu_ps((float*)(signals[lane] + i), rows[lane]);
+        }
+    }
+}
@@ -0,0 +1,27 @@
+#ifndef FFTBATCH_H
+#define FFTBATCH_H
+
+#include "complex.h"
+#include "fftPlan.h"
+#include "splitComplexArray.h"
+
+// Transforms of multiple signals of the same size at once, each signal in a different SIMD lane.
+
+/// Number of signals transformed together by ProcessLanes.
+const int fftBatchLanes = 8;
+/// Largest transform where the lanes are faster than transforming the signals one by one. Above this, the 8 times larger
+/// working set falls out of the cache, while single transforms are already vectorized along their samples.
+const int fftBatchMaximumSize = 4096;
+
+/// Get the calling thread's lane interleaved work arrays for at least the given transform size, where sample k of lane l is
+/// at index k * fftBatchLanes + l. The arrays are kept for the lifetime of the thread.
+SplitComplexArray* GetLaneWork(const int sampleCount);
+
+/// Perform all butterfly stages of fftBatchLanes in-place transforms on bit reversed, lane interleaved split samples.
+void ProcessLaneButterflies(float *real, float *imaginary, int sampleCount, const FFTPlan *plan, bool inverse);
+
+/// Transform at most fftBatchLanes signals of the same power of two size of at least 4 in-place, with all of them in the
+/// same pass over the twiddles of the plan. The results are multiplied by the scale.
+void ProcessLanes(Complex **signals, int channels, int sampleCount, const FFTPlan *plan, bool inverse, float scale);
+
+#endif // FFTBATCH_H
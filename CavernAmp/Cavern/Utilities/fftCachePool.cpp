@@ -0,0 +1,70 @@
+#include "fftCachePool.h"
+#include "measurements.h"
+#include "Threading/parallelizer.h"
+
+FFTCachePool::FFTCachePool(const int fftSize) : fftSize(fftSize) {}
+
+FFTCache* FFTCachePool::Lease() {
+    std::lock_guard<std::mutex> lock(locker);
+    if (caches.empty()) {
+        return new FFTCache(fftSize);
+    }
+    FFTCache *cache = caches.back();
+    caches.pop_back();
+    return cache;
+}
+
+void FFTCachePool::Return(FFTCache *cache) {
+    std::lock_guard<std::mutex> lock(locker);
+    caches.push_back(cache);
+}
+
+void FFTCachePool::FFTAllInPlace(Complex **signals, const int channels, const bool multithreaded) {
+    Parallelizer::For(0, channels, [&](int i) {
+        FFTCache *cache = Lease();
+        InPlaceFFT(signals[i], fftSize, cache);
+        Return(cache);
+    }, multithreaded);
+}
+
+void FFTCachePool::IFFTAllInPlace(Complex **transferFunctions, const int channels, const bool multithreaded) {
+    Parallelizer::For(0, channels, [&](int i) {
+        FFTCache *cache = Lease();
+        InPlaceIFFT(transferFunctions[i], fftSize, cache);
+        Return(cache);
+    }, multithreaded);
+}
+
+FFTCachePool::~FFTCachePool() {
+    for (FFTCache *cache : caches) {
+        delete cache;
+    }
+}
+
+FFTCachePool* DLL_EXPORT FFTCachePool_Create(const int fftSize) {
+    return new FFTCachePool(fftSize);
+}
+
+int DLL_EXPORT FFTCachePool_Size(FFTCachePool *pool) {
+    return pool->Size();
+}
+
+FFTCache* DLL_EXPORT FFTCachePool_Lease(FFTCachePool *pool) {
+    return pool->Lease();
+}
+
+void DLL_EXPORT FFTCachePool_Return(FFTCachePool *pool, FFTCache *cache) {
+    pool->Return(cache);
+}
+
+void DLL_EXPORT FFTCachePool_FFTAllInPlace(FFTCachePool *pool, Complex **signals, int channels, bool multithreaded) {
+    pool->FFTAllInPlace(signals, channels, multithreaded);
+}
+
+void DLL_EXPORT FFTCachePool_IFFTAllInPlace(FFTCachePool *pool, Complex **transferFunctions, int channels, bool multithreaded) {
+    pool->IFFTAllInPlace(transferFunctions, channels, multithreaded);
+}
+
+void DLL_EXPORT FFTCachePool_Dispose(FFTCachePool *pool) {
+    delete pool;
+}
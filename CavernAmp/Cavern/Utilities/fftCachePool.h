@@ -0,0 +1,62 @@
+#ifndef FFTCACHEPOOL_H
+#define FFTCACHEPOOL_H
+
+#include <mutex>
+#include <vector>
+
+#include "complex.h"
+#include "fftcache.h"
+#include "../../export.h"
+
+/// Class
+// Reuses FFT caches of a single size between threads. Every leased cache shares the same plan, only work arrays are
+// allocated for each concurrently used cache.
+class FFTCachePool {
+    int fftSize;
+    // Caches not currently leased.
+    std::vector<FFTCache*> caches;
+    // Guards the caches.
+    std::mutex locker;
+
+public:
+    // Create an FFT cache pool for this FFT size.
+    FFTCachePool(const int fftSize);
+    // Get the size of the used FFTs.
+    int Size() const { return fftSize; }
+    // Get an FFT cache to work with.
+    FFTCache* Lease();
+    // Store the cache for later reuse.
+    void Return(FFTCache *cache);
+    // Perform in-place FFT on all signals of the pool's size.
+    void FFTAllInPlace(Complex **signals, const int channels, const bool multithreaded);
+    // Perform in-place IFFT on all transfer functions of the pool's size.
+    void IFFTAllInPlace(Complex **transferFunctions, const int channels, const bool multithreaded);
+    // Free all caches in the pool.
+    ~FFTCachePool();
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Exports
+// Create an FFT cache pool for this FFT size.
+FFTCachePool* DLL_EXPORT FFTCachePool_Create(const int fftSize);
+// Get the size of the used FFTs.
+int DLL_EXPORT FFTCachePool_Size(FFTCachePool *pool);
+// Get an FFT cache to work with. Leased caches shall be returned before the pool is disposed.
+FFTCache* DLL_EXPORT FFTCachePool_Lease(FFTCachePool *pool);
+// Store the cache for later reuse.
+void DLL_EXPORT FFTCachePool_Return(FFTCachePool *pool, FFTCache *cache);
+// Perform in-place FFT on all signals of the pool's size.
+void DLL_EXPORT FFTCachePool_FFTAllInPlace(FFTCachePool *pool, Complex **signals, int channels, bool multithreaded);
+// Perform in-place IFFT on all transfer functions of the pool's size.
+void DLL_EXPORT FFTCachePool_IFFTAllInPlace(FFTCachePool *pool, Complex **transferFunctions, int channels, bool multithreaded);
+// Dispose an FFT cache pool and all caches in it.
+void DLL_EXPORT FFTCachePool_Dispose(FFTCachePool *pool);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // FFTCACHEPOOL_H
@@ -0,0 +1,106 @@
+#ifndef FFTCODELETS_H
+#define FFTCODELETS_H
+
+#include <immintrin.h>
+#include <type_traits>
+
+#include "fftKernels.h"
+
+// Straight-line transforms of 8, 16, 32, and 64 bit reversed split samples, used as the leaves of the power of two FFT.
+// Every loop is unrolled at compile time, so a whole leaf runs in registers without any branching or memory traffic
+// between its stages.
+
+/// Compile-time loop calling action(std::integral_constant<int, i>()) for each i in [index, end).
+template<int index, int end>
+struct StaticFor {
+    template<typename Action>
+    static inline void Run(Action &&action) {
+        action(std::integral_constant<int, index>());
+        StaticFor<index + 1, end>::Run(action);
+    }
+};
+
+template<int end>
+struct StaticFor<end, end> {
+    template<typename Action>
+    static inline void Run(Action&&) {}
+};
+
+/// Transform 8 bit reversed samples held in a single register pair. The three radix-2 stages are done across lanes:
+/// the upper element of each butterfly is rotated, the lanes are swapped with their pairs, and the upper lanes take the
+/// difference instead of the sum.
+template<bool inverse>
+inline void Codelet8(__m256 &real, __m256 &imaginary) {
+    const float c = .70710678118654752f;
+    const __m256 upper1 = _mm256_setr_ps(0, -0.f, 0, -0.f, 0, -0.f, 0, -0.f),
+        upper2 = _mm256_setr_ps(0, 0, -0.f, -0.f, 0, 0, -0.f, -0.f),
+        upper4 = _mm256_setr_ps(0, 0, 0, 0, -0.f, -0.f, -0.f, -0.f);
+
+    // Merge 1 -> 2, all twiddles are 1
+    __m256 swapReal = _mm256_permute_ps(real, 0xB1), swapImaginary = _mm256_permute_ps(imaginary, 0xB1);
+    real = _mm256_add_ps(swapReal, _mm256_xor_ps(real, upper1));
+    imaginary = _mm256_add_ps(swapImaginary, _mm256_xor_ps(imaginary, upper1));
+
+    // Merge 2 -> 4 with twiddles 1 and -i
+    Rotate<inverse>(real, imaginary, _mm256_setr_ps(1, 1, 1, 0, 1, 1, 1, 0), _mm256_setr_ps(0, 0, 0, -1, 0, 0, 0, -1));
+    swapReal = _mm256_permute_ps(real, 0x4E);
+    swapImaginary = _mm256_permute_ps(imaginary, 0x4E);
+    real = _mm256_add_ps(swapReal, _mm256_xor_ps(real, upper2));
+    imaginary = _mm256_add_ps(swapImaginary, _mm256_xor_ps(imaginary, upper2));
+
+    // Merge 4 -> 8 with the 8th roots of unity
+    Rotate<inverse>(real, imaginary, _mm256_setr_ps(1, 1, 1, 1, 1, c, 0, -c), _mm256_setr_ps(0, 0, 0, 0, 0, -c, -1, -c));
+    swapReal = _mm256_permute2f128_ps(real, real, 1);
+    swapImaginary = _mm256_permute2f128_ps(imaginary, imaginary, 1);
+    real = _mm256_add_ps(swapReal, _mm256_xor_ps(real, upper4));
+    imaginary = _mm256_add_ps(swapImaginary, _mm256_xor_ps(imaginary, upper4));
+}
+
+/// Transform size bit reversed samples held in size / 8 register pairs: transform both halves, then merge them with a
+/// radix-2 stage between registers. The twiddles are the per-stage twiddles of a power of two plan.
+template<int size, bool inverse>
+struct Codelet {
+    static inline void Process(__m256 *real, __m256 *imaginary, const float *twiddleReal, const float *twiddleImaginary) {
+        constexpr int half = size / 2, registers = half / 8;
+        Codelet<half, inverse>::Process(real, imaginary, twiddleReal, twiddleImaginary);
+        Codelet<half, inverse>::Process(real + registers, imaginary + registers, twiddleReal, twiddleImaginary);
+        StaticFor<0, registers>::Run([&](auto index) {
+            constexpr int even = decltype(index)::value, odd = even + registers;
+            __m256 oddReal = real[odd], oddImaginary = imaginary[odd];
+            Rotate<inverse>(oddReal, oddImaginary, _mm256_loadu_ps(twiddleReal + half - 1 + even * 8),
+                _mm256_loadu_ps(twiddleImaginary + half - 1 + even * 8));
+            real[odd] = _mm256_sub_ps(real[even], oddReal);
+            imaginary[odd] = _mm256_sub_ps(imaginary[even], oddImaginary);
+            real[even] = _mm256_add_ps(real[even], oddReal);
+            imaginary[even] = _mm256_add_ps(imaginary[even], oddImaginary);
+        });
+    }
+};
+
+template<bool inverse>
+struct Codelet<8, inverse> {
+    static inline void Process(__m256 *real, __m256 *imaginary, const float*, const float*) {
+        Codelet8<inverse>(*real, *imaginary);
+    }
+};
+
+/// Perform the first log2(size) stages of a transform on every consecutive block of size bit reversed split samples.
+template<int size, bool inverse>
+void ProcessCodelets(float *real, float *imaginary, int sampleCount, const SplitComplexArray *twiddles) {
+    constexpr int registers = size / 8;
+    for (int block = 0; block < sampleCount; block += size) {
+        float *blockReal = real + block, *blockImaginary = imaginary + block;
+        __m256 r[registers], i[registers];
+        StaticFor<0, registers>::Run([&](auto index) {
+            r[index] = _mm256_loadu_ps(blockReal + index * 8);
+            i[index] = _mm256_loadu_ps(blockImaginary + index * 8);
+        });
+        Codelet<size, inverse>::Process(r, i, twiddles->real, twiddles->imaginary);
+        StaticFor<0, registers>::Run([&](auto index) {
+            _mm256_storeu_ps(blockReal + index * 8, r[index]);
+            _mm256_storeu_ps(blockImaginary + index * 8, i[index]);
+        });
+    }
+}
+
+#endif // FFTCODELETS_H
@@ -0,0 +1,87 @@
+#include <atomic>
+#include <list>
+#include <utility>
+
+#include "fftFallbackCache.h"
+
+// Memory limit of a single thread's fallback caches.
+static std::atomic<long long> maxBytes { 16 * 1024 * 1024 };
+static std::atomic<long long> hits { 0 }, misses { 0 };
+
+// Approximate memory used by a cache, counting the plan too, as the fallback set keeps it alive.
+static long long CacheBytes(const FFTCache *cache) {
+    long long workLength = cache->work ? cache->work->length : 0, scratchLength = cache->scratch ? cache->scratch->length : 0;
+    return (workLength + scratchLength) * 2 * sizeof(float) // Work arrays
+        + (long long)cache->size() * (2 * sizeof(float) + sizeof(int)); // Twiddles and bit reversal
+}
+
+// Fallback caches of a single thread, the most recently used first.
+class FallbackCacheSet {
+    std::list<std::pair<int, FFTCache*>> caches;
+    long long bytes = 0;
+
+public:
+    FFTCache* Get(const int fftSize) {
+        for (auto it = caches.begin(); it != caches.end(); ++it) {
+            if (it->first == fftSize) {
+                caches.splice(caches.begin(), caches, it);
+                hits.fetch_add(1, std::memory_order_relaxed);
+                return it->second;
+            }
+        }
+
+        misses.fetch_add(1, std::memory_order_relaxed);
+        caches.emplace_front(fftSize, new FFTCache(fftSize));
+        bytes += CacheBytes(caches.front().second);
+        long long limit = maxBytes.load(std::memory_order_relaxed);
+        while (bytes > limit && caches.size() > 1) {
+            bytes -= CacheBytes(caches.back().second);
+            delete caches.back().second;
+            caches.pop_back();
+        }
+        return caches.front().second;
+    }
+
+    void Clear() {
+        for (auto &entry : caches) {
+            delete entry.second;
+        }
+        caches.clear();
+        bytes = 0;
+    }
+
+    ~FallbackCacheSet() {
+        Clear();
+    }
+};
+
+static thread_local FallbackCacheSet fallbackCaches;
+
+FFTCache* GetFallbackFFTCache(const int fftSize) {
+    return fallbackCaches.Get(fftSize);
+}
+
+void DLL_EXPORT FallbackFFTCache_SetMaxBytes(long long limit) {
+    maxBytes.store(limit, std::memory_order_relaxed);
+}
+
+long long DLL_EXPORT FallbackFFTCache_GetMaxBytes() {
+    return maxBytes.load(std::memory_order_relaxed);
+}
+
+long long DLL_EXPORT FallbackFFTCache_Hits() {
+    return hits.load(std::memory_order_relaxed);
+}
+
+long long DLL_EXPORT FallbackFFTCache_Misses() {
+    return misses.load(std::memory_order_relaxed);
+}
+
+void DLL_EXPORT FallbackFFTCache_ResetCounters() {
+    hits.store(0, std::memory_order_relaxed);
+    misses.store(0, std::memory_order_relaxed);
+}
+
+void DLL_EXPORT FallbackFFTCache_Clear() {
+    fallbackCaches.Clear();
+}
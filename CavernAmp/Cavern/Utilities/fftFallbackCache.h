@@ -0,0 +1,35 @@
+#ifndef FFTFALLBACKCACHE_H
+#define FFTFALLBACKCACHE_H
+
+#include "fftcache.h"
+#include "../../export.h"
+
+// Get an FFT cache of the given size from the calling thread's own bounded, least recently used set of caches.
+// Used by the transforms when they are called without a fitting cache. The returned cache is owned by the set and is
+// only valid until the next call of this function on the same thread.
+FFTCache* GetFallbackFFTCache(const int fftSize);
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Exports
+// Set the memory limit of each thread's fallback FFT caches in bytes, applied when a thread creates its next cache.
+// The most recently used cache is always kept.
+void DLL_EXPORT FallbackFFTCache_SetMaxBytes(long long limit);
+// Get the memory limit of each thread's fallback FFT caches in bytes.
+long long DLL_EXPORT FallbackFFTCache_GetMaxBytes();
+// Number of cache-less transforms that could reuse a fallback cache, summed for all threads.
+long long DLL_EXPORT FallbackFFTCache_Hits();
+// Number of cache-less transforms that had to create a fallback cache, summed for all threads.
+long long DLL_EXPORT FallbackFFTCache_Misses();
+// Reset the hit and miss counters.
+void DLL_EXPORT FallbackFFTCache_ResetCounters();
+// Free all fallback caches of the calling thread.
+void DLL_EXPORT FallbackFFTCache_Clear();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // FFTFALLBACKCACHE_H
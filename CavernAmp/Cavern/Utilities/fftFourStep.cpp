@@ -0,0 +1,165 @@
+#include <cpuid.h>
+#include <immintrin.h>
+
+#include "fftBatch.h"
+#include "fftFourStep.h"
+#include "fftKernels.h"
+#include "Threading/parallelizer.h"
+
+// The signal of N samples is viewed as a matrix of R rows and C columns (N = R * C, sample r * C + c is at row r, column c):
+// 1. The columns are transformed, 8 at a time in SIMD lanes, each group of columns fitting in the cache.
+// 2. Every element is rotated by exp(-2 * pi * i * r * c / N), and written to the work array at the same position.
+// 3. The rows of the work array are transformed.
+// 4. The work array is transposed to the target, as bin r + R * c is at row r and column c.
+
+int FourStepMinimum() {
+    static const int minimum = [] {
+        unsigned eax, ebx, ecx, edx;
+        int cacheBytes = 256 * 1024; // When the CPU doesn't report its L2 size
+        if (__get_cpuid(0x80000006, &eax, &ebx, &ecx, &edx) && (ecx >> 16)) {
+            cacheBytes = (ecx >> 16) * 1024;
+        }
+        // The direct path works on 8 bytes of samples and 8 bytes of twiddles for each sample
+        int size = 1 << 10;
+        while (size * 16 <= cacheBytes) {
+            size <<= 1;
+        }
+        return size;
+    }();
+    return minimum;
+}
+
+// Padding after each row of the work array, so the columns of the rows don't map to the same cache sets.
+static const int rowPadding = 16;
+
+// Number of rows of a four-step transform, the columns are at least as long as the rows.
+static int Rows(const int sampleCount) {
+    return 1 << (Log2Int(sampleCount) / 2);
+}
+
+int FourStepWorkLength(const int sampleCount) {
+    return sampleCount + Rows(sampleCount) * rowPadding;
+}
+
+int FourStepScratchLength(const int sampleCount) {
+    return Rows(sampleCount) * fftBatchLanes;
+}
+
+// Twiddle factors exp(-2 * pi * i * exponent / sampleCount) of a power of two size served by a plan, as the product of two
+// of the plan's stage twiddles, so no table of the full size has to be read.
+struct TwiddleSource {
+    const float *real, *imaginary;
+    // Converts the exponent to the plan's size.
+    int mask, shift;
+    // Exponents from half the plan's size are the negated twiddles of the first half.
+    int halfSize;
+    // The last stage holds the fine, an earlier one the coarse part of the exponent, split at this bit.
+    int fineBits;
+    // Start of the fine and coarse stages.
+    int fine, coarse;
+
+    TwiddleSource(const FFTPlan *plan, const int sampleCount) : real(plan->twiddles->real),
+        imaginary(plan->twiddles->imaginary), mask(sampleCount - 1), shift(Log2Int(plan->size()) - Log2Int(sampleCount)),
+        halfSize(plan->size() >> 1), fineBits(Log2Int(plan->size()) / 2), fine(halfSize - 1),
+        coarse((halfSize >> fineBits) - 1) {}
+
+    inline void Get(const int exponent, float &twiddleReal, float &twiddleImaginary) const {
+        int position = (exponent & mask) << shift;
+        bool negate = position >= halfSize;
+        position -= negate ? halfSize : 0;
+        int fineIndex = fine + (position & ((1 << fineBits) - 1)), coarseIndex = coarse + (position >> fineBits);
+        twiddleReal = real[fineIndex];
+        twiddleImaginary = imaginary[fineIndex];
+        Rotate<false>(twiddleReal, twiddleImaginary, real[coarseIndex], imaginary[coarseIndex]);
+        if (negate) {
+            twiddleReal = -twiddleReal;
+            twiddleImaginary = -twiddleImaginary;
+        }
+    }
+};
+
+// Steps 1 and 2 for a single group of fftBatchLanes columns. The lane twiddles hold exp(-2 * pi * i * r * lane / N).
+template<bool inverse>
+static void ProcessColumns(const Complex *source, float *real, float *imaginary, const int group, const int sampleCount,
+    const FFTPlan *plan, const TwiddleSource &twiddles, const SplitComplexArray *laneTwiddles) {
+    int rows = Rows(sampleCount), columns = sampleCount / rows, stride = columns + rowPadding,
+        firstColumn = group * fftBatchLanes;
+    SplitComplexArray *lanes = GetLaneWork(rows);
+    float *laneReal = lanes->real, *laneImaginary = lanes->imaginary;
+
+    int shift = ReversalShift(rows, plan);
+    const int *reversal = plan->reversal;
+    for (int row = 0; row < rows; row++) {
+        const float *pairs = (const float*)(source + row * columns + firstColumn);
+        __m256 first = _mm256_loadu_ps(pairs), second = _mm256_loadu_ps(pairs + 8),
+            low = _mm256_permute2f128_ps(first, second, 0x20), high = _mm256_permute2f128_ps(first, second, 0x31);
+        int target = (reversal[row] >> shift) * fftBatchLanes;
+        _mm256_store_ps(laneReal + target, _mm256_shuffle_ps(low, high, _MM_SHUFFLE(2, 0, 2, 0)));
+        _mm256_store_ps(laneImaginary + target, _mm256_shuffle_ps(low, high, _MM_SHUFFLE(3, 1, 3, 1)));
+    }
+
+    ProcessLaneButterflies(laneReal, laneImaginary, rows, plan, inverse);
+
+    for (int row = 0; row < rows; row++) {
+        float groupReal, groupImaginary;
+        twiddles.Get(row * firstColumn, groupReal, groupImaginary);
+        __m256 twiddleReal = _mm256_load_ps(laneTwiddles->real + row * fftBatchLanes),
+            twiddleImaginary = _mm256_load_ps(laneTwiddles->imaginary + row * fftBatchLanes);
+        Rotate<false>(twiddleReal, twiddleImaginary, _mm256_set1_ps(groupReal), _mm256_set1_ps(groupImaginary));
+        __m256 sampleReal = _mm256_load_ps(laneReal + row * fftBatchLanes),
+            sampleImaginary = _mm256_load_ps(laneImaginary + row * fftBatchLanes);
+        Rotate<inverse>(sampleReal, sampleImaginary, twiddleReal, twiddleImaginary);
+        _mm256_store_ps(real + row * stride + firstColumn, sampleReal);
+        _mm256_store_ps(imaginary + row * stride + firstColumn, sampleImaginary);
+    }
+}
+
+// Step 4 for 8 consecutive rows of the work array.
+static void TransposeRows(const float *real, const float *imaginary, Complex *target, const int firstRow, const int rows,
+    const int columns) {
+    int stride = columns + rowPadding;
+    __m256 realRows[8], imaginaryRows[8];
+    for (int column = 0; column < columns; column += 8) {
+        for (int i = 0; i < 8; i++) {
+            realRows[i] = _mm256_load_ps(real + (firstRow + i) * stride + column);
+            imaginaryRows[i] = _mm256_load_ps(imaginary + (firstRow + i) * stride + column);
+        }
+        Transpose8x8(realRows);
+        Transpose8x8(imaginaryRows);
+        for (int i = 0; i < 8; i++) {
+            __m256 low = _mm256_unpacklo_ps(realRows[i], imaginaryRows[i]),
+                high = _mm256_unpackhi_ps(realRows[i], imaginaryRows[i]);
+            float *pairs = (float*)(target + (column + i) * rows + firstRow);
+            _mm256_storeu_ps(pairs, _mm256_permute2f128_ps(low, high, 0x20));
+            _mm256_storeu_ps(pairs + 8, _mm256_permute2f128_ps(low, high, 0x31));
+        }
+    }
+}
+
+void ProcessFourStep(const Complex *source, Complex *target, int sampleCount, const FFTPlan *plan, SplitComplexArray *work,
+    SplitComplexArray *scratch, bool inverse, bool multithreaded) {
+    int rows = Rows(sampleCount), columns = sampleCount / rows, stride = columns + rowPadding;
+    TwiddleSource twiddles(plan, sampleCount);
+    for (int row = 0; row < rows; row++) {
+        for (int lane = 0; lane < fftBatchLanes; lane++) {
+            twiddles.Get(row * lane, scratch->real[row * fftBatchLanes + lane], scratch->imaginary[row * fftBatchLanes + lane]);
+        }
+    }
+
+    float *real = work->real, *imaginary = work->imaginary;
+    Parallelizer::For(0, columns / fftBatchLanes, [&](int group) {
+        if (inverse) {
+            ProcessColumns<true>(source, real, imaginary, group, sampleCount, plan, twiddles, scratch);
+        } else {
+            ProcessColumns<false>(source, real, imaginary, group, sampleCount, plan, twiddles, scratch);
+        }
+    }, multithreaded);
+    Parallelizer::For(0, rows, [&](int row) {
+        float *rowReal = real + row * stride, *rowImaginary = imaginary + row * stride;
+        PermuteBitReversed(rowReal, rowImaginary, columns, plan);
+        ProcessButterflies(rowReal, rowImaginary, columns, plan, inverse);
+    }, multithreaded);
+    Parallelizer::For(0, rows / 8, [&](int group) {
+        TransposeRows(real, imaginary, target, group * 8, rows, columns);
+    }, multithreaded);
+}
@@ -0,0 +1,27 @@
+#ifndef FFTFOURSTEP_H
+#define FFTFOURSTEP_H
+
+#include "complex.h"
+#include "fftPlan.h"
+#include "splitComplexArray.h"
+
+// Power of two transforms too large for the cache, split to small transforms of the rows and columns of the signal
+// viewed as a matrix, so each of them is performed in the cache.
+
+/// Smallest power of two transform performed in four steps: the butterflies of the direct path touch the whole signal and
+/// all twiddles with each stage, and above this size, they don't fit in the L2 cache of the CPU together.
+int FourStepMinimum();
+
+/// Length of the work array four-step transforms of a size need.
+int FourStepWorkLength(const int sampleCount);
+
+/// Length of the scratch array four-step transforms of a size need.
+int FourStepScratchLength(const int sampleCount);
+
+/// Transform sampleCount interleaved source samples to the interleaved target in natural order, which can be the same
+/// array. The work and scratch arrays have to hold FourStepWorkLength and FourStepScratchLength elements.
+/// With multithreading, the sub-transforms are spread on the Parallelizer. The inverse transform is not normalized.
+void ProcessFourStep(const Complex *source, Complex *target, int sampleCount, const FFTPlan *plan, SplitComplexArray *work,
+    SplitComplexArray *scratch, bool inverse, bool multithreaded);
+
+#endif // FFTFOURSTEP_H
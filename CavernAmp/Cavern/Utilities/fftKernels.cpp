@@ -0,0 +1,167 @@
+#include "fftCodelets.h"
+#include "fftKernels.h"
+
+void GatherBitReversed(const Complex *source, float *real, float *imaginary, int sampleCount, const FFTPlan *plan) {
+    int shift = ReversalShift(sampleCount, plan);
+    const int *reversal = plan->reversal;
+    for (int i = 0; i < sampleCount; i++) {
+        const Complex &sample = source[reversal[i] >> shift];
+        real[i] = sample.real;
+        imaginary[i] = sample.imaginary;
+    }
+}
+
+void GatherRealBitReversed(const float *source, float *real, float *imaginary, int halfCount, const FFTPlan *plan) {
+    int shift = ReversalShift(halfCount, plan);
+    const int *reversal = plan->reversal;
+    for (int i = 0; i < halfCount; i++) {
+        const float *pair = source + 2 * (reversal[i] >> shift);
+        real[i] = pair[0];
+        imaginary[i] = pair[1];
+    }
+}
+
+void PermuteBitReversed(float *real, float *imaginary, int sampleCount, const FFTPlan *plan) {
+    int shift = ReversalShift(sampleCount, plan);
+    const int *reversal = plan->reversal;
+    for (int i = 0; i < sampleCount; i++) {
+        int target = reversal[i] >> shift;
+        if (i < target) {
+            float swap = real[i];
+            real[i] = real[target];
+            real[target] = swap;
+            swap = imaginary[i];
+            imaginary[i] = imaginary[target];
+            imaginary[target] = swap;
+        }
+    }
+}
+
+// Two merged radix-2 stages, combining 4 transforms of the given length. The inner twiddles belong to merging
+// length -> 2 * length, the outer ones to merging 2 * length -> 4 * length. The second half of the outer twiddles are the
+// first half rotated by -i (or i for the inverse).
+template<bool inverse>
+static void Radix4Stage(float *real, float *imaginary, int sampleCount, int length, const SplitComplexArray *twiddles) {
+    const float *innerReal = twiddles->real + length - 1, *innerImaginary = twiddles->imaginary + length - 1,
+        *outerReal = twiddles->real + 2 * length - 1, *outerImaginary = twiddles->imaginary + 2 * length - 1;
+    for (int block = 0; block < sampleCount; block += 4 * length) {
+        float *r0 = real + block, *r1 = r0 + length, *r2 = r1 + length, *r3 = r2 + length,
+            *i0 = imaginary + block, *i1 = i0 + length, *i2 = i1 + length, *i3 = i2 + length;
+        if (length >= 8) {
+            for (int i = 0; i < length; i += 8) {
+                __m256 innerCos = _mm256_loadu_ps(innerReal + i), innerSin = _mm256_loadu_ps(innerImaginary + i),
+                    outerCos = _mm256_loadu_ps(outerReal + i), outerSin = _mm256_loadu_ps(outerImaginary + i);
+                __m256 a0r = _mm256_loadu_ps(r0 + i), a0i = _mm256_loadu_ps(i0 + i),
+                    a1r = _mm256_loadu_ps(r1 + i), a1i = _mm256_loadu_ps(i1 + i),
+                    a2r = _mm256_loadu_ps(r2 + i), a2i = _mm256_loadu_ps(i2 + i),
+                    a3r = _mm256_loadu_ps(r3 + i), a3i = _mm256_loadu_ps(i3 + i);
+                Rotate<inverse>(a1r, a1i, innerCos, innerSin);
+                Rotate<inverse>(a3r, a3i, innerCos, innerSin);
+                __m256 b0r = _mm256_add_ps(a0r, a1r), b0i = _mm256_add_ps(a0i, a1i),
+                    b1r = _mm256_sub_ps(a0r, a1r), b1i = _mm256_sub_ps(a0i, a1i),
+                    b2r = _mm256_add_ps(a2r, a3r), b2i = _mm256_add_ps(a2i, a3i),
+                    b3r = _mm256_sub_ps(a2r, a3r), b3i = _mm256_sub_ps(a2i, a3i);
+                Rotate<inverse>(b2r, b2i, outerCos, outerSin);
+                Rotate<inverse>(b3r, b3i, outerCos, outerSin);
+                __m256 c3r = inverse ? _mm256_sub_ps(_mm256_setzero_ps(), b3i) : b3i,
+                    c3i = inverse ? b3r : _mm256_sub_ps(_mm256_setzero_ps(), b3r);
+                _mm256_storeu_ps(r0 + i, _mm256_add_ps(b0r, b2r));
+                _mm256_storeu_ps(i0 + i, _mm256_add_ps(b0i, b2i));
+                _mm256_storeu_ps(r2 + i, _mm256_sub_ps(b0r, b2r));
+                _mm256_storeu_ps(i2 + i, _mm256_sub_ps(b0i, b2i));
+                _mm256_storeu_ps(r1 + i, _mm256_add_ps(b1r, c3r));
+                _mm256_storeu_ps(i1 + i, _mm256_add_ps(b1i, c3i));
+                _mm256_storeu_ps(r3 + i, _mm256_sub_ps(b1r, c3r));
+                _mm256_storeu_ps(i3 + i, _mm256_sub_ps(b1i, c3i));
+            }
+        } else {
+            for (int i = 0; i < length; i++) {
+                float a1r = r1[i], a1i = i1[i], a3r = r3[i], a3i = i3[i];
+                Rotate<inverse>(a1r, a1i, innerReal[i], innerImaginary[i]);
+                Rotate<inverse>(a3r, a3i, innerReal[i], innerImaginary[i]);
+                float b0r = r0[i] + a1r, b0i = i0[i] + a1i, b1r = r0[i] - a1r, b1i = i0[i] - a1i,
+                    b2r = r2[i] + a3r, b2i = i2[i] + a3i, b3r = r2[i] - a3r, b3i = i2[i] - a3i;
+                Rotate<inverse>(b2r, b2i, outerReal[i], outerImaginary[i]);
+                Rotate<inverse>(b3r, b3i, outerReal[i], outerImaginary[i]);
+                float c3r = inverse ? -b3i : b3i, c3i = inverse ? b3r : -b3r;
+                r0[i] = b0r + b2r;
+                i0[i] = b0i + b2i;
+                r2[i] = b0r - b2r;
+                i2[i] = b0i - b2i;
+                r1[i] = b1r + c3r;
+                i1[i] = b1i + c3i;
+                r3[i] = b1r - c3r;
+                i3[i] = b1i - c3i;
+            }
+        }
+    }
+}
+
+// Single radix-2 stage merging the two halves of the signal, used when the number of stages is odd.
+template<bool inverse>
+static void Radix2FinalStage(float *real, float *imaginary, int sampleCount, const SplitComplexArray *twiddles) {
+    int length = sampleCount >> 1;
+    const float *twiddleReal = twiddles->real + length - 1, *twiddleImaginary = twiddles->imaginary + length - 1;
+    float *r0 = real, *r1 = real + length, *i0 = imaginary, *i1 = imaginary + length;
+    int i = 0;
+    for (int end = length - 7; i < end; i += 8) {
+        __m256 oddReal = _mm256_loadu_ps(r1 + i), oddImaginary = _mm256_loadu_ps(i1 + i),
+            evenReal = _mm256_loadu_ps(r0 + i), evenImaginary = _mm256_loadu_ps(i0 + i);
+        Rotate<inverse>(oddReal, oddImaginary, _mm256_loadu_ps(twiddleReal + i), _mm256_loadu_ps(twiddleImaginary + i));
+        _mm256_storeu_ps(r0 + i, _mm256_add_ps(evenReal, oddReal));
+        _mm256_storeu_ps(i0 + i, _mm256_add_ps(evenImaginary, oddImaginary));
+        _mm256_storeu_ps(r1 + i, _mm256_sub_ps(evenReal, oddReal));
+        _mm256_storeu_ps(i1 + i, _mm256_sub_ps(evenImaginary, oddImaginary));
+    }
+    for (; i < length; i++) {
+        float oddReal = r1[i], oddImaginary = i1[i];
+        Rotate<inverse>(oddReal, oddImaginary, twiddleReal[i], twiddleImaginary[i]);
+        r1[i] = r0[i] - oddReal;
+        i1[i] = i0[i] - oddImaginary;
+        r0[i] += oddReal;
+        i0[i] += oddImaginary;
+    }
+}
+
+int DefaultLeafSize(const int sampleCount) {
+    if (sampleCount < 8) {
+        return 1;
+    }
+    if (sampleCount <= 64) {
+        return sampleCount;
+    }
+    return Log2Int(sampleCount) & 1 ? 32 : 64;
+}
+
+template<bool inverse>
+static void ProcessButterflies(float *real, float *imaginary, int sampleCount, const FFTPlan *plan) {
+    int length = sampleCount == plan->size() ? plan->leafSize : DefaultLeafSize(sampleCount);
+    switch (length) {
+    case 8:
+        ProcessCodelets<8, inverse>(real, imaginary, sampleCount, plan->twiddles);
+        break;
+    case 16:
+        ProcessCodelets<16, inverse>(real, imaginary, sampleCount, plan->twiddles);
+        break;
+    case 32:
+        ProcessCodelets<32, inverse>(real, imaginary, sampleCount, plan->twiddles);
+        break;
+    case 64:
+        ProcessCodelets<64, inverse>(real, imaginary, sampleCount, plan->twiddles);
+        break;
+    }
+    for (; length * 4 <= sampleCount; length <<= 2) {
+        Radix4Stage<inverse>(real, imaginary, sampleCount, length, plan->twiddles);
+    }
+    if (length < sampleCount) {
+        Radix2FinalStage<inverse>(real, imaginary, sampleCount, plan->twiddles);
+    }
+}
+
+void ProcessButterflies(float *real, float *imaginary, int sampleCount, const FFTPlan *plan, bool inverse) {
+    if (inverse) {
+        ProcessButterflies<true>(real, imaginary, sampleCount, plan);
+    } else {
+        ProcessButterflies<false>(real, imaginary, sampleCount, plan);
+    }
+}
@@ -0,0 +1,81 @@
+#ifndef FFTKERNELS_H
+#define FFTKERNELS_H
+
+#include <immintrin.h>
+
+#include "complex.h"
+#include "fftPlan.h"
+#include "qmath.h"
+
+// Internal building blocks of the FFT engine, working on split (structure of arrays) complex signals.
+
+/// Copy interleaved complex samples to split arrays in bit reversed index order.
+void GatherBitReversed(const Complex *source, float *real, float *imaginary, int sampleCount, const FFTPlan *plan);
+
+/// Copy the even samples of a real signal to the real, the odd samples to the imaginary array in the bit reversed order
+/// of the half-size complex signal they form.
+void GatherRealBitReversed(const float *source, float *real, float *imaginary, int halfCount, const FFTPlan *plan);
+
+/// Reorder split samples to bit reversed index order in-place.
+void PermuteBitReversed(float *real, float *imaginary, int sampleCount, const FFTPlan *plan);
+
+/// Size of the codelets a power of two transform starts with when it's not tuned: the largest one that leaves an even number
+/// of stages for the radix-4 butterflies, to skip the slower radix-2 stage. 1 means no codelets are used.
+int DefaultLeafSize(const int sampleCount);
+
+/// Perform all butterfly stages of an in-place transform on bit reversed split samples. Transforms of the plan's size start
+/// with the plan's leaf size, smaller ones with the default.
+void ProcessButterflies(float *real, float *imaginary, int sampleCount, const FFTPlan *plan, bool inverse);
+
+/// The bit reversed index of i in a transform of sampleCount samples is plan->reversal[i] >> ReversalShift(...).
+inline int ReversalShift(const int sampleCount, const FFTPlan *plan) {
+    return Log2Int(plan->size()) - Log2Int(sampleCount);
+}
+
+/// Multiply a complex number by a twiddle factor, or its conjugate for the inverse transform.
+template<bool inverse>
+inline void Rotate(float &real, float &imaginary, const float twiddleReal, const float twiddleImaginary) {
+    float oldReal = real;
+    if (inverse) {
+        real = oldReal * twiddleReal + imaginary * twiddleImaginary;
+        imaginary = imaginary * twiddleReal - oldReal * twiddleImaginary;
+    } else {
+        real = oldReal * twiddleReal - imaginary * twiddleImaginary;
+        imaginary = oldReal * twiddleImaginary + imaginary * twiddleReal;
+    }
+}
+
+/// Multiply 8 split complex numbers by twiddle factors, or their conjugates for the inverse transform.
+template<bool inverse>
+inline void Rotate(__m256 &real, __m256 &imaginary, const __m256 twiddleReal, const __m256 twiddleImaginary) {
+    __m256 oldReal = real;
+    if (inverse) {
+        real = _mm256_add_ps(_mm256_mul_ps(oldReal, twiddleReal), _mm256_mul_ps(imaginary, twiddleImaginary));
+        imaginary = _mm256_sub_ps(_mm256_mul_ps(imaginary, twiddleReal), _mm256_mul_ps(oldReal, twiddleImaginary));
+    } else {
+        real = _mm256_sub_ps(_mm256_mul_ps(oldReal, twiddleReal), _mm256_mul_ps(imaginary, twiddleImaginary));
+        imaginary = _mm256_add_ps(_mm256_mul_ps(oldReal, twiddleImaginary), _mm256_mul_ps(imaginary, twiddleReal));
+    }
+}
+
+/// Transpose an 8x8 matrix of floats held in 8 registers.
+inline void Transpose8x8(__m256 *rows) {
+    __m256 t0 = _mm256_unpacklo_ps(rows[0], rows[1]), t1 = _mm256_unpackhi_ps(rows[0], rows[1]),
+        t2 = _mm256_unpacklo_ps(rows[2], rows[3]), t3 = _mm256_unpackhi_ps(rows[2], rows[3]),
+        t4 = _mm256_unpacklo_ps(rows[4], rows[5]), t5 = _mm256_unpackhi_ps(rows[4], rows[5]),
+        t6 = _mm256_unpacklo_ps(rows[6], rows[7]), t7 = _mm256_unpackhi_ps(rows[6], rows[7]);
+    __m256 s0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0)), s1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2)),
+        s2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0)), s3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2)),
+        s4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0)), s5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2)),
+        s6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0)), s7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+    rows[0] = _mm256_permute2f128_ps(s0, s4, 0x20);
+    rows[1] = _mm256_permute2f128_ps(s1, s5, 0x20);
+    rows[2] = _mm256_permute2f128_ps(s2, s6, 0x20);
+    rows[3] = _mm256_permute2f128_ps(s3, s7, 0x20);
+    rows[4] = _mm256_permute2f128_ps(s0, s4, 0x31);
+    rows[5] = _mm256_permute2f128_ps(s1, s5, 0x31);
+    rows[6] = _mm256_permute2f128_ps(s2, s6, 0x31);
+    rows[7] = _mm256_permute2f128_ps(s3, s7, 0x31);
+}
+
+#endif // FFTKERNELS_H
@@ -0,0 +1,231 @@
+#include <string.h>
+
+#include "fftKernels.h"
+#include "fftMixedRadix.h"
+
+// Arithmetic used by the butterflies, so they can be written once for single values and SIMD registers.
+static inline float Add(const float a, const float b) { return a + b; }
+static inline float Sub(const float a, const float b) { return a - b; }
+static inline float Scale(const float a, const float b) { return a * b; }
+static inline __m256 Add(const __m256 a, const __m256 b) { return _mm256_add_ps(a, b); }
+static inline __m256 Sub(const __m256 a, const __m256 b) { return _mm256_sub_ps(a, b); }
+static inline __m256 Scale(const __m256 a, const float b) { return _mm256_mul_ps(a, _mm256_set1_ps(b)); }
+
+// Get base + i * u and base - i * u for the inverse, or base - i * u and base + i * u for the forward transform.
+template<bool inverse, typename T>
+static inline void CrossI(const T baseReal, const T baseImaginary, const T uReal, const T uImaginary,
+    T &plusReal, T &plusImaginary, T &minusReal, T &minusImaginary) {
+    if (inverse) {
+        plusReal = Sub(baseReal, uImaginary);
+        plusImaginary = Add(baseImaginary, uReal);
+        minusReal = Add(baseReal, uImaginary);
+        minusImaginary = Sub(baseImaginary, uReal);
+    } else {
+        plusReal = Add(baseReal, uImaginary);
+        plusImaginary = Sub(baseImaginary, uReal);
+        minusReal = Sub(baseReal, uImaginary);
+        minusImaginary = Add(baseImaginary, uReal);
+    }
+}
+
+// In-place DFT of 3 or 5 elements.
+template<int radix, bool inverse, typename T>
+static inline void Butterfly(T *real, T *imaginary) {
+    if (radix == 3) {
+        const float sin60 = .86602540378443865f;
+        T sumReal = Add(real[1], real[2]), sumImaginary = Add(imaginary[1], imaginary[2]),
+            baseReal = Sub(real[0], Scale(sumReal, .5f)), baseImaginary = Sub(imaginary[0], Scale(sumImaginary, .5f)),
+            diffReal = Scale(Sub(real[1], real[2]), sin60), diffImaginary = Scale(Sub(imaginary[1], imaginary[2]), sin60);
+        real[0] = Add(real[0], sumReal);
+        imaginary[0] = Add(imaginary[0], sumImaginary);
+        CrossI<inverse>(baseReal, baseImaginary, diffReal, diffImaginary, real[1], imaginary[1], real[2], imaginary[2]);
+    } else {
+        const float cos1 = .30901699437494742f, cos2 = -.80901699437494742f,
+            sin1 = .95105651629515357f, sin2 = .58778525229247313f;
+        T sum14Real = Add(real[1], real[4]), sum14Imaginary = Add(imaginary[1], imaginary[4]),
+            sum23Real = Add(real[2], real[3]), sum23Imaginary = Add(imaginary[2], imaginary[3]),
+            diff14Real = Sub(real[1], real[4]), diff14Imaginary = Sub(imaginary[1], imaginary[4]),
+            diff23Real = Sub(real[2], real[3]), diff23Imaginary = Sub(imaginary[2], imaginary[3]);
+        T base1Real = Add(real[0], Add(Scale(sum14Real, cos1), Scale(sum23Real, cos2))),
+            base1Imaginary = Add(imaginary[0], Add(Scale(sum14Imaginary, cos1), Scale(sum23Imaginary, cos2))),
+            base2Real = Add(real[0], Add(Scale(sum14Real, cos2), Scale(sum23Real, cos1))),
+            base2Imaginary = Add(imaginary[0], Add(Scale(sum14Imaginary, cos2), Scale(sum23Imaginary, cos1))),
+            u1Real = Add(Scale(diff14Real, sin1), Scale(diff23Real, sin2)),
+            u1Imaginary = Add(Scale(diff14Imaginary, sin1), Scale(diff23Imaginary, sin2)),
+            u2Real = Sub(Scale(diff14Real, sin2), Scale(diff23Real, sin1)),
+            u2Imaginary = Sub(Scale(diff14Imaginary, sin2), Scale(diff23Imaginary, sin1));
+        real[0] = Add(real[0], Add(sum14Real, sum23Real));
+        imaginary[0] = Add(imaginary[0], Add(sum14Imaginary, sum23Imaginary));
+        CrossI<inverse>(base1Real, base1Imaginary, u1Real, u1Imaginary, real[1], imaginary[1], real[4], imaginary[4]);
+        CrossI<inverse>(base2Real, base2Imaginary, u2Real, u2Imaginary, real[2], imaginary[2], real[3], imaginary[3]);
+    }
+}
+
+// A self-sorting (Stockham) decimation in frequency stage, transforming stride interleaved sequences of n samples from
+// the source to the target. Element q of sequence k is at k + stride * q. After the stage, sequence k + stride * j of
+// the target holds the n / radix samples of the sub-transform j. The last stage (n == radix) can be done in-place.
+// If outer twiddles are given, source element t of sequence k is first rotated by outer[(t - 1) * stride + k] for t > 0.
+template<int radix, bool inverse>
+static void StockhamStage(const float *sourceReal, const float *sourceImaginary, float *targetReal, float *targetImaginary,
+    int n, int stride, const float *twiddleReal, const float *twiddleImaginary, const float *outerReal, const float *outerImaginary) {
+    int m = n / radix;
+    for (int q = 0; q < m; q++) {
+        const float *stageReal = twiddleReal + q * (radix - 1), *stageImaginary = twiddleImaginary + q * (radix - 1);
+        const float *inReal = sourceReal + stride * q, *inImaginary = sourceImaginary + stride * q;
+        float *outReal = targetReal + stride * radix * q, *outImaginary = targetImaginary + stride * radix * q;
+        int k = 0;
+        for (int end = stride - 7; k < end; k += 8) {
+            __m256 real[radix], imaginary[radix];
+            for (int r = 0; r < radix; r++) {
+                real[r] = _mm256_loadu_ps(inReal + k + r * m * stride);
+                imaginary[r] = _mm256_loadu_ps(inImaginary + k + r * m * stride);
+                int t = q + r * m;
+                if (outerReal && t) {
+                    int outer = (t - 1) * stride + k;
+                    Rotate<inverse>(real[r], imaginary[r], _mm256_loadu_ps(outerReal + outer), _mm256_loadu_ps(outerImaginary + outer));
+                }
+            }
+            Butterfly<radix, inverse>(real, imaginary);
+            _mm256_storeu_ps(outReal + k, real[0]);
+            _mm256_storeu_ps(outImaginary + k, imaginary[0]);
+            for (int j = 1; j < radix; j++) {
+                Rotate<inverse>(real[j], imaginary[j], _mm256_set1_ps(stageReal[j - 1]), _mm256_set1_ps(stageImaginary[j - 1]));
+                _mm256_storeu_ps(outReal + k + j * stride, real[j]);
+                _mm256_storeu_ps(outImaginary + k + j * stride, imaginary[j]);
+            }
+        }
+        for (; k < stride; k++) {
+            float real[radix], imaginary[radix];
+            for (int r = 0; r < radix; r++) {
+                real[r] = inReal[k + r * m * stride];
+                imaginary[r] = inImaginary[k + r * m * stride];
+                int t = q + r * m;
+                if (outerReal && t) {
+                    int outer = (t - 1) * stride + k;
+                    Rotate<inverse>(real[r], imaginary[r], outerReal[outer], outerImaginary[outer]);
+                }
+            }
+            Butterfly<radix, inverse>(real, imaginary);
+            outReal[k] = real[0];
+            outImaginary[k] = imaginary[0];
+            for (int j = 1; j < radix; j++) {
+                Rotate<inverse>(real[j], imaginary[j], stageReal[j - 1], stageImaginary[j - 1]);
+                outReal[k + j * stride] = real[j];
+                outImaginary[k + j * stride] = imaginary[j];
+            }
+        }
+    }
+}
+
+// N = O * M, where M is a power of two: the M-point transforms of the O subsequences x[O * m + t] are rotated by
+// exp(-2 * pi * i * t * k / N), then the O-point transforms of every k are done by radix-3/5 Stockham stages at stride M.
+template<bool inverse>
+static void ProcessMixedRadix(const Complex *source, float *real, float *imaginary, const FFTPlan *plan, SplitComplexArray *scratch) {
+    const FFTPlan *powerOfTwo = plan->powerOfTwo;
+    int fftSize = plan->size(), blockSize = powerOfTwo ? powerOfTwo->size() : 1, oddSize = fftSize / blockSize;
+    float *blockReal = scratch->real, *blockImaginary = scratch->imaginary;
+    const int *reversal = powerOfTwo ? powerOfTwo->reversal : nullptr;
+    for (int target = 0; target < blockSize; target++) { // Sequential writes are faster than sequential reads here
+        int m = reversal ? reversal[target] : target;
+        if (source) {
+            const Complex *subsequences = source + oddSize * m;
+            for (int t = 0, i = target; t < oddSize; t++, i += blockSize) {
+                blockReal[i] = subsequences[t].real;
+                blockImaginary[i] = subsequences[t].imaginary;
+            }
+        } else {
+            const float *subsequenceReal = real + oddSize * m, *subsequenceImaginary = imaginary + oddSize * m;
+            for (int t = 0, i = target; t < oddSize; t++, i += blockSize) {
+                blockReal[i] = subsequenceReal[t];
+                blockImaginary[i] = subsequenceImaginary[t];
+            }
+        }
+    }
+    const float *outerReal = nullptr, *outerImaginary = nullptr;
+    if (powerOfTwo) {
+        for (int t = 0; t < oddSize; t++) {
+            ProcessButterflies(blockReal + t * blockSize, blockImaginary + t * blockSize, blockSize, powerOfTwo, inverse);
+        }
+        outerReal = plan->outerTwiddles->real;
+        outerImaginary = plan->outerTwiddles->imaginary;
+    }
+
+    // Ping-pong between the arrays, and end in the output with the last stage, which can be done in-place
+    float *sourceReal = blockReal, *sourceImaginary = blockImaginary;
+    const float *twiddleReal = plan->twiddles->real, *twiddleImaginary = plan->twiddles->imaginary;
+    int n = oddSize, stride = blockSize;
+    for (int radix : plan->radices) {
+        bool last = n == radix;
+        float *targetReal = last || sourceReal == blockReal ? real : blockReal,
+            *targetImaginary = last || sourceImaginary == blockImaginary ? imaginary : blockImaginary;
+        if (radix == 3) {
+            StockhamStage<3, inverse>(sourceReal, sourceImaginary, targetReal, targetImaginary, n, stride,
+                twiddleReal, twiddleImaginary, outerReal, outerImaginary);
+        } else {
+            StockhamStage<5, inverse>(sourceReal, sourceImaginary, targetReal, targetImaginary, n, stride,
+                twiddleReal, twiddleImaginary, outerReal, outerImaginary);
+        }
+        outerReal = outerImaginary = nullptr; // Only the first stage reads the subsequences
+        int m = n / radix;
+        twiddleReal += m * (radix - 1);
+        twiddleImaginary += m * (radix - 1);
+        n = m;
+        stride *= radix;
+        sourceReal = targetReal;
+        sourceImaginary = targetImaginary;
+    }
+}
+
+// Chirp-z transform: X[k] = chirp[k] * sum(x[n] * chirp[n] * conj(chirp[k - n])), where the sum is a convolution
+// done with power of two transforms. The inverse is the conjugate of the forward transform of the conjugate.
+static void ProcessBluestein(const Complex *source, float *real, float *imaginary, const FFTPlan *plan, bool inverse) {
+    int fftSize = plan->size(), convolutionSize = plan->convolution->size();
+    const float *chirpReal = plan->chirp->real, *chirpImaginary = plan->chirp->imaginary;
+    for (int i = 0; i < fftSize; i++) {
+        float sampleReal = source ? source[i].real : real[i], sampleImaginary = source ? source[i].imaginary : imaginary[i];
+        if (inverse) {
+            sampleImaginary = -sampleImaginary;
+        }
+        real[i] = sampleReal * chirpReal[i] - sampleImaginary * chirpImaginary[i];
+        imaginary[i] = sampleReal * chirpImaginary[i] + sampleImaginary * chirpReal[i];
+    }
+    memset(real + fftSize, 0, (convolutionSize - fftSize) * sizeof(float));
+    memset(imaginary + fftSize, 0, (convolutionSize - fftSize) * sizeof(float));
+
+    PermuteBitReversed(real, imaginary, convolutionSize, plan->convolution);
+    ProcessButterflies(real, imaginary, convolutionSize, plan->convolution, false);
+    Convolve(real, imaginary, plan->chirpSpectrum->real, plan->chirpSpectrum->imaginary, convolutionSize);
+    PermuteBitReversed(real, imaginary, convolutionSize, plan->convolution);
+    ProcessButterflies(real, imaginary, convolutionSize, plan->convolution, true);
+
+    for (int i = 0; i < fftSize; i++) {
+        float newReal = real[i] * chirpReal[i] - imaginary[i] * chirpImaginary[i],
+            newImaginary = real[i] * chirpImaginary[i] + imaginary[i] * chirpReal[i];
+        real[i] = newReal;
+        imaginary[i] = inverse ? -newImaginary : newImaginary;
+    }
+}
+
+void ProcessNaturalOrder(const Complex *source, float *real, float *imaginary, const FFTPlan *plan, SplitComplexArray *scratch,
+    bool inverse) {
+    switch (plan->kind) {
+    case FFTPlanKind::PowerOfTwo:
+        if (source) {
+            GatherBitReversed(source, real, imaginary, plan->size(), plan);
+        } else {
+            PermuteBitReversed(real, imaginary, plan->size(), plan);
+        }
+        ProcessButterflies(real, imaginary, plan->size(), plan, inverse);
+        break;
+    case FFTPlanKind::MixedRadix:
+        if (inverse) {
+            ProcessMixedRadix<true>(source, real, imaginary, plan, scratch);
+        } else {
+            ProcessMixedRadix<false>(source, real, imaginary, plan, scratch);
+        }
+        break;
+    default:
+        ProcessBluestein(source, real, imaginary, plan, inverse);
+        break;
+    }
+}
@@ -0,0 +1,15 @@
+#ifndef FFTMIXEDRADIX_H
+#define FFTMIXEDRADIX_H
+
+#include "fftPlan.h"
+#include "splitComplexArray.h"
+
+// Transforms of sizes that are not powers of two, working on split (structure of arrays) complex signals in natural order.
+
+/// Transform plan->size() interleaved source samples, or if the source is null, the split samples themselves, to split
+/// arrays in natural order with any kind of plan. The arrays have to hold plan->workLength elements, and the scratch has
+/// to hold plan->scratchLength, or can be null if that's 0. The inverse transform is not normalized.
+void ProcessNaturalOrder(const Complex *source, float *real, float *imaginary, const FFTPlan *plan, SplitComplexArray *scratch,
+    bool inverse);
+
+#endif // FFTMIXEDRADIX_H
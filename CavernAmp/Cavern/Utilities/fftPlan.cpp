@@ -0,0 +1,230 @@
+#include <math.h>
+#include <mutex>
+#include <unordered_map>
+
+#include "fftFourStep.h"
+#include "fftKernels.h"
+#include "fftPlan.h"
+#include "fftPlanner.h"
+#include "qmath.h"
+
+// Every existing plan by size.
+static std::unordered_map<int, FFTPlan*> registry;
+// Guards the registry and the reference counts. Recursive, as plans acquire their sub-plans while being created.
+static std::recursive_mutex registryLock;
+
+// Split the size to its largest power of two factor and the radix-3 and 5 stages of the rest,
+// or return false if it has other prime factors.
+static bool FactorMixedRadix(int fftSize, int &powerOfTwo, std::vector<int> &radices) {
+    powerOfTwo = fftSize & -fftSize;
+    fftSize /= powerOfTwo;
+    for (; fftSize % 5 == 0; fftSize /= 5) {
+        radices.push_back(5);
+    }
+    for (; fftSize % 3 == 0; fftSize /= 3) {
+        radices.push_back(3);
+    }
+    return fftSize == 1;
+}
+
+FFTPlan::FFTPlan(const int fftSize) : fftSize(fftSize), references(0), twiddles(nullptr), reversal(nullptr),
+    leafSize(1), powerOfTwo(nullptr), outerTwiddles(nullptr), convolution(nullptr), chirp(nullptr),
+    chirpSpectrum(nullptr), half(nullptr), realTwiddles(nullptr), workLength(fftSize), scratchLength(0) {
+    if (!(fftSize & (fftSize - 1))) {
+        kind = FFTPlanKind::PowerOfTwo;
+        twiddles = new SplitComplexArray(fftSize - 1);
+        for (int length = 1; length < fftSize; length <<= 1) {
+            float *stageReal = twiddles->real + length - 1, *stageImaginary = twiddles->imaginary + length - 1;
+            double step = -M_PI / length;
+            for (int i = 0; i < length; i++) {
+                double rotation = i * step;
+                stageReal[i] = (float)cos(rotation);
+                stageImaginary[i] = (float)sin(rotation);
+            }
+        }
+
+        int bits = Log2Int(fftSize);
+        reversal = new int[fftSize];
+        reversal[0] = 0;
+        for (int i = 1; i < fftSize; i++) {
+            reversal[i] = (reversal[i >> 1] >> 1) | ((i & 1) << (bits - 1));
+        }
+        leafSize = FFTPlanner::LeafSize(this);
+        if (fftSize >= FourStepMinimum()) {
+            scratchLength = FourStepScratchLength(fftSize);
+            workLength = FourStepWorkLength(fftSize);
+        }
+        return;
+    }
+
+    int powerOfTwoSize;
+    if (FactorMixedRadix(fftSize, powerOfTwoSize, radices)) {
+        kind = FFTPlanKind::MixedRadix;
+        int oddSize = fftSize / powerOfTwoSize, twiddleCount = 0;
+        for (int stage = 0, n = oddSize; stage < (int)radices.size(); n /= radices[stage++]) {
+            twiddleCount += n / radices[stage] * (radices[stage] - 1);
+        }
+        twiddles = new SplitComplexArray(twiddleCount);
+        float *stageReal = twiddles->real, *stageImaginary = twiddles->imaginary;
+        for (int stage = 0, n = oddSize; stage < (int)radices.size(); n /= radices[stage++]) {
+            int radix = radices[stage], m = n / radix;
+            for (int q = 0; q < m; q++) {
+                for (int j = 1; j < radix; j++) {
+                    double rotation = -2 * M_PI * j * q / n;
+                    *stageReal++ = (float)cos(rotation);
+                    *stageImaginary++ = (float)sin(rotation);
+                }
+            }
+        }
+
+        if (powerOfTwoSize > 1) {
+            powerOfTwo = Acquire(powerOfTwoSize);
+            outerTwiddles = new SplitComplexArray((oddSize - 1) * powerOfTwoSize);
+            for (int t = 1; t < oddSize; t++) {
+                float *blockReal = outerTwiddles->real + (t - 1) * powerOfTwoSize,
+                    *blockImaginary = outerTwiddles->imaginary + (t - 1) * powerOfTwoSize;
+                for (int k = 0; k < powerOfTwoSize; k++) {
+                    double rotation = -2 * M_PI * (double)(((long long)t * k) % fftSize) / fftSize;
+                    blockReal[k] = (float)cos(rotation);
+                    blockImaginary[k] = (float)sin(rotation);
+                }
+            }
+        }
+        scratchLength = fftSize;
+    } else {
+        kind = FFTPlanKind::Bluestein;
+        radices.clear(); // Factorization stopped at a prime greater than 5
+        int convolutionSize = 2 << Log2Ceil(fftSize); // At least 2 * fftSize - 1 for a linear convolution
+        convolution = Acquire(convolutionSize);
+        chirp = new SplitComplexArray(fftSize);
+        for (int i = 0; i < fftSize; i++) {
+            double rotation = -M_PI * (double)(((long long)i * i) % (2LL * fftSize)) / fftSize;
+            chirp->real[i] = (float)cos(rotation);
+            chirp->imaginary[i] = (float)sin(rotation);
+        }
+
+        chirpSpectrum = new SplitComplexArray(convolutionSize);
+        chirpSpectrum->Clear();
+        float multiplier = 1.f / convolutionSize;
+        for (int i = 0; i < fftSize; i++) {
+            chirpSpectrum->real[i] = chirp->real[i] * multiplier;
+            chirpSpectrum->imaginary[i] = -chirp->imaginary[i] * multiplier;
+        }
+        for (int i = 1; i < fftSize; i++) {
+            chirpSpectrum->real[convolutionSize - i] = chirpSpectrum->real[i];
+            chirpSpectrum->imaginary[convolutionSize - i] = chirpSpectrum->imaginary[i];
+        }
+        PermuteBitReversed(chirpSpectrum->real, chirpSpectrum->imaginary, convolutionSize, convolution);
+        ProcessButterflies(chirpSpectrum->real, chirpSpectrum->imaginary, convolutionSize, convolution, false);
+        workLength = convolutionSize;
+    }
+
+    if (!(fftSize & 1)) {
+        half = Acquire(fftSize >> 1);
+        int halfLength = fftSize >> 1;
+        realTwiddles = new SplitComplexArray(halfLength);
+        for (int i = 0; i < halfLength; i++) {
+            double rotation = -2 * M_PI * i / fftSize;
+            realTwiddles->real[i] = (float)cos(rotation);
+            realTwiddles->imaginary[i] = (float)sin(rotation);
+        }
+        workLength = workLength > half->workLength ? workLength : half->workLength;
+        scratchLength = scratchLength > half->scratchLength ? scratchLength : half->scratchLength;
+    }
+}
+
+FFTPlan::~FFTPlan() {
+    delete twiddles;
+    delete[] reversal;
+    delete chirp;
+    delete chirpSpectrum;
+    delete realTwiddles;
+    delete outerTwiddles;
+    if (powerOfTwo) {
+        Release(powerOfTwo);
+    }
+    if (convolution) {
+        Release(convolution);
+    }
+    if (half) {
+        Release(half);
+    }
+}
+
+bool FFTPlan::Supports(const int sampleCount) const {
+    if (kind == FFTPlanKind::PowerOfTwo) {
+        return sampleCount <= fftSize && !(sampleCount & (sampleCount - 1));
+    }
+    return sampleCount == fftSize;
+}
+
+const FFTPlan* FFTPlan::Acquire(const int fftSize) {
+    std::lock_guard<std::recursive_mutex> lock(registryLock);
+    auto existing = registry.find(fftSize);
+    if (existing != registry.end()) {
+        existing->second->references++;
+        return existing->second;
+    }
+    FFTPlan *plan = new FFTPlan(fftSize);
+    plan->references = 1;
+    registry[fftSize] = plan;
+    return plan;
+}
+
+const FFTPlan* FFTPlan::Acquire(const FFTPlan *plan) {
+    std::lock_guard<std::recursive_mutex> lock(registryLock);
+    const_cast<FFTPlan*>(plan)->references++;
+    return plan;
+}
+
+void FFTPlan::Release(const FFTPlan *plan) {
+    std::lock_guard<std::recursive_mutex> lock(registryLock);
+    FFTPlan *mutablePlan = const_cast<FFTPlan*>(plan);
+    if (--mutablePlan->references == 0) {
+        registry.erase(plan->fftSize);
+        delete mutablePlan;
+    }
+}
+
+double FFTPlan::EstimateCost(const int fftSize) {
+    if (fftSize <= 1) {
+        return 0;
+    }
+    if (!(fftSize & (fftSize - 1))) {
+        return (double)fftSize * Log2Int(fftSize);
+    }
+
+    int powerOfTwoSize;
+    std::vector<int> radices;
+    if (FactorMixedRadix(fftSize, powerOfTwoSize, radices)) {
+        // The power of two transforms, and the radix-3/5 stages with the outer twiddles, relative to one bit of a power of two
+        double cost = Log2Int(powerOfTwoSize);
+        for (int radix : radices) {
+            cost += radix == 3 ? 2.4 : 3.3;
+        }
+        return fftSize * cost;
+    }
+    int convolutionSize = 2 << Log2Ceil(fftSize);
+    return 2 * EstimateCost(convolutionSize) + 4. * convolutionSize;
+}
+
+int FFTPlan::PaddedLength(const int minimumLength) {
+    if (minimumLength <= 1) {
+        return 1;
+    }
+    int best = 1 << Log2Ceil(minimumLength);
+    if (best < mixedRadixMinimum) {
+        return best;
+    }
+    double bestCost = EstimateCost(best);
+    const int factors[] = { 3, 5 };
+    for (int factor : factors) {
+        int candidate = factor << Log2Ceil((minimumLength + factor - 1) / factor);
+        double cost = EstimateCost(candidate);
+        if (cost < bestCost) {
+            best = candidate;
+            bestCost = cost;
+        }
+    }
+    return best;
+}
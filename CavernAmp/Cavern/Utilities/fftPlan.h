@@ -0,0 +1,88 @@
+#ifndef FFTPLAN_H
+#define FFTPLAN_H
+
+#include <vector>
+
+#include "splitComplexArray.h"
+
+// Algorithm used by a plan, chosen by the factors of its size.
+enum class FFTPlanKind {
+    // Radix-4/2 butterflies on bit reversed samples.
+    PowerOfTwo,
+    // Power of two transforms of the interleaved subsequences, merged by self-sorting radix-3/5 stages,
+    // for sizes with no other prime factors.
+    MixedRadix,
+    // Chirp-z transform of any other size through a power of two convolution.
+    Bluestein
+};
+
+/// Immutable precalculated constants for a given FFT size. A single plan is shared between every FFTCache of the same size,
+/// and as it's never written after creation, any number of threads can use it at the same time.
+class FFTPlan {
+    int fftSize;
+    // Number of caches using this plan, guarded by the registry lock.
+    int references;
+
+    FFTPlan(const int fftSize);
+    ~FFTPlan();
+
+public:
+    // Below this size, padded lengths are always powers of two, as the mixed radix stages can't win there.
+    static const int mixedRadixMinimum = 4096;
+
+    FFTPlanKind kind;
+    // For powers of two, twiddle factors laid out per stage: the stage merging transforms of length L into length 2L reads
+    // L consecutive twiddles starting from index L - 1. The total length is fftSize - 1.
+    // For mixed radix plans, the twiddles of each radix-3/5 stage follow each other: a stage of radix p, transforming
+    // length n, stores exp(-2 * pi * i * j * q / n) for j in [1, p) at index q * (p - 1) + j - 1, for each q < n / p.
+    SplitComplexArray *twiddles;
+    // Bit reversal permutation of the indices for the creation size, only for powers of two. For a smaller transform of
+    // size / 2^k, the permutation is the same shifted right by k bits.
+    int *reversal;
+    // Size of the codelets a power of two transform of the plan's size starts with, chosen by the FFTPlanner.
+    // 1 means the generic butterflies do every stage.
+    int leafSize;
+    // Radix of each radix-3/5 stage of a mixed radix plan in processing order.
+    std::vector<int> radices;
+    // Plan of the largest power of two factor of a mixed radix plan, null if the size is odd.
+    const FFTPlan *powerOfTwo;
+    // Twiddles exp(-2 * pi * i * t * k / fftSize) of a mixed radix plan that rotate the transform of subsequence t at
+    // index (t - 1) * M + k, where M is the size of the power of two factor. Null if the size is odd.
+    SplitComplexArray *outerTwiddles;
+    // Power of two plan of the convolution in a Bluestein plan.
+    const FFTPlan *convolution;
+    // Bluestein chirp exp(-pi * i * n^2 / fftSize) for n < fftSize.
+    SplitComplexArray *chirp;
+    // Transform of the conjugate chirp wrapped to the convolution size, prescaled by its inverse.
+    SplitComplexArray *chirpSpectrum;
+    // Plan of fftSize / 2 that performs real transforms of even sizes that are not powers of two.
+    const FFTPlan *half;
+    // Twiddles exp(-2 * pi * i * k / fftSize) for k < fftSize / 2 for the real transforms of the half plan.
+    SplitComplexArray *realTwiddles;
+    // Minimum length of the work array for any transform with this plan.
+    int workLength;
+    // Minimum length of the scratch array for any transform with this plan, 0 if not needed. For powers of two, it's only
+    // needed for four-step transforms.
+    int scratchLength;
+
+    // Get the creation size of the plan.
+    int size() const { return fftSize; }
+    // Check if a transform of the given size can be performed by this plan. Power of two plans also support all smaller
+    // powers of two, others only their own size.
+    bool Supports(const int sampleCount) const;
+
+    // Get the shared plan of an FFT size, or create it if it doesn't exist. Every acquired plan shall be released.
+    static const FFTPlan* Acquire(const int fftSize);
+    // Get another reference to an already acquired plan.
+    static const FFTPlan* Acquire(const FFTPlan *plan);
+    // Release a reference to a plan, which is freed when the last reference is released.
+    static void Release(const FFTPlan *plan);
+
+    // Relative cost of transforming the given size, comparable between sizes.
+    static double EstimateCost(const int fftSize);
+    // The cheapest transform size that holds at least minimumLength samples out of 2^n, 3 * 2^n, and 5 * 2^n.
+    // Below mixedRadixMinimum, this is always a power of two.
+    static int PaddedLength(const int minimumLength);
+};
+
+#endif // FFTPLAN_H
@@ -0,0 +1,200 @@
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#include "fftKernels.h"
+#include "fftPlanner.h"
+#include "splitComplexArray.h"
+
+// Identifies wisdom files, followed by the version, the entry count, and the entries.
+static const char wisdomMagic[8] = "CAVFFTW";
+// Version of the wisdom file layout, increased on any change of the entries.
+static const int32_t wisdomVersion = 1;
+// Codelet leaf sizes a power of two transform can start with.
+static const int leafCandidates[] = { 1, 8, 16, 32, 64 };
+// Number of times each candidate is measured, the fastest run counts.
+static const int measurementRounds = 3;
+
+// Leaf size of each known power of two FFT size.
+static std::map<int, int> leafSizes;
+// Guards the wisdom.
+static std::mutex wisdomLock;
+// Measure sizes not in the wisdom.
+static std::atomic<bool> autotune { true };
+
+// A single entry of a wisdom file.
+struct WisdomEntry {
+    int32_t fftSize;
+    int32_t leafSize;
+};
+
+// Check if the entry could have been measured by LeafSize.
+static bool IsValid(const WisdomEntry &entry) {
+    if (entry.fftSize <= 0 || (entry.fftSize & (entry.fftSize - 1)) || entry.leafSize > entry.fftSize) {
+        return false;
+    }
+    for (int candidate : leafCandidates) {
+        if (entry.leafSize == candidate) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Time of the given number of transforms of the signal with the plan's current leaf size.
+static double Measure(const FFTPlan *plan, const SplitComplexArray &signal, SplitComplexArray &work, const int repeats) {
+    int fftSize = plan->size();
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < repeats; i++) {
+        memcpy(work.real, signal.real, fftSize * sizeof(float));
+        memcpy(work.imaginary, signal.imaginary, fftSize * sizeof(float));
+        ProcessButterflies(work.real, work.imaginary, fftSize, plan, false);
+    }
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int FFTPlanner::LeafSize(FFTPlan *plan) {
+    int fftSize = plan->size();
+    {
+        std::lock_guard<std::mutex> lock(wisdomLock);
+        auto known = leafSizes.find(fftSize);
+        if (known != leafSizes.end()) {
+            return known->second;
+        }
+    }
+    int result = DefaultLeafSize(fftSize);
+    if (fftSize < 8 || !autotune) {
+        return result;
+    }
+
+    SplitComplexArray signal(fftSize), work(fftSize);
+    uint32_t seed = 1;
+    for (int i = 0; i < fftSize; i++) {
+        seed = seed * 1664525 + 1013904223;
+        signal.real[i] = (int32_t)seed * (1.f / 2147483648.f);
+        seed = seed * 1664525 + 1013904223;
+        signal.imaginary[i] = (int32_t)seed * (1.f / 2147483648.f);
+    }
+
+    // The rounds go through all candidates, so a temporary slowdown of the system doesn't favor any of them
+    const int candidates = sizeof(leafCandidates) / sizeof(*leafCandidates);
+    std::vector<double> times(candidates, 1e30);
+    int repeats = fftSize < 65536 ? 65536 / fftSize : 1;
+    for (int round = 0; round < measurementRounds; round++) {
+        for (int candidate = 0; candidate < candidates && leafCandidates[candidate] <= fftSize; candidate++) {
+            plan->leafSize = leafCandidates[candidate];
+            double time = Measure(plan, signal, work, repeats);
+            if (times[candidate] > time) {
+                times[candidate] = time;
+            }
+        }
+    }
+    int fastest = 0;
+    for (int candidate = 1; candidate < candidates; candidate++) {
+        if (times[candidate] < times[fastest]) {
+            fastest = candidate;
+        }
+    }
+    result = leafCandidates[fastest];
+
+    std::lock_guard<std::mutex> lock(wisdomLock);
+    leafSizes[fftSize] = result;
+    return result;
+}
+
+void FFTPlanner::SetAutotune(const bool enabled) {
+    autotune = enabled;
+}
+
+bool FFTPlanner::GetAutotune() {
+    return autotune;
+}
+
+int FFTPlanner::WisdomSize() {
+    std::lock_guard<std::mutex> lock(wisdomLock);
+    return (int)leafSizes.size();
+}
+
+bool FFTPlanner::Import(const char *path) {
+    FILE *file = path ? fopen(path, "rb") : nullptr;
+    if (!file) {
+        return false;
+    }
+    char magic[sizeof(wisdomMagic)];
+    int32_t version, count;
+    std::vector<WisdomEntry> entries;
+    bool valid = fread(magic, sizeof(magic), 1, file) == 1 && !memcmp(magic, wisdomMagic, sizeof(magic)) &&
+        fread(&version, sizeof(version), 1, file) == 1 && version == wisdomVersion &&
+        fread(&count, sizeof(count), 1, file) == 1 && count >= 0 && count <= 32;
+    if (valid) {
+        entries.resize(count);
+        valid = !count || fread(entries.data(), sizeof(WisdomEntry), count, file) == (size_t)count;
+        for (int i = 0; valid && i < count; i++) {
+            valid = IsValid(entries[i]);
+        }
+    }
+    fclose(file);
+    if (!valid) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(wisdomLock);
+    for (const WisdomEntry &entry : entries) {
+        leafSizes[entry.fftSize] = entry.leafSize;
+    }
+    return true;
+}
+
+bool FFTPlanner::Export(const char *path) {
+    std::vector<WisdomEntry> entries;
+    {
+        std::lock_guard<std::mutex> lock(wisdomLock);
+        for (const auto &known : leafSizes) {
+            entries.push_back({ known.first, known.second });
+        }
+    }
+    FILE *file = path ? fopen(path, "wb") : nullptr;
+    if (!file) {
+        return false;
+    }
+    int32_t count = (int32_t)entries.size();
+    bool written = fwrite(wisdomMagic, sizeof(wisdomMagic), 1, file) == 1 &&
+        fwrite(&wisdomVersion, sizeof(wisdomVersion), 1, file) == 1 &&
+        fwrite(&count, sizeof(count), 1, file) == 1 &&
+        (!count || fwrite(entries.data(), sizeof(WisdomEntry), count, file) == (size_t)count);
+    return !fclose(file) && written;
+}
+
+void FFTPlanner::Forget() {
+    std::lock_guard<std::mutex> lock(wisdomLock);
+    leafSizes.clear();
+}
+
+void DLL_EXPORT FFTPlanner_SetAutotune(bool enabled) {
+    FFTPlanner::SetAutotune(enabled);
+}
+
+bool DLL_EXPORT FFTPlanner_GetAutotune() {
+    return FFTPlanner::GetAutotune();
+}
+
+int DLL_EXPORT FFTPlanner_WisdomSize() {
+    return FFTPlanner::WisdomSize();
+}
+
+bool DLL_EXPORT FFTPlanner_ImportWisdom(const char *path) {
+    return FFTPlanner::Import(path);
+}
+
+bool DLL_EXPORT FFTPlanner_ExportWisdom(const char *path) {
+    return FFTPlanner::Export(path);
+}
+
+void DLL_EXPORT FFTPlanner_ForgetWisdom() {
+    FFTPlanner::Forget();
+}
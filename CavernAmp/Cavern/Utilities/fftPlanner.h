@@ -0,0 +1,54 @@
+#ifndef FFTPLANNER_H
+#define FFTPLANNER_H
+
+#include "fftPlan.h"
+#include "../../export.h"
+
+/// Class
+// Chooses the fastest kernel variant of each FFT size by measuring all candidates when the size is first planned.
+// The results (the wisdom) are kept for the lifetime of the process, and can be saved to and loaded from a file,
+// so later runs on the same machine don't have to measure again.
+class FFTPlanner {
+public:
+    // Get the fastest codelet leaf size for a power of two plan under construction, whose twiddles and bit reversal
+    // are already set. Measured only if it's not in the wisdom yet and autotuning is enabled.
+    static int LeafSize(FFTPlan *plan);
+
+    // Enable or disable measuring the sizes not in the wisdom. When disabled, unknown sizes use the default variants.
+    static void SetAutotune(const bool enabled);
+    // Check if the sizes not in the wisdom are measured.
+    static bool GetAutotune();
+    // Number of sizes in the wisdom.
+    static int WisdomSize();
+    // Load wisdom from a file created by Export, on top of the current wisdom. Returns false if the file can't be read or
+    // is invalid, in which case the current wisdom is not changed. Plans that already exist are not affected.
+    static bool Import(const char *path);
+    // Save the wisdom to a file. Returns false if the file can't be written.
+    static bool Export(const char *path);
+    // Clear the wisdom, the sizes are measured again when they are next planned.
+    static void Forget();
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Exports
+// Enable or disable measuring the FFT sizes not in the wisdom when they are first planned. Enabled by default.
+void DLL_EXPORT FFTPlanner_SetAutotune(bool enabled);
+// Check if the FFT sizes not in the wisdom are measured when they are first planned.
+bool DLL_EXPORT FFTPlanner_GetAutotune();
+// Number of FFT sizes in the wisdom.
+int DLL_EXPORT FFTPlanner_WisdomSize();
+// Load FFT wisdom from a file on top of the current wisdom. Returns false if the file can't be read or is invalid.
+bool DLL_EXPORT FFTPlanner_ImportWisdom(const char *path);
+// Save the FFT wisdom to a file. Returns false if the file can't be written.
+bool DLL_EXPORT FFTPlanner_ExportWisdom(const char *path);
+// Clear the FFT wisdom.
+void DLL_EXPORT FFTPlanner_ForgetWisdom();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // FFTPLANNER_H
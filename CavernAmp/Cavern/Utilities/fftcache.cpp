@@ -1,55 +1,48 @@
 #include <new>
-#include <math.h>
 #include <stdint.h>
 #include <stdlib.h>
 
 #include "fftcache.h"
 #include "../../main.h"
-#include "qmath.h"
 
-FFTCache::FFTCache(const int fftSize) {
+FFTCache::FFTCache(const int fftSize) : multithreaded(false) {
     if (fftSize <= 0) {
-        depth = 0;
-        sin = nullptr;
-        cos = nullptr;
-        even = nullptr;
-        odd = nullptr;
+        plan = nullptr;
+        work = nullptr;
+        scratch = nullptr;
         return;
     }
-    depth = fftSize / 2;
-    double step = -2 * M_PI / fftSize;
-    sin = new float[depth];
-    cos = new float[depth];
-    for (int i = 0; i < depth; ++i) {
-        float rotation = i * step;
-        cos[i] = cosf(rotation);
-        sin[i] = sinf(rotation);
-    }
+    plan = FFTPlan::Acquire(fftSize);
+    work = new SplitComplexArray(plan->workLength);
+    scratch = plan->scratchLength ? new SplitComplexArray(plan->scratchLength) : nullptr;
+}
 
-    int maxDepth = log2(fftSize);
-    even = new Complex*[maxDepth];
-    odd = new Complex*[maxDepth];
-    for (int idepth = 0; idepth < maxDepth; idepth++) {
-        even[idepth] = new Complex[1 << idepth];
-        odd[idepth] = new Complex[1 << idepth];
+FFTCache::FFTCache(const FFTCache &other) : multithreaded(other.multithreaded) {
+    if (!other.plan) {
+        plan = nullptr;
+        work = nullptr;
+        scratch = nullptr;
+        return;
     }
+    plan = FFTPlan::Acquire(other.plan);
+    work = new SplitComplexArray(plan->workLength);
+    scratch = plan->scratchLength ? new SplitComplexArray(plan->scratchLength) : nullptr;
 }
 
 int FFTCache::size() const {
-    return depth;
+    return plan ? plan->size() : 0;
+}
+
+bool FFTCache::Supports(const int sampleCount) const {
+    return plan && plan->Supports(sampleCount);
 }
 
 FFTCache::~FFTCache() {
-    delete[] sin;
-    delete[] cos;
-    if (even) {
-        for (int idepth = 0, maxDepth = log2(depth * 2); idepth < maxDepth; idepth++) {
-            delete[] even[idepth];
-            delete[] odd[idepth];
-        }
-        delete[] even;
-        delete[] odd;
+    if (plan) {
+        FFTPlan::Release(plan);
     }
+    delete work;
+    delete scratch;
 }
 
 FFTCache* DLL_EXPORT FFTCache_Create(const int fftSize) {
@@ -60,7 +53,13 @@ int DLL_EXPORT FFTCache_Size(const FFTCache *cache) {
     if (!cache) {
         return 0x7fffffff;
     }
-    return cache->size() * 2;
+    return cache->size();
+}
+
+void DLL_EXPORT FFTCache_SetMultithreaded(FFTCache *cache, bool multithreaded) {
+    if (cache) {
+        cache->multithreaded = multithreaded;
+    }
 }
 
 void DLL_EXPORT FFTCache_Dispose(FFTCache *cache) {
@@ -2,23 +2,38 @@
 #define FFTCACHE_H
 
 #include "complex.h"
+#include "fftPlan.h"
+#include "splitComplexArray.h"
 #include "../../export.h"
 
 /// Class
-// Precalculated constants and preallocated recursion arrays for a given FFT size.
+// Shared precalculated constants and a private work array for a given FFT size.
+// A cache can only perform one FFT at a time, use one cache per thread. Creating more caches of the same size
+// only allocates the work array, the constants are shared.
 class FFTCache {
-    int depth;
-
 public:
-    float *sin, *cos;
-    Complex **even, **odd;
+    // Immutable constants of the FFT size, shared with all other caches of the same size.
+    const FFTPlan *plan;
+    // Preallocated split array where the transforms are performed, at least fftSize elements.
+    SplitComplexArray *work;
+    // Second work array for the stages of mixed radix and the twiddles of four-step transforms, null if the plan doesn't
+    // need it.
+    SplitComplexArray *scratch;
+    // Spread the sub-transforms of large transforms on worker threads.
+    bool multithreaded;
 
     // FFT cache constructor.
     FFTCache(const int fftSize);
+    // Create a cache for another thread, sharing the plan of the other cache.
+    FFTCache(const FFTCache &other);
     // Get the creation size of the FFT cache.
     int size() const;
+    // Check if a transform of the given size can be performed with this cache.
+    bool Supports(const int sampleCount) const;
     // FFT cache destructor.
     ~FFTCache();
+
+    FFTCache& operator=(const FFTCache&) = delete;
 };
 
 #ifdef __cplusplus
@@ -30,6 +45,8 @@ extern "C" {
 FFTCache* DLL_EXPORT FFTCache_Create(const int fftSize);
 // Get the creation size of the FFT cache.
 int DLL_EXPORT FFTCache_Size(const FFTCache *cache);
+// Spread the sub-transforms of large transforms performed with this cache on worker threads. Disabled by default.
+void DLL_EXPORT FFTCache_SetMultithreaded(FFTCache *cache, bool multithreaded);
 // Dispose an FFT cache.
 void DLL_EXPORT FFTCache_Dispose(FFTCache *cache);
 
@@ -1,179 +1,287 @@
 #include <math.h>
+#include <string.h>
+#include <thread>
 
+#include "fftBatch.h"
+#include "fftFallbackCache.h"
+#include "fftFourStep.h"
+#include "fftKernels.h"
+#include "fftMixedRadix.h"
 #include "measurements.h"
 #include "qmath.h"
+#include "Threading/parallelizer.h"
 
-void DLL_EXPORT ProcessFFT(Complex *samples, int sampleCount, FFTCache *cache, int depth) {
-    if (!samples || sampleCount <= 0) {
-        return;
-    }
-    if (!cache || cache->size() * 2 < sampleCount) {
-        FFTCache *tempCache = FFTCache_Create(sampleCount);
-        ProcessFFT(samples, sampleCount, tempCache, log2(sampleCount) - 1);
-        FFTCache_Dispose(tempCache);
-        return;
+// Split the transform Z of a real signal packed as a half-size complex signal (even samples as the real, odd samples as the
+// imaginary part) to the halfLength + 1 bins of the real signal in-place. The twiddles are exp(-2 * pi * i * k / (2 * halfLength)).
+static void SplitRealSpectrum(float *real, float *imaginary, int halfLength, const float *twiddleReal, const float *twiddleImaginary) {
+    real[halfLength] = real[0];
+    imaginary[halfLength] = imaginary[0];
+    for (int i = 0, mirror = halfLength; i <= mirror; i++, mirror--) {
+        float currentReal = real[i], currentImag = imaginary[i], otherReal = real[mirror], otherImag = imaginary[mirror];
+        // Even spectrum at i: (Z[i] + conj(Z[mirror])) / 2, odd spectrum at i: (Z[i] - conj(Z[mirror])) / 2i
+        float evenReal = .5f * (currentReal + otherReal), evenImag = .5f * (currentImag - otherImag),
+            oddReal = .5f * (currentImag + otherImag), oddImag = .5f * (otherReal - currentReal);
+        // At the mirror position, the even and odd spectra are the conjugates, and the twiddle is -conj(twiddle[i])
+        float rotatedReal = oddReal * twiddleReal[i] - oddImag * twiddleImaginary[i],
+            rotatedImag = oddReal * twiddleImaginary[i] + oddImag * twiddleReal[i];
+        real[i] = evenReal + rotatedReal;
+        imaginary[i] = evenImag + rotatedImag;
+        real[mirror] = evenReal - rotatedReal;
+        imaginary[mirror] = rotatedImag - evenImag;
     }
+}
 
-    if (sampleCount < 8) {
-        if (sampleCount == 4) {
-            Complex evenValue = samples[0],
-                oddValue = samples[2];
-            Complex evenValue1 { evenValue.real + oddValue.real, evenValue.imaginary + oddValue.imaginary };
-            Complex evenValue2 { evenValue.real - oddValue.real, evenValue.imaginary - oddValue.imaginary };
-
-            evenValue = samples[1];
-            oddValue = samples[3];
-            Complex oddValue1 { evenValue.real + oddValue.real, evenValue.imaginary + oddValue.imaginary };
-            Complex oddValue2 { evenValue.real - oddValue.real, evenValue.imaginary - oddValue.imaginary };
-
-            samples[0] = { evenValue1.real + oddValue1.real, evenValue1.imaginary + oddValue1.imaginary };
-            samples[1] = { evenValue2.real + oddValue2.imaginary, evenValue2.imaginary - oddValue2.real };
-            samples[2] = { evenValue1.real - oddValue1.real, evenValue1.imaginary - oddValue1.imaginary };
-            samples[3] = { evenValue2.real - oddValue2.imaginary, evenValue2.imaginary + oddValue2.real };
-        } else if (sampleCount == 2) {
-            Complex evenValue = samples[0],
-                oddValue = samples[1];
-            samples[0] = { evenValue.real + oddValue.real, evenValue.imaginary + oddValue.imaginary };
-            samples[1] = { evenValue.real - oddValue.real, evenValue.imaginary - oddValue.imaginary };
+// Pack the halfLength + 1 bins of a real signal's spectrum to the doubled spectrum of the half-size complex signal formed
+// by its even and odd samples: Z[i] = E[i] + i * O[i]. The result is placed in bit reversed order if a reversal is given.
+static void PackRealSpectrum(const Complex *bins, float *real, float *imaginary, int halfLength,
+    const float *twiddleReal, const float *twiddleImaginary, const int *reversal, int shift) {
+    for (int i = 0, mirror = halfLength; i <= mirror; i++, mirror--) {
+        Complex current = bins[i], other = bins[mirror];
+        // Doubled even spectrum: X[i] + conj(X[mirror]), doubled odd spectrum: (X[i] - conj(X[mirror])) * conj(twiddle[i])
+        float evenReal = current.real + other.real, evenImag = current.imaginary - other.imaginary,
+            diffReal = current.real - other.real, diffImag = current.imaginary + other.imaginary;
+        float oddReal = diffReal * twiddleReal[i] + diffImag * twiddleImaginary[i],
+            oddImag = diffImag * twiddleReal[i] - diffReal * twiddleImaginary[i];
+        int target = reversal ? reversal[i] >> shift : i;
+        real[target] = evenReal - oddImag;
+        imaginary[target] = evenImag + oddReal;
+        if (mirror != halfLength) {
+            target = reversal ? reversal[mirror] >> shift : mirror;
+            real[target] = evenReal + oddImag;
+            imaginary[target] = oddReal - evenImag;
         }
-        return;
     }
+}
 
+// Transform a real signal of sampleCount samples to its sampleCount / 2 + 1 bins in the work array of the cache.
+// The samples might be overwritten.
+static void RealFFTToWork(float *samples, int sampleCount, FFTCache *cache) {
     int halfLength = sampleCount / 2;
-    Complex *even = cache->even[depth], *odd = cache->odd[depth];
-    for (int sample = 0, pair = 0; sample < halfLength; sample++, pair += 2) {
-        even[sample] = samples[pair];
-        odd[sample] = samples[pair + 1];
-    }
-    ProcessFFT(even, halfLength, cache, --depth);
-    ProcessFFT(odd, halfLength, cache, depth);
-    int stepMul = cache->size() / halfLength;
-    for (int i = 0; i < halfLength; i++) {
-        float oddReal = odd[i].real * cache->cos[i * stepMul] - odd[i].imaginary * cache->sin[i * stepMul],
-            oddImag = odd[i].real * cache->sin[i * stepMul] + odd[i].imaginary * cache->cos[i * stepMul];
-        samples[i].real = even[i].real + oddReal;
-        samples[i].imaginary = even[i].imaginary + oddImag;
-        samples[i + halfLength].real = even[i].real - oddReal;
-        samples[i + halfLength].imaginary = even[i].imaginary - oddImag;
+    const FFTPlan *plan = cache->plan;
+    float *real = cache->work->real, *imaginary = cache->work->imaginary;
+    if (plan->kind == FFTPlanKind::PowerOfTwo && halfLength >= FourStepMinimum()) {
+        ProcessFourStep((const Complex*)samples, (Complex*)samples, halfLength, plan, cache->work, cache->scratch, false,
+            cache->multithreaded);
+        Deinterleave((const Complex*)samples, real, imaginary, halfLength);
+        SplitRealSpectrum(real, imaginary, halfLength,
+            plan->twiddles->real + halfLength - 1, plan->twiddles->imaginary + halfLength - 1);
+    } else if (plan->kind == FFTPlanKind::PowerOfTwo) {
+        GatherRealBitReversed(samples, real, imaginary, halfLength, plan);
+        ProcessButterflies(real, imaginary, halfLength, plan, false);
+        SplitRealSpectrum(real, imaginary, halfLength,
+            plan->twiddles->real + halfLength - 1, plan->twiddles->imaginary + halfLength - 1);
+    } else if (sampleCount & 1) { // Odd sizes can't be packed, they are transformed as complex signals
+        memcpy(real, samples, sampleCount * sizeof(float));
+        memset(imaginary, 0, sampleCount * sizeof(float));
+        ProcessNaturalOrder(nullptr, real, imaginary, plan, cache->scratch, false);
+    } else {
+        ProcessNaturalOrder((const Complex*)samples, real, imaginary, plan->half, cache->scratch, false);
+        SplitRealSpectrum(real, imaginary, halfLength, plan->realTwiddles->real, plan->realTwiddles->imaginary);
     }
 }
 
-void DLL_EXPORT ProcessFFT1D(float *samples, int sampleCount, FFTCache *cache) {
-    if (!samples || sampleCount <= 0) {
+void DLL_EXPORT ProcessFFT(Complex *samples, int sampleCount, FFTCache *cache, int) {
+    if (!samples || sampleCount <= 1) {
         return;
     }
-    if (!cache || cache->size() * 2 < sampleCount) {
-        FFTCache *tempCache = FFTCache_Create(sampleCount);
-        ProcessFFT1D(samples, sampleCount, tempCache);
-        FFTCache_Dispose(tempCache);
+    if (!cache || !cache->Supports(sampleCount)) {
+        cache = GetFallbackFFTCache(sampleCount);
+    }
+
+    if (cache->plan->kind == FFTPlanKind::PowerOfTwo && sampleCount >= FourStepMinimum()) {
+        ProcessFourStep(samples, samples, sampleCount, cache->plan, cache->work, cache->scratch, false, cache->multithreaded);
         return;
     }
 
-    int halfLength = sampleCount / 2, depth = log2(sampleCount) - 1;
+    float *real = cache->work->real, *imaginary = cache->work->imaginary;
+    if (cache->plan->kind == FFTPlanKind::PowerOfTwo) {
+        GatherBitReversed(samples, real, imaginary, sampleCount, cache->plan);
+        ProcessButterflies(real, imaginary, sampleCount, cache->plan, false);
+    } else {
+        ProcessNaturalOrder(samples, real, imaginary, cache->plan, cache->scratch, false);
+    }
+    Interleave(real, imaginary, samples, sampleCount);
+}
+
+void DLL_EXPORT ProcessFFT1D(float *samples, int sampleCount, FFTCache *cache) {
+    if (!samples || sampleCount <= 0) {
+        return;
+    }
     if (sampleCount == 1) {
+        samples[0] = fabsf(samples[0]);
         return;
     }
+    if (!cache || !cache->Supports(sampleCount)) {
+        cache = GetFallbackFFTCache(sampleCount);
+    }
 
-    Complex *even = cache->even[depth], *odd = cache->odd[depth];
-    for (int sample = 0, pair = 0; sample < halfLength; sample++, pair += 2) {
-        even[sample].real = samples[pair];
-        even[sample].imaginary = 0;
-        odd[sample].real = samples[pair + 1];
-        odd[sample].imaginary = 0;
+    int halfLength = sampleCount / 2;
+    float *real = cache->work->real, *imaginary = cache->work->imaginary;
+    RealFFTToWork(samples, sampleCount, cache);
+    for (int i = 0; i <= halfLength; i++) {
+        samples[i] = sqrtf(real[i] * real[i] + imaginary[i] * imaginary[i]);
     }
-    ProcessFFT(even, halfLength, cache, --depth);
-    ProcessFFT(odd, halfLength, cache, depth);
-    int stepMul = cache->size() / halfLength;
-    for (int i = 0; i < halfLength; i++) {
-        float oddReal = odd[i].real * cache->cos[i * stepMul] - odd[i].imaginary * cache->sin[i * stepMul],
-            oddImag = odd[i].real * cache->sin[i * stepMul] + odd[i].imaginary * cache->cos[i * stepMul];
-        float real = even[i].real + oddReal, imaginary = even[i].imaginary + oddImag;
-        samples[i] = sqrtf(real * real + imaginary * imaginary);
-        real = even[i].real - oddReal;
-        imaginary = even[i].imaginary - oddImag;
-        samples[i + halfLength] = sqrtf(real * real + imaginary * imaginary);
+    for (int i = 1; i < sampleCount - i; i++) {
+        samples[sampleCount - i] = samples[i]; // The spectrum of a real signal is conjugate symmetric
     }
 }
 
-void DLL_EXPORT InPlaceFFT(Complex *samples, int sampleCount, FFTCache *cache) {
+void DLL_EXPORT ProcessRealFFT(float *samples, int sampleCount, FFTCache *cache) {
     if (!samples || sampleCount <= 0) {
         return;
     }
-
-    if (!cache || cache->size() * 2 < sampleCount) {
-        FFTCache *tempCache = FFTCache_Create(sampleCount);
-        ProcessFFT(samples, sampleCount, tempCache, log2(sampleCount) - 1);
-        FFTCache_Dispose(tempCache);
-    } else {
-        ProcessFFT(samples, sampleCount, cache, log2(sampleCount) - 1);
+    if (sampleCount == 1) {
+        samples[1] = 0;
+        return;
     }
+    if (!cache || !cache->Supports(sampleCount)) {
+        cache = GetFallbackFFTCache(sampleCount);
+    }
+
+    // Even samples are transformed as the real, odd samples as the imaginary part of a half-size complex signal
+    int halfLength = sampleCount / 2;
+    RealFFTToWork(samples, sampleCount, cache);
+    Interleave(cache->work->real, cache->work->imaginary, (Complex*)samples, halfLength + 1);
+}
+
+void DLL_EXPORT InPlaceFFT(Complex *samples, int sampleCount, FFTCache *cache) {
+    ProcessFFT(samples, sampleCount, cache, 0);
 }
 
 void DLL_EXPORT InPlaceFFT1D(float *samples, int sampleCount, FFTCache *cache) {
-    if (!samples || sampleCount <= 0) {
+    ProcessFFT1D(samples, sampleCount, cache);
+}
+
+void DLL_EXPORT InPlaceRealFFT(float *samples, int sampleCount, FFTCache *cache) {
+    ProcessRealFFT(samples, sampleCount, cache);
+}
+
+void DLL_EXPORT ProcessIFFT(Complex *samples, int sampleCount, FFTCache *cache, int) {
+    if (!samples || sampleCount <= 1) {
         return;
     }
+    if (!cache || !cache->Supports(sampleCount)) {
+        cache = GetFallbackFFTCache(sampleCount);
+    }
 
-    if (!cache || cache->size() * 2 < sampleCount) {
-        FFTCache *tempCache = FFTCache_Create(sampleCount);
-        ProcessFFT1D(samples, sampleCount, tempCache);
-        FFTCache_Dispose(tempCache);
+    if (cache->plan->kind == FFTPlanKind::PowerOfTwo && sampleCount >= FourStepMinimum()) {
+        ProcessFourStep(samples, samples, sampleCount, cache->plan, cache->work, cache->scratch, true, cache->multithreaded);
+        return;
+    }
+
+    float *real = cache->work->real, *imaginary = cache->work->imaginary;
+    if (cache->plan->kind == FFTPlanKind::PowerOfTwo) {
+        GatherBitReversed(samples, real, imaginary, sampleCount, cache->plan);
+        ProcessButterflies(real, imaginary, sampleCount, cache->plan, true);
     } else {
-        ProcessFFT1D(samples, sampleCount, cache);
+        ProcessNaturalOrder(samples, real, imaginary, cache->plan, cache->scratch, true);
     }
+    Interleave(real, imaginary, samples, sampleCount);
 }
 
-void DLL_EXPORT ProcessIFFT(Complex *samples, int sampleCount, FFTCache *cache, int depth) {
+void DLL_EXPORT InPlaceIFFT(Complex *samples, int sampleCount, FFTCache *cache) {
     if (!samples || sampleCount <= 0) {
         return;
     }
 
-    if (!cache || cache->size() * 2 < sampleCount) {
-        FFTCache *tempCache = FFTCache_Create(sampleCount);
-        ProcessIFFT(samples, sampleCount, tempCache, log2(sampleCount) - 1);
-        FFTCache_Dispose(tempCache);
-        return;
+    ProcessIFFT(samples, sampleCount, cache, 0);
+    float multiplier = 1.f / sampleCount;
+    for (int i = 0; i < sampleCount; i++) {
+        samples[i].real *= multiplier;
+        samples[i].imaginary *= multiplier;
     }
+}
 
-    if (sampleCount == 1) {
+void DLL_EXPORT ProcessRealIFFT(float *samples, int sampleCount, FFTCache *cache) {
+    if (!samples || sampleCount <= 1) {
         return;
     }
+    if (!cache || !cache->Supports(sampleCount)) {
+        cache = GetFallbackFFTCache(sampleCount);
+    }
 
-    Complex *even = cache->even[depth], *odd = cache->odd[depth];
     int halfLength = sampleCount / 2;
-    for (int sample = 0, pair = 0; sample < halfLength; sample++, pair += 2) {
-        even[sample] = samples[pair];
-        odd[sample] = samples[pair + 1];
-    }
-    ProcessIFFT(even, halfLength, cache, --depth);
-    ProcessIFFT(odd, halfLength, cache, depth);
-    int stepMul = cache->size() / halfLength;
-    for (int i = 0; i < halfLength; i++) {
-        float oddReal = odd[i].real * cache->cos[i * stepMul] + odd[i].imaginary * cache->sin[i * stepMul],
-            oddImag = odd[i].imaginary * cache->cos[i * stepMul] - odd[i].real * cache->sin[i * stepMul];
-        samples[i].real = even[i].real + oddReal;
-        samples[i].imaginary = even[i].imaginary + oddImag;
-        samples[i + halfLength].real = even[i].real - oddReal;
-        samples[i + halfLength].imaginary = even[i].imaginary - oddImag;
+    const Complex *bins = (const Complex*)samples;
+    const FFTPlan *plan = cache->plan;
+    float *real = cache->work->real, *imaginary = cache->work->imaginary;
+    if (plan->kind == FFTPlanKind::PowerOfTwo && halfLength >= FourStepMinimum()) {
+        PackRealSpectrum(bins, real, imaginary, halfLength, plan->twiddles->real + halfLength - 1,
+            plan->twiddles->imaginary + halfLength - 1, nullptr, 0);
+        Interleave(real, imaginary, (Complex*)samples, halfLength);
+        ProcessFourStep((const Complex*)samples, (Complex*)samples, halfLength, plan, cache->work, cache->scratch, true,
+            cache->multithreaded);
+        return;
+    } else if (plan->kind == FFTPlanKind::PowerOfTwo) {
+        // The packed spectrum is placed in bit reversed order for the butterflies
+        PackRealSpectrum(bins, real, imaginary, halfLength, plan->twiddles->real + halfLength - 1,
+            plan->twiddles->imaginary + halfLength - 1, plan->reversal, ReversalShift(halfLength, plan));
+        ProcessButterflies(real, imaginary, halfLength, plan, true);
+    } else if (sampleCount & 1) { // Odd sizes can't be packed, the full conjugate symmetric spectrum is transformed
+        for (int i = 0; i <= halfLength; i++) {
+            real[i] = bins[i].real;
+            imaginary[i] = bins[i].imaginary;
+        }
+        for (int i = 1; i <= halfLength; i++) {
+            real[sampleCount - i] = bins[i].real;
+            imaginary[sampleCount - i] = -bins[i].imaginary;
+        }
+        ProcessNaturalOrder(nullptr, real, imaginary, plan, cache->scratch, true);
+        memcpy(samples, real, sampleCount * sizeof(float));
+        return;
+    } else {
+        PackRealSpectrum(bins, real, imaginary, halfLength, plan->realTwiddles->real, plan->realTwiddles->imaginary, nullptr, 0);
+        ProcessNaturalOrder(nullptr, real, imaginary, plan->half, cache->scratch, true);
     }
+    Interleave(real, imaginary, (Complex*)samples, halfLength);
 }
 
-void DLL_EXPORT InPlaceIFFT(Complex *samples, int sampleCount, FFTCache *cache) {
+void DLL_EXPORT InPlaceRealIFFT(float *samples, int sampleCount, FFTCache *cache) {
     if (!samples || sampleCount <= 0) {
         return;
     }
 
-    if (!cache || cache->size() * 2 < sampleCount) {
-        FFTCache *tempCache = FFTCache_Create(sampleCount);
-        ProcessIFFT(samples, sampleCount, tempCache, log2(sampleCount) - 1);
-        FFTCache_Dispose(tempCache);
-    } else {
-        ProcessIFFT(samples, sampleCount, cache, log2(sampleCount) - 1);
-    }
-
+    ProcessRealIFFT(samples, sampleCount, cache);
     float multiplier = 1.f / sampleCount;
     for (int i = 0; i < sampleCount; i++) {
-        samples[i].real *= multiplier;
-        samples[i].imaginary *= multiplier;
+        samples[i] *= multiplier;
+    }
+}
+
+// Transform equally sized signals with the same plan, in SIMD lanes when the size is small enough, or one by one otherwise.
+static void ProcessBatch(Complex **signals, int channels, int sampleCount, FFTCache *cache, bool multithreaded, bool inverse) {
+    if (!signals || channels <= 0 || sampleCount <= 1) {
+        return;
+    }
+    if (!cache || !cache->Supports(sampleCount)) {
+        cache = GetFallbackFFTCache(sampleCount);
     }
+
+    const FFTPlan *plan = cache->plan;
+    if (plan->kind == FFTPlanKind::PowerOfTwo && sampleCount >= 4 && sampleCount <= fftBatchMaximumSize) {
+        float scale = inverse ? 1.f / sampleCount : 1;
+        Parallelizer::For(0, (channels + fftBatchLanes - 1) / fftBatchLanes, [&](int group) {
+            int first = group * fftBatchLanes, lanes = channels - first;
+            ProcessLanes(signals + first, lanes < fftBatchLanes ? lanes : fftBatchLanes, sampleCount, plan, inverse, scale);
+        }, multithreaded);
+        return;
+    }
+
+    // Worker threads use their own fallback caches, which share the plan of the same size through the plan registry
+    std::thread::id caller = std::this_thread::get_id();
+    Parallelizer::For(0, channels, [&](int channel) {
+        FFTCache *threadCache = std::this_thread::get_id() == caller ? cache : GetFallbackFFTCache(sampleCount);
+        if (inverse) {
+            InPlaceIFFT(signals[channel], sampleCount, threadCache);
+        } else {
+            InPlaceFFT(signals[channel], sampleCount, threadCache);
+        }
+    }, multithreaded);
+}
+
+void DLL_EXPORT InPlaceFFTBatch(Complex **signals, int channels, int sampleCount, FFTCache *cache, bool multithreaded) {
+    ProcessBatch(signals, channels, sampleCount, cache, multithreaded, false);
+}
+
+void DLL_EXPORT InPlaceIFFTBatch(Complex **signals, int channels, int sampleCount, FFTCache *cache, bool multithreaded) {
+    ProcessBatch(signals, channels, sampleCount, cache, multithreaded, true);
 }
@@ -9,7 +9,7 @@
 extern "C" {
 #endif
 
-// Actual FFT processing, somewhat in-place.
+// Actual FFT processing, in-place. The depth is not used by the iterative transform, it's only kept for binary compatibility.
 void DLL_EXPORT ProcessFFT(Complex *samples, int sampleCount, FFTCache *cache, int depth);
 // Fourier-transform a signal in 1D. The result is the spectral power.
 void DLL_EXPORT ProcessFFT1D(float *samples, int sampleCount, FFTCache *cache);
@@ -17,10 +17,27 @@ void DLL_EXPORT ProcessFFT1D(float *samples, int sampleCount, FFTCache *cache);
 void DLL_EXPORT InPlaceFFT(Complex *samples, int sampleCount, FFTCache *cache);
 // Spectrum of a signal's FFT while keeping the source array allocation.
 void DLL_EXPORT InPlaceFFT1D(float *samples, int sampleCount, FFTCache *cache);
-// Outputs IFFT(X) * N.
+// Fourier-transform a real signal of sampleCount samples to sampleCount / 2 + 1 complex bins in-place.
+// The array has to be able to hold sampleCount + 2 floats. The bins are interleaved real and imaginary pairs.
+void DLL_EXPORT ProcessRealFFT(float *samples, int sampleCount, FFTCache *cache);
+// Fourier-transform a real signal to sampleCount / 2 + 1 complex bins while keeping the source array allocation,
+// which has to be able to hold sampleCount + 2 floats.
+void DLL_EXPORT InPlaceRealFFT(float *samples, int sampleCount, FFTCache *cache);
+// Outputs IFFT(X) * N. The depth is not used by the iterative transform, it's only kept for binary compatibility.
 void DLL_EXPORT ProcessIFFT(Complex *samples, int sampleCount, FFTCache *cache, int depth);
 // Inverse Fast Fourier Transform of a transformed signal, while keeping the source array allocation.
 void DLL_EXPORT InPlaceIFFT(Complex *samples, int sampleCount, FFTCache *cache);
+// Transforms the sampleCount / 2 + 1 bins of a real signal's spectrum back to the sampleCount real samples of IFFT(X) * N, in-place.
+void DLL_EXPORT ProcessRealIFFT(float *samples, int sampleCount, FFTCache *cache);
+// Inverse Fast Fourier Transform of the sampleCount / 2 + 1 bins of a real signal's spectrum to sampleCount real samples,
+// while keeping the source array allocation.
+void DLL_EXPORT InPlaceRealIFFT(float *samples, int sampleCount, FFTCache *cache);
+// Fast Fourier transform channels signals of the same size in-place with a single cache. Signals up to 4096 samples are
+// transformed 8 at a time, one in each SIMD lane. If multithreaded is set, the batch is split between worker threads.
+void DLL_EXPORT InPlaceFFTBatch(Complex **signals, int channels, int sampleCount, FFTCache *cache, bool multithreaded);
+// Inverse Fast Fourier transform channels transformed signals of the same size in-place with a single cache, the same way
+// as InPlaceFFTBatch.
+void DLL_EXPORT InPlaceIFFTBatch(Complex **signals, int channels, int sampleCount, FFTCache *cache, bool multithreaded);
 
 #ifdef __cplusplus
 }
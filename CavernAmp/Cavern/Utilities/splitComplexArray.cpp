@@ -0,0 +1,82 @@
+#include <cstring>
+#include <immintrin.h>
+
+#include "splitComplexArray.h"
+
+SplitComplexArray::SplitComplexArray(const int length) : length(length) {
+    size_t bytes = (length > 0 ? length : 1) * sizeof(float);
+    real = (float*)_mm_malloc(bytes, 32);
+    imaginary = (float*)_mm_malloc(bytes, 32);
+}
+
+SplitComplexArray::SplitComplexArray(const SplitComplexArray &other) : SplitComplexArray(other.length) {
+    memcpy(real, other.real, length * sizeof(float));
+    memcpy(imaginary, other.imaginary, length * sizeof(float));
+}
+
+SplitComplexArray::~SplitComplexArray() {
+    _mm_free(real);
+    _mm_free(imaginary);
+}
+
+void SplitComplexArray::FromComplex(const Complex *source) {
+    Deinterleave(source, real, imaginary, length);
+}
+
+void SplitComplexArray::ToComplex(Complex *target) const {
+    Interleave(real, imaginary, target, length);
+}
+
+void SplitComplexArray::Clear() {
+    memset(real, 0, length * sizeof(float));
+    memset(imaginary, 0, length * sizeof(float));
+}
+
+void Convolve(SplitComplexArray &source, const SplitComplexArray &other) {
+    Convolve(source.real, source.imaginary, other.real, other.imaginary, source.length);
+}
+
+void Convolve(float *sourceReal, float *sourceImaginary, const float *otherReal, const float *otherImaginary, int len) {
+    int i = 0;
+    for (int end = len - 7; i < end; i += 8) {
+        __m256 aReal = _mm256_loadu_ps(sourceReal + i), aImag = _mm256_loadu_ps(sourceImaginary + i),
+            bReal = _mm256_loadu_ps(otherReal + i), bImag = _mm256_loadu_ps(otherImaginary + i);
+        _mm256_storeu_ps(sourceReal + i, _mm256_sub_ps(_mm256_mul_ps(aReal, bReal), _mm256_mul_ps(aImag, bImag)));
+        _mm256_storeu_ps(sourceImaginary + i, _mm256_add_ps(_mm256_mul_ps(aReal, bImag), _mm256_mul_ps(aImag, bReal)));
+    }
+    for (; i < len; i++) {
+        float oldReal = sourceReal[i];
+        sourceReal[i] = oldReal * otherReal[i] - sourceImaginary[i] * otherImaginary[i];
+        sourceImaginary[i] = oldReal * otherImaginary[i] + sourceImaginary[i] * otherReal[i];
+    }
+}
+
+void Deinterleave(const Complex *source, float *real, float *imaginary, int len) {
+    const float *from = (const float*)source;
+    int i = 0;
+    for (int end = len - 7; i < end; i += 8, from += 16) {
+        __m256 low = _mm256_loadu_ps(from), high = _mm256_loadu_ps(from + 8);
+        __m256 first = _mm256_permute2f128_ps(low, high, 0x20), second = _mm256_permute2f128_ps(low, high, 0x31);
+        _mm256_storeu_ps(real + i, _mm256_shuffle_ps(first, second, _MM_SHUFFLE(2, 0, 2, 0)));
+        _mm256_storeu_ps(imaginary + i, _mm256_shuffle_ps(first, second, _MM_SHUFFLE(3, 1, 3, 1)));
+    }
+    for (; i < len; i++) {
+        real[i] = source[i].real;
+        imaginary[i] = source[i].imaginary;
+    }
+}
+
+void Interleave(const float *real, const float *imaginary, Complex *target, int len) {
+    float *to = (float*)target;
+    int i = 0;
+    for (int end = len - 7; i < end; i += 8, to += 16) {
+        __m256 realPart = _mm256_loadu_ps(real + i), imaginaryPart = _mm256_loadu_ps(imaginary + i);
+        __m256 low = _mm256_unpacklo_ps(realPart, imaginaryPart), high = _mm256_unpackhi_ps(realPart, imaginaryPart);
+        _mm256_storeu_ps(to, _mm256_permute2f128_ps(low, high, 0x20));
+        _mm256_storeu_ps(to + 8, _mm256_permute2f128_ps(low, high, 0x31));
+    }
+    for (; i < len; i++) {
+        target[i].real = real[i];
+        target[i].imaginary = imaginary[i];
+    }
+}
@@ -0,0 +1,46 @@
+#ifndef SPLITCOMPLEXARRAY_H
+#define SPLITCOMPLEXARRAY_H
+
+#include "complex.h"
+
+/// Complex array with the real and imaginary parts in separate arrays (structure of arrays),
+/// so a SIMD register holds the same part of consecutive elements. Both arrays are 32-byte aligned.
+class SplitComplexArray {
+public:
+    /// Real parts of the elements.
+    float *real;
+    /// Imaginary parts of the elements.
+    float *imaginary;
+    /// Number of elements in both arrays.
+    int length;
+
+    /// Allocate an uninitialized array of the given length.
+    SplitComplexArray(const int length);
+    /// Copy the elements of another array.
+    SplitComplexArray(const SplitComplexArray &other);
+    /// Free the arrays.
+    ~SplitComplexArray();
+
+    /// Fill the array from the interleaved (array of structures) layout.
+    void FromComplex(const Complex *source);
+    /// Copy the array to the interleaved (array of structures) layout.
+    void ToComplex(Complex *target) const;
+    /// Set all elements to zero.
+    void Clear();
+
+    SplitComplexArray& operator=(const SplitComplexArray&) = delete;
+};
+
+/// Copy interleaved complex samples to split arrays.
+void Deinterleave(const Complex *source, float *real, float *imaginary, int len);
+
+/// Copy split complex samples to the interleaved layout.
+void Interleave(const float *real, const float *imaginary, Complex *target, int len);
+
+/// Replace the source with its convolution with an other array of the same length.
+void Convolve(SplitComplexArray &source, const SplitComplexArray &other);
+
+/// Replace the source with its convolution with an other array, both given by their split parts.
+void Convolve(float *sourceReal, float *sourceImaginary, const float *otherReal, const float *otherImaginary, int len);
+
+#endif // SPLITCOMPLEXARRAY_H
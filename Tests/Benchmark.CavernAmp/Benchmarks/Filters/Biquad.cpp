@@ -0,0 +1,189 @@
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "Biquad.h"
+#include "../../benchmark.h"
+#include "../../../../CavernAmp/Cavern/Filters/biquadBank.h"
+#include "../../../../CavernAmp/Cavern/Filters/biquadCascade.h"
+#include "../../../../CavernAmp/Cavern/Filters/biquadFilter.h"
+
+// Sample rate of the filters.
+static const int sampleRate = 48000;
+
+// The processing loop of the managed BiquadFilter, with its history in fields.
+class ReferenceBiquad {
+public:
+    float x1 = 0, x2 = 0, y1 = 0, y2 = 0;
+    BiquadCoefficients coefficients;
+
+    ReferenceBiquad(const BiquadCoefficients &coefficients) : coefficients(coefficients) { }
+
+    void Process(float *samples, int len) {
+        for (int sample = 0; sample < len; sample++) {
+            float thisSample = samples[sample];
+            samples[sample] = coefficients.b2 * x2 + coefficients.b1 * x1 + coefficients.b0 * thisSample -
+                coefficients.a1 * y1 - coefficients.a2 * y2;
+            y2 = y1;
+            y1 = samples[sample];
+            x2 = x1;
+            x1 = thisSample;
+        }
+    }
+};
+
+void BiquadBenchmarks::Run() {
+    Bank();
+    Cascade();
+    Family();
+    Block();
+}
+
+void BiquadBenchmarks::Bank() {
+    const int channels = 12, bands = 10;
+    float *signal = new float[channels * 1024];
+    for (int i = 0; i < channels * 1024; i++) {
+        signal[i] = (float)rand() / RAND_MAX - .5f;
+    }
+
+    // The same gentle peaking filters everywhere, so the signal neither explodes nor fades while it's filtered repeatedly
+    PeakingFilter **filters = new PeakingFilter*[channels * bands];
+    BiquadBank bank(channels, bands);
+    for (int band = 0; band < bands; band++) {
+        for (int channel = 0; channel < channels; channel++) {
+            PeakingFilter *filter = new PeakingFilter(sampleRate, 40 << band, 1, band & 1 ? 1 : -1);
+            const BiquadCoefficients &coefficients = filter->GetCoefficients();
+            bank.SetBiquad(channel, band, coefficients.b0, coefficients.b1, coefficients.b2, coefficients.a1,
+                coefficients.a2);
+            filters[channel * bands + band] = filter;
+        }
+    }
+
+    printHeader("Biquads: 12 channels, 10 bands each",
+        "block | per filter us |      bank us | speedup");
+    for (int blockSize = 64; blockSize <= 1024; blockSize <<= 2) {
+        double perFilter = measure([&]() {
+            for (int filter = 0; filter < channels * bands; filter++) {
+                filters[filter]->Process(signal, channels * blockSize, filter / bands, channels);
+            }
+            g_benchmarkSink = signal[0];
+        });
+        double banked = measure([&]() {
+            bank.Process(signal, channels * blockSize);
+            g_benchmarkSink = signal[0];
+        });
+        printf("%5d | %13.2f | %12.2f | %6.2fx\n", blockSize, perFilter * 1e6, banked * 1e6, perFilter / banked);
+    }
+
+    for (int filter = 0; filter < channels * bands; filter++) {
+        delete filters[filter];
+    }
+    delete[] filters;
+    delete[] signal;
+}
+
+void BiquadBenchmarks::Cascade() {
+    const int blockSize = 1024;
+    float *signal = new float[blockSize];
+    for (int i = 0; i < blockSize; i++) {
+        signal[i] = (float)rand() / RAND_MAX - .5f;
+    }
+
+    printHeader("Biquads: single channel chain, 1024 samples",
+        "bands | per filter us | cascade us | double us | speedup");
+    for (int bands = 10; bands <= 30; bands += 10) {
+        std::vector<Filter*> filters;
+        for (int band = 0; band < bands; band++) {
+            filters.push_back(new PeakingFilter(sampleRate, 20 * pow(1.25, band), 1, band & 1 ? 1 : -1));
+        }
+        BiquadCascade *cascade = BiquadCascade::Merge(filters, false),
+            *precise = BiquadCascade::Merge(filters, true);
+
+        double perFilter = measure([&]() {
+            for (int filter = 0; filter < bands; filter++) {
+                filters[filter]->Process(signal, blockSize);
+            }
+            g_benchmarkSink = signal[0];
+        });
+        double merged = measure([&]() {
+            cascade->Process(signal, blockSize);
+            g_benchmarkSink = signal[0];
+        });
+        double mergedPrecise = measure([&]() {
+            precise->Process(signal, blockSize);
+            g_benchmarkSink = signal[0];
+        });
+        printf("%5d | %13.2f | %10.2f | %9.2f | %6.2fx\n", bands, perFilter * 1e6, merged * 1e6, mergedPrecise * 1e6,
+            perFilter / merged);
+
+        for (int filter = 0; filter < bands; filter++) {
+            delete filters[filter];
+        }
+        delete cascade;
+        delete precise;
+    }
+    delete[] signal;
+}
+
+void BiquadBenchmarks::Family() {
+    const int blockSize = 1024;
+    const char *names[] = { "Allpass", "Bandpass", "Highpass", "HighShelf", "Lowpass", "LowShelf", "Notch", "PeakingEQ" };
+    float *source = new float[blockSize], *signal = new float[blockSize];
+    for (int i = 0; i < blockSize; i++) {
+        source[i] = (float)rand() / RAND_MAX - .5f;
+    }
+
+    printHeader("Biquads: each type on a single channel, 1024 samples",
+        "type      | reference us | native us | speedup");
+    for (int type = 0; type < 8; type++) {
+        BiquadFilter *filter = BiquadFilter::Create((BiquadFilterType)type, sampleRate, 1000, 1, 0);
+        ReferenceBiquad reference(filter->GetCoefficients());
+        double referenceTime = measure([&]() {
+            memcpy(signal, source, blockSize * sizeof(float)); // Repeated passes would fade to denormals for some types
+            reference.Process(signal, blockSize);
+            g_benchmarkSink = signal[0];
+        });
+        double nativeTime = measure([&]() {
+            memcpy(signal, source, blockSize * sizeof(float));
+            filter->Process(signal, blockSize);
+            g_benchmarkSink = signal[0];
+        });
+        printf("%-9s | %12.2f | %9.2f | %6.2fx\n", names[type], referenceTime * 1e6, nativeTime * 1e6,
+            referenceTime / nativeTime);
+        delete filter;
+    }
+    delete[] source;
+    delete[] signal;
+}
+
+void BiquadBenchmarks::Block() {
+    const int blockSize = 1024;
+    const char *names[] = { "Allpass", "Bandpass", "Highpass", "HighShelf", "Lowpass", "LowShelf", "Notch", "PeakingEQ" };
+    float *source = new float[blockSize], *signal = new float[blockSize];
+    for (int i = 0; i < blockSize; i++) {
+        source[i] = (float)rand() / RAND_MAX - .5f;
+    }
+
+    printHeader("Biquads: block processing on a single channel, 1024 samples",
+        "type      | recurrence us | block us | speedup");
+    for (int type = 0; type < 8; type++) {
+        BiquadFilter *filter = BiquadFilter::Create((BiquadFilterType)type, sampleRate, 1000, 1, 0);
+        double recurrenceTime = measure([&]() {
+            memcpy(signal, source, blockSize * sizeof(float));
+            filter->Process(signal, blockSize);
+            g_benchmarkSink = signal[0];
+        });
+        filter->SetBlockProcessing(true);
+        double blockTime = measure([&]() {
+            memcpy(signal, source, blockSize * sizeof(float));
+            filter->Process(signal, blockSize);
+            g_benchmarkSink = signal[0];
+        });
+        printf("%-9s | %13.2f | %8.2f | %6.2fx\n", names[type], recurrenceTime * 1e6, blockTime * 1e6,
+            recurrenceTime / blockTime);
+        delete filter;
+    }
+    delete[] source;
+    delete[] signal;
+}
@@ -0,0 +1,21 @@
+#ifndef BIQUAD_BENCHMARKS_H
+#define BIQUAD_BENCHMARKS_H
+
+// Processing cost of the native biquad filters.
+class BiquadBenchmarks {
+public:
+    // Run all biquad benchmarks and print the results.
+    static void Run();
+
+private:
+    // A 10 band PEQ on each channel of a 7.1.4 system, with a filter for each band and with a single bank.
+    static void Bank();
+    // Equalizers of 10 to 30 bands on a single channel, with a filter for each band and with a merged cascade.
+    static void Cascade();
+    // Every biquad type on a single channel, against the scalar loop of the managed BiquadFilter.
+    static void Family();
+    // Every biquad type on a single channel, with the sample-by-sample recurrence and with block processing.
+    static void Block();
+};
+
+#endif // BIQUAD_BENCHMARKS_H
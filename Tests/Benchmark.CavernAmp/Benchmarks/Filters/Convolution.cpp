@@ -0,0 +1,315 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+#include "Convolution.h"
+#include "../../benchmark.h"
+#include "../../../../CavernAmp/Cavern/Filters/convolutionMatrix.h"
+#include "../../../../CavernAmp/Cavern/Filters/convolver.h"
+#include "../../../../CavernAmp/Cavern/Filters/fastConvolver.h"
+#include "../../../../CavernAmp/Cavern/Filters/multichannelConvolver.h"
+#include "../../../../CavernAmp/Cavern/Filters/multirateConvolver.h"
+#include "../../../../CavernAmp/Cavern/Filters/partitionedConvolver.h"
+#include "../../../../CavernAmp/Cavern/Filters/spikeConvolver.h"
+#include "../../../../CavernAmp/Cavern/Filters/zeroLatencyConvolver.h"
+
+// Sample rate the real-time budget of a block is calculated at.
+static const int sampleRate = 48000;
+
+// Per-block processing times of a filter on a continuous stream.
+struct BlockTime {
+    double average, worst;
+};
+
+// Process the signal block by block, and time each call. The worst block shows if a convolver can run in real time,
+// as each host callback has to finish before its deadline, not just on average.
+static BlockTime MeasureBlocks(Filter *filter, float *signal, int length, int blockSize) {
+    using clock = std::chrono::steady_clock;
+    BlockTime result { 0, 0 };
+    int blocks = 0;
+    for (int start = 0; start + blockSize <= length; start += blockSize, blocks++) {
+        clock::time_point before = clock::now();
+        filter->Process(signal + start, blockSize);
+        double elapsed = std::chrono::duration<double>(clock::now() - before).count();
+        result.average += elapsed;
+        result.worst = std::max(result.worst, elapsed);
+    }
+    g_benchmarkSink = signal[length - 1];
+    result.average /= blocks;
+    return result;
+}
+
+// Scale an impulse to unit energy, so a white noise signal keeps its level when it's filtered again and again,
+// instead of growing to infinity or fading to denormals, which would change the measured speed.
+static void NormalizeEnergy(float *impulse, int len) {
+    double energy = 0;
+    for (int i = 0; i < len; i++) {
+        energy += impulse[i] * impulse[i];
+    }
+    float gain = (float)(1 / sqrt(energy));
+    for (int i = 0; i < len; i++) {
+        impulse[i] *= gain;
+    }
+}
+
+void ConvolutionBenchmarks::Run() {
+    BlockTimes();
+    Multichannel();
+    Matrix();
+    DirectForm();
+    Sparse();
+    Multirate();
+}
+
+void ConvolutionBenchmarks::BlockTimes() {
+    const int impulseLength = 2 * sampleRate, signalLength = 10 * sampleRate;
+    float *impulse = new float[impulseLength], *signal = new float[signalLength];
+    for (int i = 0; i < impulseLength; i++) {
+        impulse[i] = ((float)rand() / RAND_MAX - .5f) * (impulseLength - i) / impulseLength;
+    }
+
+    printHeader("Convolution: 2 second impulse, per-block CPU in us (average / worst)",
+        "block | budget us |       FastConvolver | PartitionedConvolver | ZeroLatencyConvolver | latency (fast/part/zero)");
+    for (int blockSize = 64; blockSize <= 1024; blockSize <<= 2) {
+        Filter *filters[] = {
+            new FastConvolver(impulse, impulseLength),
+            new PartitionedConvolver(impulse, impulseLength, blockSize),
+            new ZeroLatencyConvolver(impulse, impulseLength)
+        };
+        printf("%5d | %9.0f", blockSize, blockSize * 1e6 / sampleRate);
+        for (Filter *filter : filters) {
+            for (int i = 0; i < signalLength; i++) {
+                signal[i] = (float)rand() / RAND_MAX - .5f;
+            }
+            BlockTime time = MeasureBlocks(filter, signal, signalLength, blockSize);
+            printf(" | %8.1f / %9.1f", time.average * 1e6, time.worst * 1e6);
+            delete filter;
+        }
+        printf(" | 0 / %d / 0\n", blockSize);
+    }
+    delete[] impulse;
+    delete[] signal;
+}
+
+void ConvolutionBenchmarks::Multichannel() {
+    const int channels = 12, blockSize = 1024;
+    float *signal = new float[channels * blockSize];
+    for (int i = 0; i < channels * blockSize; i++) {
+        signal[i] = (float)rand() / RAND_MAX - .5f;
+    }
+
+    printHeader("Convolution: 12 channels, 1024 frame blocks",
+        "impulse | one by one us | single pass us | speedup");
+    for (int impulseLength = 1024; impulseLength <= 65536; impulseLength <<= 2) {
+        float **impulses = new float*[channels];
+        for (int channel = 0; channel < channels; channel++) {
+            impulses[channel] = new float[impulseLength];
+            for (int i = 0; i < impulseLength; i++) {
+                impulses[channel][i] = (float)rand() / RAND_MAX - .5f;
+            }
+        }
+
+        FastConvolver **convolvers = new FastConvolver*[channels];
+        for (int channel = 0; channel < channels; channel++) {
+            convolvers[channel] = new FastConvolver(impulses[channel], impulseLength);
+        }
+        double oneByOne = measure([&]() {
+            for (int channel = 0; channel < channels; channel++) {
+                convolvers[channel]->Process(signal, channels * blockSize, channel, channels);
+            }
+            g_benchmarkSink = signal[0];
+        });
+        for (int channel = 0; channel < channels; channel++) {
+            delete convolvers[channel];
+        }
+        delete[] convolvers;
+
+        MultichannelConvolver multichannel(impulses, impulseLength, channels);
+        multichannel.SetMultithreaded(false);
+        double singlePass = measure([&]() {
+            multichannel.Process(signal, channels * blockSize);
+            g_benchmarkSink = signal[0];
+        });
+
+        printf("%7d | %13.1f | %14.1f | %6.2fx\n", impulseLength, oneByOne * 1e6, singlePass * 1e6, oneByOne / singlePass);
+        for (int channel = 0; channel < channels; channel++) {
+            delete[] impulses[channel];
+        }
+        delete[] impulses;
+    }
+    delete[] signal;
+}
+
+void ConvolutionBenchmarks::Matrix() {
+    const int inputs = 8, outputs = 2, blockSize = 1024;
+    float *input = new float[inputs * blockSize], *output = new float[outputs * blockSize],
+        *channel = new float[blockSize];
+    for (int i = 0; i < inputs * blockSize; i++) {
+        input[i] = (float)rand() / RAND_MAX - .5f;
+    }
+
+    printHeader("Convolution: 8 inputs to 2 outputs, 1024 frame blocks",
+        "impulse | per route us |    matrix us | speedup");
+    for (int impulseLength = 1024; impulseLength <= 65536; impulseLength <<= 2) {
+        float *impulse = new float[impulseLength];
+        for (int i = 0; i < impulseLength; i++) {
+            impulse[i] = (float)rand() / RAND_MAX - .5f;
+        }
+
+        FastConvolver **routes = new FastConvolver*[inputs * outputs];
+        ConvolutionMatrix matrix(inputs, outputs, impulseLength);
+        for (int route = 0; route < inputs * outputs; route++) {
+            routes[route] = new FastConvolver(impulse, impulseLength);
+            matrix.SetFilter(route / outputs, route % outputs, impulse, impulseLength);
+        }
+        double perRoute = measure([&]() {
+            for (int i = 0; i < outputs * blockSize; i++) {
+                output[i] = 0;
+            }
+            for (int route = 0; route < inputs * outputs; route++) {
+                int source = route / outputs, target = route % outputs;
+                for (int i = 0; i < blockSize; i++) {
+                    channel[i] = input[i * inputs + source];
+                }
+                routes[route]->Process(channel, blockSize);
+                for (int i = 0; i < blockSize; i++) {
+                    output[i * outputs + target] += channel[i];
+                }
+            }
+            g_benchmarkSink = output[0];
+        });
+        for (int route = 0; route < inputs * outputs; route++) {
+            delete routes[route];
+        }
+        delete[] routes;
+        double shared = measure([&]() {
+            matrix.Process(input, output, blockSize);
+            g_benchmarkSink = output[0];
+        });
+
+        printf("%7d | %12.1f | %12.1f | %6.2fx\n", impulseLength, perRoute * 1e6, shared * 1e6, perRoute / shared);
+        delete[] impulse;
+    }
+    delete[] input;
+    delete[] output;
+    delete[] channel;
+}
+
+void ConvolutionBenchmarks::DirectForm() {
+    const int signalLength = 65536;
+    float *signal = new float[signalLength];
+    for (int i = 0; i < signalLength; i++) {
+        signal[i] = (float)rand() / RAND_MAX - .5f;
+    }
+
+    printHeader("Convolution: direct form / FFT time of a block, * marks the factory's choice of direct form",
+        " taps |     32 |     64 |    128 |    256 |    512 |   1024 |   2048 (block size)");
+    for (int taps = 16; taps <= 1024; taps <<= 1) {
+        float *impulse = new float[taps];
+        for (int i = 0; i < taps; i++) {
+            impulse[i] = (float)rand() / RAND_MAX - .5f;
+        }
+        NormalizeEnergy(impulse, taps);
+        printf("%5d", taps);
+        for (int blockSize = 32; blockSize <= 2048; blockSize <<= 1) {
+            Convolver direct(impulse, taps, 0);
+            FastConvolver fft(impulse, taps);
+            auto processAll = [&](Filter &filter) {
+                for (int start = 0; start < signalLength; start += blockSize) {
+                    filter.Process(signal + start, blockSize);
+                }
+                g_benchmarkSink = signal[0];
+            };
+            double directTime = measure([&]() { processAll(direct); }, .05),
+                fftTime = measure([&]() { processAll(fft); }, .05);
+            Filter *optimal = Convolver::CreateOptimal(impulse, taps, 0, blockSize);
+            printf(" | %5.2f%c", directTime / fftTime, dynamic_cast<Convolver*>(optimal) ? '*' : ' ');
+            delete optimal;
+        }
+        printf("\n");
+        delete[] impulse;
+    }
+    delete[] signal;
+}
+
+void ConvolutionBenchmarks::Sparse() {
+    const int impulseLength = sampleRate, signalLength = 4 * sampleRate;
+    float *impulse = new float[impulseLength], *signal = new float[signalLength];
+    for (int i = 0; i < signalLength; i++) {
+        signal[i] = (float)rand() / RAND_MAX - .5f;
+    }
+
+    printHeader("Convolution: 1 second sparse impulse, spike / FFT time of a block (below 1: SpikeConvolver is faster)",
+        "spikes |     64 |    256 |   1024 |   4096 |  16384 (block size)");
+    for (int spikes = 1; spikes <= 4096; spikes <<= 2) {
+        for (int i = 0; i < impulseLength; i++) {
+            impulse[i] = 0;
+        }
+        for (int spike = 0; spike < spikes; spike++) {
+            impulse[(int)((long long)rand() * impulseLength / (RAND_MAX + 1LL))] = (float)rand() / RAND_MAX - .5f;
+        }
+        NormalizeEnergy(impulse, impulseLength);
+        printf("%6d", spikes);
+        for (int blockSize = 64; blockSize <= 16384; blockSize <<= 2) {
+            SpikeConvolver sparse(impulse, impulseLength, 0);
+            FastConvolver fft(impulse, impulseLength);
+            auto processAll = [&](Filter &filter) {
+                for (int start = 0; start + blockSize <= signalLength; start += blockSize) {
+                    filter.Process(signal + start, blockSize);
+                }
+                g_benchmarkSink = signal[0];
+            };
+            double sparseTime = measure([&]() { processAll(sparse); }, .1),
+                fftTime = measure([&]() { processAll(fft); }, .1);
+            printf(" | %6.3f", sparseTime / fftTime);
+        }
+        printf("\n");
+    }
+    delete[] impulse;
+    delete[] signal;
+}
+
+void ConvolutionBenchmarks::Multirate() {
+    const int impulseLength = 2 * sampleRate, signalLength = 4 * sampleRate;
+    float *impulse = new float[impulseLength], *signal = new float[signalLength];
+    for (int i = 0; i < signalLength; i++) {
+        signal[i] = (float)rand() / RAND_MAX - .5f;
+    }
+
+    // A decaying sum of random sines below 200 Hz, like a subwoofer correction
+    for (int i = 0; i < impulseLength; i++) {
+        impulse[i] = 0;
+    }
+    for (int sine = 0; sine < 20; sine++) {
+        double frequency = (20 + 180. * rand() / RAND_MAX) / sampleRate, gain = (double)rand() / RAND_MAX - .5;
+        for (int i = 0; i < impulseLength; i++) {
+            impulse[i] += (float)(gain * sin(2 * M_PI * frequency * i) * exp(-3. * i / impulseLength));
+        }
+    }
+    NormalizeEnergy(impulse, impulseLength);
+
+    printHeader("Convolution: 2 second band-limited impulse, FastConvolver / MultirateConvolver time of a block "
+        "(above 1: MultirateConvolver is faster)",
+        "factor |    256 |   1024 |   4096 |  16384 (block size)");
+    for (int factor = 8; factor <= 16; factor <<= 1) {
+        printf("%6d", factor);
+        for (int blockSize = 256; blockSize <= 16384; blockSize <<= 2) {
+            FastConvolver full(impulse, impulseLength);
+            MultirateConvolver reduced(impulse, impulseLength, factor);
+            auto processAll = [&](Filter &filter) {
+                for (int start = 0; start + blockSize <= signalLength; start += blockSize) {
+                    filter.Process(signal + start, blockSize);
+                }
+                g_benchmarkSink = signal[0];
+            };
+            double fullTime = measure([&]() { processAll(full); }, .1),
+                reducedTime = measure([&]() { processAll(reduced); }, .1);
+            printf(" | %6.2f", fullTime / reducedTime);
+        }
+        printf("\n");
+    }
+    delete[] impulse;
+    delete[] signal;
+}
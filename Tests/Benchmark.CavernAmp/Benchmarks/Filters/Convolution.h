@@ -0,0 +1,30 @@
+#ifndef CONVOLUTION_BENCHMARKS_H
+#define CONVOLUTION_BENCHMARKS_H
+
+// Processing cost of the native convolution filters.
+class ConvolutionBenchmarks {
+public:
+    // Run all convolution benchmarks and print the results.
+    static void Run();
+
+private:
+    // Average and worst-case time of a single host block with a long impulse, for each convolver.
+    static void BlockTimes();
+
+    // All channels of a 7.1.4 system convolved one by one and in a single pass.
+    static void Multichannel();
+
+    // A virtualizer's 8 inputs to 2 ears, with a convolver for each route, and with the inputs transformed once.
+    static void Matrix();
+
+    // Direct form and FFT convolution of short impulses, and which one Convolver::CreateOptimal picks.
+    static void DirectForm();
+
+    // Sparse impulses with an increasing number of spikes, convolved by SpikeConvolver and FastConvolver.
+    static void Sparse();
+
+    // A band-limited impulse convolved at the full rate by FastConvolver and at a reduced rate by MultirateConvolver.
+    static void Multirate();
+};
+
+#endif // CONVOLUTION_BENCHMARKS_H
@@ -0,0 +1,291 @@
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+#include "FFT.h"
+#include "../../benchmark.h"
+#include "../../../../CavernAmp/Cavern/Utilities/fftFourStep.h"
+#include "../../../../CavernAmp/Cavern/Utilities/fftKernels.h"
+#include "../../../../CavernAmp/Cavern/Utilities/fftPlan.h"
+#include "../../../../CavernAmp/Cavern/Utilities/measurements.h"
+#include "../../../../CavernAmp/Cavern/Utilities/qmath.h"
+
+// ============================================================
+// The recursive FFT that was used before the iterative engine,
+// kept here as the reference point of the comparison.
+// ============================================================
+struct RecursiveFFTCache {
+    int size;
+    float *sin, *cos;
+    Complex **even, **odd;
+
+    RecursiveFFTCache(int fftSize) : size(fftSize / 2) {
+        double step = -2 * M_PI / fftSize;
+        sin = new float[size];
+        cos = new float[size];
+        for (int i = 0; i < size; ++i) {
+            cos[i] = cosf(i * step);
+            sin[i] = sinf(i * step);
+        }
+        int maxDepth = Log2Int(fftSize);
+        even = new Complex*[maxDepth];
+        odd = new Complex*[maxDepth];
+        for (int depth = 0; depth < maxDepth; depth++) {
+            even[depth] = new Complex[1 << depth];
+            odd[depth] = new Complex[1 << depth];
+        }
+    }
+
+    ~RecursiveFFTCache() {
+        for (int depth = 0, maxDepth = Log2Int(size * 2); depth < maxDepth; depth++) {
+            delete[] even[depth];
+            delete[] odd[depth];
+        }
+        delete[] even;
+        delete[] odd;
+        delete[] sin;
+        delete[] cos;
+    }
+};
+
+static void RecursiveFFT(Complex *samples, int sampleCount, RecursiveFFTCache *cache, int depth) {
+    if (sampleCount == 1) {
+        return;
+    }
+    if (sampleCount == 4) {
+        Complex evenValue = samples[0], oddValue = samples[2];
+        Complex evenValue1 { evenValue.real + oddValue.real, evenValue.imaginary + oddValue.imaginary };
+        Complex evenValue2 { evenValue.real - oddValue.real, evenValue.imaginary - oddValue.imaginary };
+        evenValue = samples[1];
+        oddValue = samples[3];
+        Complex oddValue1 { evenValue.real + oddValue.real, evenValue.imaginary + oddValue.imaginary };
+        Complex oddValue2 { evenValue.real - oddValue.real, evenValue.imaginary - oddValue.imaginary };
+        samples[0] = { evenValue1.real + oddValue1.real, evenValue1.imaginary + oddValue1.imaginary };
+        samples[1] = { evenValue2.real + oddValue2.imaginary, evenValue2.imaginary - oddValue2.real };
+        samples[2] = { evenValue1.real - oddValue1.real, evenValue1.imaginary - oddValue1.imaginary };
+        samples[3] = { evenValue2.real - oddValue2.imaginary, evenValue2.imaginary + oddValue2.real };
+        return;
+    }
+    if (sampleCount == 2) {
+        Complex evenValue = samples[0], oddValue = samples[1];
+        samples[0] = { evenValue.real + oddValue.real, evenValue.imaginary + oddValue.imaginary };
+        samples[1] = { evenValue.real - oddValue.real, evenValue.imaginary - oddValue.imaginary };
+        return;
+    }
+
+    int halfLength = sampleCount / 2;
+    Complex *even = cache->even[depth], *odd = cache->odd[depth];
+    for (int sample = 0, pair = 0; sample < halfLength; sample++, pair += 2) {
+        even[sample] = samples[pair];
+        odd[sample] = samples[pair + 1];
+    }
+    RecursiveFFT(even, halfLength, cache, --depth);
+    RecursiveFFT(odd, halfLength, cache, depth);
+    int stepMul = cache->size / halfLength;
+    for (int i = 0; i < halfLength; i++) {
+        float oddReal = odd[i].real * cache->cos[i * stepMul] - odd[i].imaginary * cache->sin[i * stepMul],
+            oddImag = odd[i].real * cache->sin[i * stepMul] + odd[i].imaginary * cache->cos[i * stepMul];
+        samples[i].real = even[i].real + oddReal;
+        samples[i].imaginary = even[i].imaginary + oddImag;
+        samples[i + halfLength].real = even[i].real - oddReal;
+        samples[i + halfLength].imaginary = even[i].imaginary - oddImag;
+    }
+}
+
+// Fills an array with white noise.
+static void FillNoise(Complex *samples, int sampleCount) {
+    for (int i = 0; i < sampleCount; i++) {
+        samples[i] = { (float)rand() / RAND_MAX - .5f, (float)rand() / RAND_MAX - .5f };
+    }
+}
+
+// Standard FFT performance metric: 5 * N * log2(N) floating point operations per transform.
+static double Mflops(int sampleCount, double seconds) {
+    return 5.0 * sampleCount * Log2Int(sampleCount) / seconds * 1e-6;
+}
+
+void FFTBenchmarks::Run() {
+    IterativeVsRecursive();
+    RealVsComplex();
+    SmallSizes();
+    Batch();
+    LargeSizes();
+    PaddedLengths();
+}
+
+void FFTBenchmarks::IterativeVsRecursive() {
+    printHeader("FFT: iterative vs recursive", "      size | recursive MFLOPS | iterative MFLOPS | speedup");
+    for (int bits = 10; bits <= 20; bits += 2) {
+        int size = 1 << bits;
+        Complex *samples = new Complex[size];
+        FillNoise(samples, size);
+
+        RecursiveFFTCache *recursiveCache = new RecursiveFFTCache(size);
+        double recursive = measure([&]() {
+            RecursiveFFT(samples, size, recursiveCache, bits - 1);
+            g_benchmarkSink = samples[1].real;
+        });
+        delete recursiveCache;
+
+        FFTCache *cache = FFTCache_Create(size);
+        double iterative = measure([&]() {
+            InPlaceFFT(samples, size, cache);
+            g_benchmarkSink = samples[1].real;
+        });
+        FFTCache_Dispose(cache);
+
+        printf("%10d | %16.1f | %16.1f | %6.2fx\n", size, Mflops(size, recursive), Mflops(size, iterative), recursive / iterative);
+        delete[] samples;
+    }
+}
+
+void FFTBenchmarks::RealVsComplex() {
+    printHeader("FFT: real vs complex transform of a real signal", "      size |  complex us |     real us | speedup");
+    for (int bits = 8; bits <= 20; bits += 2) {
+        int size = 1 << bits;
+        Complex *complexSamples = new Complex[size]();
+        float *realSamples = new float[size + 2];
+        for (int i = 0; i < size; i++) {
+            realSamples[i] = complexSamples[i].real = (float)rand() / RAND_MAX - .5f;
+        }
+
+        FFTCache *cache = FFTCache_Create(size);
+        double complexTime = measure([&]() {
+            InPlaceFFT(complexSamples, size, cache);
+            g_benchmarkSink = complexSamples[1].real;
+        });
+        double realTime = measure([&]() {
+            InPlaceRealFFT(realSamples, size, cache);
+            g_benchmarkSink = realSamples[2];
+        });
+        FFTCache_Dispose(cache);
+
+        printf("%10d | %11.2f | %11.2f | %6.2fx\n", size, complexTime * 1e6, realTime * 1e6, complexTime / realTime);
+        delete[] complexSamples;
+        delete[] realSamples;
+    }
+}
+
+void FFTBenchmarks::SmallSizes() {
+    printHeader("FFT: small sizes", "      size |  complex ns |  MFLOPS |     real ns");
+    for (int size = 8; size <= 256; size <<= 1) {
+        Complex *complexSamples = new Complex[size];
+        FillNoise(complexSamples, size);
+        float *realSamples = new float[size + 2];
+        for (int i = 0; i < size; i++) {
+            realSamples[i] = complexSamples[i].real;
+        }
+
+        FFTCache *cache = FFTCache_Create(size);
+        double complexTime = measure([&]() {
+            InPlaceFFT(complexSamples, size, cache);
+            g_benchmarkSink = complexSamples[1].real;
+        });
+        double realTime = measure([&]() {
+            InPlaceRealFFT(realSamples, size, cache);
+            g_benchmarkSink = realSamples[2];
+        });
+        FFTCache_Dispose(cache);
+
+        printf("%10d | %11.1f | %7.1f | %11.1f\n", size, complexTime * 1e9, Mflops(size, complexTime), realTime * 1e9);
+        delete[] complexSamples;
+        delete[] realSamples;
+    }
+}
+
+void FFTBenchmarks::LargeSizes() {
+    printf("\nFour-step transforms are used from %d samples.\n", FourStepMinimum());
+    printHeader("FFT: direct vs four-step MFLOPS", "      size |     direct |  four-step | four-step MT");
+    for (int bits = 14; bits <= 22; bits++) {
+        int size = 1 << bits;
+        Complex *samples = new Complex[size];
+        FillNoise(samples, size);
+        FFTCache *cache = FFTCache_Create(size);
+        SplitComplexArray work(FourStepWorkLength(size)), scratch(FourStepScratchLength(size));
+        float *real = cache->work->real, *imaginary = cache->work->imaginary;
+
+        double direct = measure([&]() {
+            GatherBitReversed(samples, real, imaginary, size, cache->plan);
+            ProcessButterflies(real, imaginary, size, cache->plan, false);
+            Interleave(real, imaginary, samples, size);
+            g_benchmarkSink = samples[1].real;
+        });
+        double fourStep = measure([&]() {
+            ProcessFourStep(samples, samples, size, cache->plan, &work, &scratch, false, false);
+            g_benchmarkSink = samples[1].real;
+        });
+        double multithreaded = measure([&]() {
+            ProcessFourStep(samples, samples, size, cache->plan, &work, &scratch, false, true);
+            g_benchmarkSink = samples[1].real;
+        });
+        FFTCache_Dispose(cache);
+
+        printf("%10d | %10.1f | %10.1f | %12.1f\n", size, Mflops(size, direct), Mflops(size, fourStep),
+            Mflops(size, multithreaded));
+        delete[] samples;
+    }
+}
+
+void FFTBenchmarks::Batch() {
+    const int channels = 12;
+    printHeader("FFT: 12 channels one by one vs batched", "      size |   single us |  batched us | speedup");
+    for (int size = 64; size <= 16384; size <<= 2) {
+        Complex **signals = new Complex*[channels];
+        for (int channel = 0; channel < channels; channel++) {
+            signals[channel] = new Complex[size];
+            FillNoise(signals[channel], size);
+        }
+
+        FFTCache *cache = FFTCache_Create(size);
+        double singleTime = measure([&]() {
+            for (int channel = 0; channel < channels; channel++) {
+                InPlaceFFT(signals[channel], size, cache);
+            }
+            g_benchmarkSink = signals[0][1].real;
+        });
+        double batchTime = measure([&]() {
+            InPlaceFFTBatch(signals, channels, size, cache, false);
+            g_benchmarkSink = signals[0][1].real;
+        });
+        FFTCache_Dispose(cache);
+
+        printf("%10d | %11.2f | %11.2f | %6.2fx\n", size, singleTime * 1e6, batchTime * 1e6, singleTime / batchTime);
+        for (int channel = 0; channel < channels; channel++) {
+            delete[] signals[channel];
+        }
+        delete[] signals;
+    }
+}
+
+// Time of a forward and inverse real transform pair of the given size, as performed by a convolution.
+static double RealTransformPair(int size) {
+    float *samples = new float[size + 2];
+    for (int i = 0; i < size; i++) {
+        samples[i] = (float)rand() / RAND_MAX - .5f;
+    }
+    FFTCache *cache = FFTCache_Create(size);
+    double time = measure([&]() {
+        ProcessRealFFT(samples, size, cache);
+        ProcessRealIFFT(samples, size, cache);
+        g_benchmarkSink = samples[1];
+    });
+    FFTCache_Dispose(cache);
+    delete[] samples;
+    return time;
+}
+
+void FFTBenchmarks::PaddedLengths() {
+    printHeader("FFT: padded lengths of filters (* = picked by FFTPlan::PaddedLength)",
+        "filter length |        2^n us |      3*2^n us |      5*2^n us");
+    const int filterLengths[] = { 3000, 10000, 20000, 48000, 80000, 192000 };
+    for (int filterLength : filterLengths) {
+        int minimum = 2 * filterLength, picked = FFTPlan::PaddedLength(minimum);
+        printf("%13d |", filterLength);
+        const int factors[] = { 1, 3, 5 };
+        for (int factor : factors) {
+            int size = factor << Log2Ceil((minimum + factor - 1) / factor);
+            printf(" %7d%c%5.0f |", size, size == picked ? '*' : ' ', RealTransformPair(size) * 1e6);
+        }
+        printf("\n");
+    }
+}
@@ -0,0 +1,30 @@
+#ifndef FFT_BENCHMARKS_H
+#define FFT_BENCHMARKS_H
+
+// Throughput of the native FFT engine.
+class FFTBenchmarks {
+public:
+    // Run all FFT benchmarks and print the results.
+    static void Run();
+
+private:
+    // Iterative in-place FFT compared to the recursive even/odd split it replaced.
+    static void IterativeVsRecursive();
+
+    // Packed real FFT compared to a complex FFT of a real signal.
+    static void RealVsComplex();
+
+    // Transforms of the small sizes used by low-latency partitioned convolution.
+    static void SmallSizes();
+
+    // Transforms of large sizes with all butterfly stages on the whole signal, and in four steps on the rows and columns.
+    static void LargeSizes();
+
+    // Transforms of all channels of a 7.1.4 system one by one and in a single batch.
+    static void Batch();
+
+    // Real transform pairs of the power of two, 3 * 2^n, and 5 * 2^n sizes a FastConvolver could pad a filter to.
+    static void PaddedLengths();
+};
+
+#endif // FFT_BENCHMARKS_H
@@ -0,0 +1,27 @@
+@echo off
+setlocal enabledelayedexpansion
+
+echo === Building Benchmark.CavernAmp ===
+
+rem The benchmarks reach internal classes too, so CavernAmp is compiled in instead of loaded as a DLL
+set "SOURCES="
+for /R "..\..\CavernAmp" %%F in (*.cpp *.c) do (
+    set "SOURCES=!SOURCES! "%%F""
+)
+
+g++.exe -o Benchmark.CavernAmp.exe ^
+    Benchmarks/Filters/Biquad.cpp ^
+    Benchmarks/Filters/Convolution.cpp ^
+    Benchmarks/Utilities/FFT.cpp ^
+    main.cpp ^
+    !SOURCES! ^
+    -std=c++17 -march=corei7-avx -fexpensive-optimizations -O2 -m64 -DBUILD_DLL -static-libgcc -static-libstdc++ -static
+
+if errorlevel 1 (
+    echo ERROR: build failed.
+    exit /b 1
+)
+
+echo === Running benchmarks ===
+Benchmark.CavernAmp.exe
+exit /b !errorlevel!
@@ -0,0 +1,44 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <chrono>
+#include <cstdio>
+
+// ============================================================
+// Benchmark Framework - A minimal header-only timing library
+//
+// Usage:
+//   1. #include "benchmark.h" in your benchmark file
+//   2. Wrap the measured operation in a lambda
+//   3. Call measure(fn) to get the average seconds per call
+//   4. Print a table with printHeader, then one printf per row
+// ============================================================
+
+// --- Minimum time spent measuring a single operation ---
+inline constexpr double MIN_SECONDS = 0.25;
+
+// --- Prevents the optimizer from removing results that are never read ---
+inline volatile float g_benchmarkSink = 0;
+
+// --- Returns the average seconds one call of fn takes, after a warmup call ---
+template<typename Fn>
+inline double measure(Fn fn, double minSeconds = MIN_SECONDS) {
+    using clock = std::chrono::steady_clock;
+    fn();
+    long long calls = 0;
+    clock::time_point start = clock::now();
+    double elapsed = 0;
+    do {
+        fn();
+        ++calls;
+        elapsed = std::chrono::duration<double>(clock::now() - start).count();
+    } while (elapsed < minSeconds);
+    return elapsed / calls;
+}
+
+// --- Table output ---
+inline void printHeader(const char* name, const char* columns) {
+    printf("\n%s\n%s\n", name, columns);
+}
+
+#endif // BENCHMARK_H
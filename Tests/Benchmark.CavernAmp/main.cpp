@@ -0,0 +1,12 @@
+#include <cstdio>
+#include "Benchmarks/Filters/Biquad.h"
+#include "Benchmarks/Filters/Convolution.h"
+#include "Benchmarks/Utilities/FFT.h"
+
+int main() {
+    printf("=== CavernAmp benchmarks ===\n");
+    FFTBenchmarks::Run();
+    ConvolutionBenchmarks::Run();
+    BiquadBenchmarks::Run();
+    return 0;
+}
@@ -0,0 +1,66 @@
+#include "BiquadBank.h"
+#include <cstdio>
+
+BiquadBankLoader::BiquadBankLoader()
+    : m_pCreate(nullptr)
+    , m_pSetBiquad(nullptr)
+    , m_pReset(nullptr)
+    , m_pProcess(nullptr)
+    , m_pDispose(nullptr)
+    , m_pFilterProcessChannel(nullptr)
+{
+}
+
+BiquadBankLoader::~BiquadBankLoader() {
+}
+
+bool BiquadBankLoader::Load(const wchar_t* dllPath) {
+    if (!DllLoader::Load(dllPath)) {
+        return false;
+    }
+
+    m_pCreate = reinterpret_cast<CreateFn>(GetProcAddress(GetHandle(), "BiquadBank_Create"));
+    m_pSetBiquad = reinterpret_cast<SetBiquadFn>(GetProcAddress(GetHandle(), "BiquadBank_SetBiquad"));
+    m_pReset = reinterpret_cast<ResetFn>(GetProcAddress(GetHandle(), "BiquadBank_Reset"));
+    m_pProcess = reinterpret_cast<ProcessFn>(GetProcAddress(GetHandle(), "BiquadBank_Process"));
+    m_pDispose = reinterpret_cast<DisposeFn>(GetProcAddress(GetHandle(), "BiquadBank_Dispose"));
+    m_pFilterProcessChannel = reinterpret_cast<ProcessChannelFn>(GetProcAddress(GetHandle(), "Filter_ProcessChannel"));
+
+    if (!m_pCreate || !m_pSetBiquad || !m_pReset || !m_pProcess || !m_pDispose || !m_pFilterProcessChannel) {
+        fprintf(stderr, "FATAL: Could not resolve DLL exports (error %lu)\n", GetLastError());
+        Unload();
+        return false;
+    }
+
+    return true;
+}
+
+void* BiquadBankLoader::Create(int channels, int bands) {
+    if (!m_pCreate) return nullptr;
+    return m_pCreate(channels, bands);
+}
+
+bool BiquadBankLoader::SetBiquad(void* bank, int channel, int band, float b0, float b1, float b2, float a1, float a2) {
+    if (!m_pSetBiquad) return false;
+    return m_pSetBiquad(bank, channel, band, b0, b1, b2, a1, a2);
+}
+
+void BiquadBankLoader::Reset(void* bank) {
+    if (!m_pReset) return;
+    m_pReset(bank);
+}
+
+void BiquadBankLoader::Process(void* bank, float* samples, int len) {
+    if (!m_pProcess) return;
+    m_pProcess(bank, samples, len);
+}
+
+void BiquadBankLoader::Dispose(void* bank) {
+    if (!m_pDispose) return;
+    m_pDispose(bank);
+}
+
+void BiquadBankLoader::FilterProcessChannel(void* filter, float* samples, int len, int channel, int channels) {
+    if (!m_pFilterProcessChannel) return;
+    m_pFilterProcessChannel(filter, samples, len, channel, channels);
+}
@@ -0,0 +1,41 @@
+#ifndef BIQUADBANK_LOADER_H
+#define BIQUADBANK_LOADER_H
+
+#include "../DllLoader.h"
+
+class BiquadBankLoader : public DllLoader {
+public:
+    BiquadBankLoader();
+    ~BiquadBankLoader();
+
+    // Load DLL and resolve BiquadBank-specific function pointers
+    bool Load(const wchar_t* dllPath) override;
+
+    // --- Exported API (proxied to DLL) ---
+    void* Create(int channels, int bands);
+    bool  SetBiquad(void* bank, int channel, int band, float b0, float b1, float b2, float a1, float a2);
+    void  Reset(void* bank);
+    void  Process(void* bank, float* samples, int len);
+    void  Dispose(void* bank);
+    // Filtering the channels from an offset of a signal with more channels is only exported through Filter
+    void  FilterProcessChannel(void* filter, float* samples, int len, int channel, int channels);
+
+protected:
+    // Function pointer types
+    typedef void* (*CreateFn)(int, int);
+    typedef bool  (*SetBiquadFn)(void*, int, int, float, float, float, float, float);
+    typedef void  (*ResetFn)(void*);
+    typedef void  (*ProcessFn)(void*, float*, int);
+    typedef void  (*DisposeFn)(void*);
+    typedef void  (*ProcessChannelFn)(void*, float*, int, int, int);
+
+    // Function pointers
+    CreateFn   m_pCreate;
+    SetBiquadFn   m_pSetBiquad;
+    ResetFn   m_pReset;
+    ProcessFn   m_pProcess;
+    DisposeFn   m_pDispose;
+    ProcessChannelFn   m_pFilterProcessChannel;
+};
+
+#endif // BIQUADBANK_LOADER_H
@@ -0,0 +1,59 @@
+#include "BiquadCascade.h"
+#include <cstdio>
+
+BiquadCascadeLoader::BiquadCascadeLoader()
+    : m_pCreate(nullptr)
+    , m_pSetSection(nullptr)
+    , m_pReset(nullptr)
+    , m_pProcess(nullptr)
+    , m_pDispose(nullptr)
+{
+}
+
+BiquadCascadeLoader::~BiquadCascadeLoader() {
+}
+
+bool BiquadCascadeLoader::Load(const wchar_t* dllPath) {
+    if (!DllLoader::Load(dllPath)) {
+        return false;
+    }
+
+    m_pCreate = reinterpret_cast<CreateFn>(GetProcAddress(GetHandle(), "BiquadCascade_Create"));
+    m_pSetSection = reinterpret_cast<SetSectionFn>(GetProcAddress(GetHandle(), "BiquadCascade_SetSection"));
+    m_pReset = reinterpret_cast<ResetFn>(GetProcAddress(GetHandle(), "BiquadCascade_Reset"));
+    m_pProcess = reinterpret_cast<ProcessFn>(GetProcAddress(GetHandle(), "BiquadCascade_Process"));
+    m_pDispose = reinterpret_cast<DisposeFn>(GetProcAddress(GetHandle(), "BiquadCascade_Dispose"));
+
+    if (!m_pCreate || !m_pSetSection || !m_pReset || !m_pProcess || !m_pDispose) {
+        fprintf(stderr, "FATAL: Could not resolve DLL exports (error %lu)\n", GetLastError());
+        Unload();
+        return false;
+    }
+
+    return true;
+}
+
+void* BiquadCascadeLoader::Create(int sections, bool doublePrecision) {
+    if (!m_pCreate) return nullptr;
+    return m_pCreate(sections, doublePrecision);
+}
+
+bool BiquadCascadeLoader::SetSection(void* cascade, int section, float b0, float b1, float b2, float a1, float a2) {
+    if (!m_pSetSection) return false;
+    return m_pSetSection(cascade, section, b0, b1, b2, a1, a2);
+}
+
+void BiquadCascadeLoader::Reset(void* cascade) {
+    if (!m_pReset) return;
+    m_pReset(cascade);
+}
+
+void BiquadCascadeLoader::Process(void* cascade, float* samples, int len, int channel, int channels) {
+    if (!m_pProcess) return;
+    m_pProcess(cascade, samples, len, channel, channels);
+}
+
+void BiquadCascadeLoader::Dispose(void* cascade) {
+    if (!m_pDispose) return;
+    m_pDispose(cascade);
+}
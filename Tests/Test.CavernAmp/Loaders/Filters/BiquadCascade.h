@@ -0,0 +1,37 @@
+#ifndef BIQUADCASCADE_LOADER_H
+#define BIQUADCASCADE_LOADER_H
+
+#include "../DllLoader.h"
+
+class BiquadCascadeLoader : public DllLoader {
+public:
+    BiquadCascadeLoader();
+    ~BiquadCascadeLoader();
+
+    // Load DLL and resolve BiquadCascade-specific function pointers
+    bool Load(const wchar_t* dllPath) override;
+
+    // --- Exported API (proxied to DLL) ---
+    void* Create(int sections, bool doublePrecision);
+    bool  SetSection(void* cascade, int section, float b0, float b1, float b2, float a1, float a2);
+    void  Reset(void* cascade);
+    void  Process(void* cascade, float* samples, int len, int channel, int channels);
+    void  Dispose(void* cascade);
+
+protected:
+    // Function pointer types
+    typedef void* (*CreateFn)(int, bool);
+    typedef bool  (*SetSectionFn)(void*, int, float, float, float, float, float);
+    typedef void  (*ResetFn)(void*);
+    typedef void  (*ProcessFn)(void*, float*, int, int, int);
+    typedef void  (*DisposeFn)(void*);
+
+    // Function pointers
+    CreateFn   m_pCreate;
+    SetSectionFn   m_pSetSection;
+    ResetFn   m_pReset;
+    ProcessFn   m_pProcess;
+    DisposeFn   m_pDispose;
+};
+
+#endif // BIQUADCASCADE_LOADER_H
@@ -0,0 +1,102 @@
+#include "BiquadFilter.h"
+#include <cstdio>
+
+BiquadFilterLoader::BiquadFilterLoader()
+    : m_pCreate(nullptr)
+    , m_pSetCenterFreq(nullptr)
+    , m_pGetBlockProcessing(nullptr)
+    , m_pSetBlockProcessing(nullptr)
+    , m_pGetB0(nullptr)
+    , m_pGetB1(nullptr)
+    , m_pGetB2(nullptr)
+    , m_pGetA1(nullptr)
+    , m_pGetA2(nullptr)
+    , m_pProcess(nullptr)
+    , m_pDispose(nullptr)
+{
+}
+
+BiquadFilterLoader::~BiquadFilterLoader() {
+}
+
+bool BiquadFilterLoader::Load(const wchar_t* dllPath) {
+    if (!DllLoader::Load(dllPath)) {
+        return false;
+    }
+
+    m_pCreate = reinterpret_cast<CreateFn>(GetProcAddress(GetHandle(), "BiquadFilter_Create"));
+    m_pSetCenterFreq = reinterpret_cast<SetCenterFreqFn>(GetProcAddress(GetHandle(), "BiquadFilter_SetCenterFreq"));
+    m_pGetBlockProcessing = reinterpret_cast<GetBlockProcessingFn>(GetProcAddress(GetHandle(), "BiquadFilter_GetBlockProcessing"));
+    m_pSetBlockProcessing = reinterpret_cast<SetBlockProcessingFn>(GetProcAddress(GetHandle(), "BiquadFilter_SetBlockProcessing"));
+    m_pGetB0 = reinterpret_cast<GetCoefficientFn>(GetProcAddress(GetHandle(), "BiquadFilter_GetB0"));
+    m_pGetB1 = reinterpret_cast<GetCoefficientFn>(GetProcAddress(GetHandle(), "BiquadFilter_GetB1"));
+    m_pGetB2 = reinterpret_cast<GetCoefficientFn>(GetProcAddress(GetHandle(), "BiquadFilter_GetB2"));
+    m_pGetA1 = reinterpret_cast<GetCoefficientFn>(GetProcAddress(GetHandle(), "BiquadFilter_GetA1"));
+    m_pGetA2 = reinterpret_cast<GetCoefficientFn>(GetProcAddress(GetHandle(), "BiquadFilter_GetA2"));
+    m_pProcess = reinterpret_cast<ProcessFn>(GetProcAddress(GetHandle(), "Filter_Process"));
+    m_pDispose = reinterpret_cast<DisposeFn>(GetProcAddress(GetHandle(), "Filter_Dispose"));
+
+    if (!m_pCreate || !m_pSetCenterFreq || !m_pGetBlockProcessing || !m_pSetBlockProcessing || !m_pGetB0 ||
+        !m_pGetB1 || !m_pGetB2 || !m_pGetA1 || !m_pGetA2 || !m_pProcess || !m_pDispose) {
+        fprintf(stderr, "FATAL: Could not resolve DLL exports (error %lu)\n", GetLastError());
+        Unload();
+        return false;
+    }
+
+    return true;
+}
+
+void* BiquadFilterLoader::Create(int type, int sampleRate, double centerFreq, double q, double gain) {
+    if (!m_pCreate) return nullptr;
+    return m_pCreate(type, sampleRate, centerFreq, q, gain);
+}
+
+void BiquadFilterLoader::SetCenterFreq(void* filter, double centerFreq) {
+    if (!m_pSetCenterFreq) return;
+    m_pSetCenterFreq(filter, centerFreq);
+}
+
+bool BiquadFilterLoader::GetBlockProcessing(void* filter) {
+    if (!m_pGetBlockProcessing) return false;
+    return m_pGetBlockProcessing(filter);
+}
+
+void BiquadFilterLoader::SetBlockProcessing(void* filter, bool enabled) {
+    if (!m_pSetBlockProcessing) return;
+    m_pSetBlockProcessing(filter, enabled);
+}
+
+float BiquadFilterLoader::GetB0(void* filter) {
+    if (!m_pGetB0) return 0;
+    return m_pGetB0(filter);
+}
+
+float BiquadFilterLoader::GetB1(void* filter) {
+    if (!m_pGetB1) return 0;
+    return m_pGetB1(filter);
+}
+
+float BiquadFilterLoader::GetB2(void* filter) {
+    if (!m_pGetB2) return 0;
+    return m_pGetB2(filter);
+}
+
+float BiquadFilterLoader::GetA1(void* filter) {
+    if (!m_pGetA1) return 0;
+    return m_pGetA1(filter);
+}
+
+float BiquadFilterLoader::GetA2(void* filter) {
+    if (!m_pGetA2) return 0;
+    return m_pGetA2(filter);
+}
+
+void BiquadFilterLoader::Process(void* filter, float* samples, int len) {
+    if (!m_pProcess) return;
+    m_pProcess(filter, samples, len);
+}
+
+void BiquadFilterLoader::Dispose(void* filter) {
+    if (!m_pDispose) return;
+    m_pDispose(filter);
+}
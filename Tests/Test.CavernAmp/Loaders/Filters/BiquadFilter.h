@@ -0,0 +1,51 @@
+#ifndef BIQUADFILTER_LOADER_H
+#define BIQUADFILTER_LOADER_H
+
+#include "../DllLoader.h"
+
+class BiquadFilterLoader : public DllLoader {
+public:
+    BiquadFilterLoader();
+    ~BiquadFilterLoader();
+
+    // Load DLL and resolve BiquadFilter-specific function pointers
+    bool Load(const wchar_t* dllPath) override;
+
+    // --- Exported API (proxied to DLL) ---
+    void*  Create(int type, int sampleRate, double centerFreq, double q, double gain);
+    void   SetCenterFreq(void* filter, double centerFreq);
+    bool   GetBlockProcessing(void* filter);
+    void   SetBlockProcessing(void* filter, bool enabled);
+    float  GetB0(void* filter);
+    float  GetB1(void* filter);
+    float  GetB2(void* filter);
+    float  GetA1(void* filter);
+    float  GetA2(void* filter);
+    void   Process(void* filter, float* samples, int len);
+    void   Dispose(void* filter);
+
+protected:
+    // Function pointer types
+    typedef void* (*CreateFn)(int, int, double, double, double);
+    typedef void  (*SetCenterFreqFn)(void*, double);
+    typedef bool  (*GetBlockProcessingFn)(void*);
+    typedef void  (*SetBlockProcessingFn)(void*, bool);
+    typedef float (*GetCoefficientFn)(void*);
+    typedef void  (*ProcessFn)(void*, float*, int);
+    typedef void  (*DisposeFn)(void*);
+
+    // Function pointers
+    CreateFn   m_pCreate;
+    SetCenterFreqFn   m_pSetCenterFreq;
+    GetBlockProcessingFn   m_pGetBlockProcessing;
+    SetBlockProcessingFn   m_pSetBlockProcessing;
+    GetCoefficientFn   m_pGetB0;
+    GetCoefficientFn   m_pGetB1;
+    GetCoefficientFn   m_pGetB2;
+    GetCoefficientFn   m_pGetA1;
+    GetCoefficientFn   m_pGetA2;
+    ProcessFn   m_pProcess;
+    DisposeFn   m_pDispose;
+};
+
+#endif // BIQUADFILTER_LOADER_H
@@ -0,0 +1,66 @@
+#include "ConvolutionMatrix.h"
+#include <cstdio>
+
+ConvolutionMatrixLoader::ConvolutionMatrixLoader()
+    : m_pCreate(nullptr)
+    , m_pGetMaxLength(nullptr)
+    , m_pSetFilter(nullptr)
+    , m_pSetMultithreaded(nullptr)
+    , m_pProcess(nullptr)
+    , m_pDispose(nullptr)
+{
+}
+
+ConvolutionMatrixLoader::~ConvolutionMatrixLoader() {
+}
+
+bool ConvolutionMatrixLoader::Load(const wchar_t* dllPath) {
+    if (!DllLoader::Load(dllPath)) {
+        return false;
+    }
+
+    m_pCreate = reinterpret_cast<CreateFn>(GetProcAddress(GetHandle(), "ConvolutionMatrix_Create"));
+    m_pGetMaxLength = reinterpret_cast<GetMaxLengthFn>(GetProcAddress(GetHandle(), "ConvolutionMatrix_GetMaxLength"));
+    m_pSetFilter = reinterpret_cast<SetFilterFn>(GetProcAddress(GetHandle(), "ConvolutionMatrix_SetFilter"));
+    m_pSetMultithreaded = reinterpret_cast<SetMultithreadedFn>(GetProcAddress(GetHandle(), "ConvolutionMatrix_SetMultithreaded"));
+    m_pProcess = reinterpret_cast<ProcessFn>(GetProcAddress(GetHandle(), "ConvolutionMatrix_Process"));
+    m_pDispose = reinterpret_cast<DisposeFn>(GetProcAddress(GetHandle(), "ConvolutionMatrix_Dispose"));
+
+    if (!m_pCreate || !m_pGetMaxLength || !m_pSetFilter || !m_pSetMultithreaded || !m_pProcess || !m_pDispose) {
+        fprintf(stderr, "FATAL: Could not resolve DLL exports (error %lu)\n", GetLastError());
+        Unload();
+        return false;
+    }
+
+    return true;
+}
+
+void* ConvolutionMatrixLoader::Create(int inputs, int outputs, int maxLength) {
+    if (!m_pCreate) return nullptr;
+    return m_pCreate(inputs, outputs, maxLength);
+}
+
+int ConvolutionMatrixLoader::GetMaxLength(void* matrix) {
+    if (!m_pGetMaxLength) return 0;
+    return m_pGetMaxLength(matrix);
+}
+
+bool ConvolutionMatrixLoader::SetFilter(void* matrix, int input, int output, const float* impulse, int len) {
+    if (!m_pSetFilter) return false;
+    return m_pSetFilter(matrix, input, output, impulse, len);
+}
+
+void ConvolutionMatrixLoader::SetMultithreaded(void* matrix, bool multithreaded) {
+    if (!m_pSetMultithreaded) return;
+    m_pSetMultithreaded(matrix, multithreaded);
+}
+
+void ConvolutionMatrixLoader::Process(void* matrix, const float* input, float* output, int frames) {
+    if (!m_pProcess) return;
+    m_pProcess(matrix, input, output, frames);
+}
+
+void ConvolutionMatrixLoader::Dispose(void* matrix) {
+    if (!m_pDispose) return;
+    m_pDispose(matrix);
+}
@@ -0,0 +1,40 @@
+#ifndef CONVOLUTIONMATRIX_LOADER_H
+#define CONVOLUTIONMATRIX_LOADER_H
+
+#include "../DllLoader.h"
+
+class ConvolutionMatrixLoader : public DllLoader {
+public:
+    ConvolutionMatrixLoader();
+    ~ConvolutionMatrixLoader();
+
+    // Load DLL and resolve ConvolutionMatrix-specific function pointers
+    bool Load(const wchar_t* dllPath) override;
+
+    // --- Exported API (proxied to DLL) ---
+    void* Create(int inputs, int outputs, int maxLength);
+    int   GetMaxLength(void* matrix);
+    bool  SetFilter(void* matrix, int input, int output, const float* impulse, int len);
+    void  SetMultithreaded(void* matrix, bool multithreaded);
+    void  Process(void* matrix, const float* input, float* output, int frames);
+    void  Dispose(void* matrix);
+
+protected:
+    // Function pointer types
+    typedef void* (*CreateFn)(int, int, int);
+    typedef int   (*GetMaxLengthFn)(void*);
+    typedef bool  (*SetFilterFn)(void*, int, int, const float*, int);
+    typedef void  (*SetMultithreadedFn)(void*, bool);
+    typedef void  (*ProcessFn)(void*, const float*, float*, int);
+    typedef void  (*DisposeFn)(void*);
+
+    // Function pointers
+    CreateFn   m_pCreate;
+    GetMaxLengthFn   m_pGetMaxLength;
+    SetFilterFn   m_pSetFilter;
+    SetMultithreadedFn   m_pSetMultithreaded;
+    ProcessFn   m_pProcess;
+    DisposeFn   m_pDispose;
+};
+
+#endif // CONVOLUTIONMATRIX_LOADER_H
@@ -0,0 +1,66 @@
+#include "Convolver.h"
+#include <cstdio>
+
+ConvolverLoader::ConvolverLoader()
+    : m_pCreate(nullptr)
+    , m_pCreateOptimal(nullptr)
+    , m_pProcess(nullptr)
+    , m_pDispose(nullptr)
+    , m_pFilterProcessChannel(nullptr)
+    , m_pFilterDispose(nullptr)
+{
+}
+
+ConvolverLoader::~ConvolverLoader() {
+}
+
+bool ConvolverLoader::Load(const wchar_t* dllPath) {
+    if (!DllLoader::Load(dllPath)) {
+        return false;
+    }
+
+    m_pCreate = reinterpret_cast<CreateFn>(GetProcAddress(GetHandle(), "Convolver_Create"));
+    m_pCreateOptimal = reinterpret_cast<CreateOptimalFn>(GetProcAddress(GetHandle(), "Convolver_CreateOptimal"));
+    m_pProcess = reinterpret_cast<ProcessFn>(GetProcAddress(GetHandle(), "Convolver_Process"));
+    m_pDispose = reinterpret_cast<DisposeFn>(GetProcAddress(GetHandle(), "Convolver_Dispose"));
+    m_pFilterProcessChannel = reinterpret_cast<ProcessFn>(GetProcAddress(GetHandle(), "Filter_ProcessChannel"));
+    m_pFilterDispose = reinterpret_cast<DisposeFn>(GetProcAddress(GetHandle(), "Filter_Dispose"));
+
+    if (!m_pCreate || !m_pCreateOptimal || !m_pProcess || !m_pDispose || !m_pFilterProcessChannel || !m_pFilterDispose) {
+        fprintf(stderr, "FATAL: Could not resolve DLL exports (error %lu)\n", GetLastError());
+        Unload();
+        return false;
+    }
+
+    return true;
+}
+
+void* ConvolverLoader::Create(const float* impulse, int len, int delay) {
+    if (!m_pCreate) return nullptr;
+    return m_pCreate(impulse, len, delay);
+}
+
+void* ConvolverLoader::CreateOptimal(const float* impulse, int len, int delay, int blockSize) {
+    if (!m_pCreateOptimal) return nullptr;
+    return m_pCreateOptimal(impulse, len, delay, blockSize);
+}
+
+void ConvolverLoader::Process(void* convolver, float* samples, int len, int channel, int channels) {
+    if (!m_pProcess) return;
+    m_pProcess(convolver, samples, len, channel, channels);
+}
+
+void ConvolverLoader::Dispose(void* convolver) {
+    if (!m_pDispose) return;
+    m_pDispose(convolver);
+}
+
+void ConvolverLoader::FilterProcessChannel(void* filter, float* samples, int len, int channel, int channels) {
+    if (!m_pFilterProcessChannel) return;
+    m_pFilterProcessChannel(filter, samples, len, channel, channels);
+}
+
+void ConvolverLoader::FilterDispose(void* filter) {
+    if (!m_pFilterDispose) return;
+    m_pFilterDispose(filter);
+}
@@ -0,0 +1,39 @@
+#ifndef CONVOLVER_LOADER_H
+#define CONVOLVER_LOADER_H
+
+#include "../DllLoader.h"
+
+class ConvolverLoader : public DllLoader {
+public:
+    ConvolverLoader();
+    ~ConvolverLoader();
+
+    // Load DLL and resolve Convolver-specific function pointers
+    bool Load(const wchar_t* dllPath) override;
+
+    // --- Exported API (proxied to DLL) ---
+    void* Create(const float* impulse, int len, int delay);
+    void* CreateOptimal(const float* impulse, int len, int delay, int blockSize);
+    void  Process(void* convolver, float* samples, int len, int channel, int channels);
+    void  Dispose(void* convolver);
+    // The result of CreateOptimal can be any filter, and is used with the Filter exports
+    void  FilterProcessChannel(void* filter, float* samples, int len, int channel, int channels);
+    void  FilterDispose(void* filter);
+
+protected:
+    // Function pointer types
+    typedef void* (*CreateFn)(const float*, int, int);
+    typedef void* (*CreateOptimalFn)(const float*, int, int, int);
+    typedef void  (*ProcessFn)(void*, float*, int, int, int);
+    typedef void  (*DisposeFn)(void*);
+
+    // Function pointers
+    CreateFn   m_pCreate;
+    CreateOptimalFn   m_pCreateOptimal;
+    ProcessFn   m_pProcess;
+    DisposeFn   m_pDispose;
+    ProcessFn   m_pFilterProcessChannel;
+    DisposeFn   m_pFilterDispose;
+};
+
+#endif // CONVOLVER_LOADER_H
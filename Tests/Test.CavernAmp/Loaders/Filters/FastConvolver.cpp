@@ -5,9 +5,16 @@
 FastConvolverLoader::FastConvolverLoader()
     : m_pCreate(nullptr)
     , m_pGetLength(nullptr)
+    , m_pGetMemoryUsage(nullptr)
+    , m_pGetSpectrumMemoryUsage(nullptr)
     , m_pGetFilter(nullptr)
+    , m_pSetImpulse(nullptr)
+    , m_pGetTimeslots(nullptr)
+    , m_pGetSkippedTimeslots(nullptr)
+    , m_pGetDrainedTimeslots(nullptr)
     , m_pProcess(nullptr)
     , m_pDispose(nullptr)
+    , m_pClone(nullptr)
 {
 }
 
@@ -21,11 +28,20 @@ bool FastConvolverLoader::Load(const wchar_t* dllPath) {
 
     m_pCreate = reinterpret_cast<CreateFn>(GetProcAddress(GetHandle(), "FastConvolver_Create"));
     m_pGetLength = reinterpret_cast<GetLengthFn>(GetProcAddress(GetHandle(), "FastConvolver_GetLength"));
+    m_pGetMemoryUsage = reinterpret_cast<GetCounterFn>(GetProcAddress(GetHandle(), "FastConvolver_GetMemoryUsage"));
+    m_pGetSpectrumMemoryUsage = reinterpret_cast<GetTotalFn>(GetProcAddress(GetHandle(), "FilterSpectrum_GetMemoryUsage"));
     m_pGetFilter = reinterpret_cast<GetFilterFn>(GetProcAddress(GetHandle(), "FastConvolver_GetFilter"));
+    m_pSetImpulse = reinterpret_cast<SetImpulseFn>(GetProcAddress(GetHandle(), "FastConvolver_SetImpulse"));
+    m_pGetTimeslots = reinterpret_cast<GetCounterFn>(GetProcAddress(GetHandle(), "FastConvolver_GetTimeslots"));
+    m_pGetSkippedTimeslots = reinterpret_cast<GetCounterFn>(GetProcAddress(GetHandle(), "FastConvolver_GetSkippedTimeslots"));
+    m_pGetDrainedTimeslots = reinterpret_cast<GetCounterFn>(GetProcAddress(GetHandle(), "FastConvolver_GetDrainedTimeslots"));
     m_pProcess = reinterpret_cast<ProcessFn>(GetProcAddress(GetHandle(), "FastConvolver_Process"));
     m_pDispose = reinterpret_cast<DisposeFn>(GetProcAddress(GetHandle(), "FastConvolver_Dispose"));
+    m_pClone = reinterpret_cast<CloneFn>(GetProcAddress(GetHandle(), "Filter_Clone"));
 
-    if (!m_pCreate || !m_pGetLength || !m_pGetFilter || !m_pProcess || !m_pDispose) {
+    if (!m_pCreate || !m_pGetLength || !m_pGetMemoryUsage || !m_pGetSpectrumMemoryUsage || !m_pGetFilter ||
+        !m_pSetImpulse || !m_pGetTimeslots || !m_pGetSkippedTimeslots || !m_pGetDrainedTimeslots || !m_pProcess ||
+        !m_pDispose || !m_pClone) {
         fprintf(stderr, "FATAL: Could not resolve DLL exports (error %lu)\n", GetLastError());
         Unload();
         return false;
@@ -44,11 +60,41 @@ int FastConvolverLoader::GetLength(void* convolver) {
     return m_pGetLength(convolver);
 }
 
+long long FastConvolverLoader::GetMemoryUsage(void* convolver) {
+    if (!m_pGetMemoryUsage) return 0;
+    return m_pGetMemoryUsage(convolver);
+}
+
+long long FastConvolverLoader::GetSpectrumMemoryUsage() {
+    if (!m_pGetSpectrumMemoryUsage) return 0;
+    return m_pGetSpectrumMemoryUsage();
+}
+
 void FastConvolverLoader::GetFilter(void* convolver, float* outFilter) {
     if (!m_pGetFilter) return;
     m_pGetFilter(convolver, outFilter);
 }
 
+bool FastConvolverLoader::SetImpulse(void* convolver, const float* impulse, int len) {
+    if (!m_pSetImpulse) return false;
+    return m_pSetImpulse(convolver, impulse, len);
+}
+
+long long FastConvolverLoader::GetTimeslots(void* convolver) {
+    if (!m_pGetTimeslots) return 0;
+    return m_pGetTimeslots(convolver);
+}
+
+long long FastConvolverLoader::GetSkippedTimeslots(void* convolver) {
+    if (!m_pGetSkippedTimeslots) return 0;
+    return m_pGetSkippedTimeslots(convolver);
+}
+
+long long FastConvolverLoader::GetDrainedTimeslots(void* convolver) {
+    if (!m_pGetDrainedTimeslots) return 0;
+    return m_pGetDrainedTimeslots(convolver);
+}
+
 void FastConvolverLoader::Process(void* convolver, float* output, int sampleCount, int delay, int numChannels) {
     if (!m_pProcess) return;
     m_pProcess(convolver, output, sampleCount, delay, numChannels);
@@ -58,3 +104,8 @@ void FastConvolverLoader::Dispose(void* convolver) {
     if (!m_pDispose) return;
     m_pDispose(convolver);
 }
+
+void* FastConvolverLoader::Clone(void* convolver) {
+    if (!m_pClone) return nullptr;
+    return m_pClone(convolver);
+}
@@ -14,24 +14,44 @@ public:
     // --- Exported API (proxied to DLL) ---
     void* Create(const float* filter, int filterLength, int delay);
     int   GetLength(void* convolver);
+    long long GetMemoryUsage(void* convolver);
+    // Memory used by all filter spectra, shared spectra are counted once
+    long long GetSpectrumMemoryUsage();
     void  GetFilter(void* convolver, float* outFilter);
+    bool  SetImpulse(void* convolver, const float* impulse, int len);
+    long long GetTimeslots(void* convolver);
+    long long GetSkippedTimeslots(void* convolver);
+    long long GetDrainedTimeslots(void* convolver);
     void  Process(void* convolver, float* output, int sampleCount, int delay, int numChannels);
     void  Dispose(void* convolver);
+    // Copies share the filter spectrum of the original
+    void* Clone(void* convolver);
 
 protected:
     // Function pointer types
     typedef void* (*CreateFn)(const float*, int, int);
     typedef int   (*GetLengthFn)(void*);
     typedef void  (*GetFilterFn)(void*, float*);
+    typedef bool  (*SetImpulseFn)(void*, const float*, int);
+    typedef long long (*GetCounterFn)(void*);
+    typedef long long (*GetTotalFn)();
     typedef void  (*ProcessFn)(void*, float*, int, int, int);
     typedef void  (*DisposeFn)(void*);
+    typedef void* (*CloneFn)(void*);
 
     // Function pointers
     CreateFn   m_pCreate;
     GetLengthFn   m_pGetLength;
+    GetCounterFn   m_pGetMemoryUsage;
+    GetTotalFn   m_pGetSpectrumMemoryUsage;
     GetFilterFn   m_pGetFilter;
+    SetImpulseFn   m_pSetImpulse;
+    GetCounterFn   m_pGetTimeslots;
+    GetCounterFn   m_pGetSkippedTimeslots;
+    GetCounterFn   m_pGetDrainedTimeslots;
     ProcessFn   m_pProcess;
     DisposeFn   m_pDispose;
+    CloneFn   m_pClone;
 };
 
 #endif // FASTCONVOLVER_LOADER_H
\ No newline at end of file
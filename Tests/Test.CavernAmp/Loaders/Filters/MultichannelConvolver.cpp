@@ -0,0 +1,59 @@
+#include "MultichannelConvolver.h"
+#include <cstdio>
+
+MultichannelConvolverLoader::MultichannelConvolverLoader()
+    : m_pCreate(nullptr)
+    , m_pSetMultithreaded(nullptr)
+    , m_pProcess(nullptr)
+    , m_pProcessChannel(nullptr)
+    , m_pDispose(nullptr)
+{
+}
+
+MultichannelConvolverLoader::~MultichannelConvolverLoader() {
+}
+
+bool MultichannelConvolverLoader::Load(const wchar_t* dllPath) {
+    if (!DllLoader::Load(dllPath)) {
+        return false;
+    }
+
+    m_pCreate = reinterpret_cast<CreateFn>(GetProcAddress(GetHandle(), "MultichannelConvolver_Create"));
+    m_pSetMultithreaded = reinterpret_cast<SetMultithreadedFn>(GetProcAddress(GetHandle(), "MultichannelConvolver_SetMultithreaded"));
+    m_pProcess = reinterpret_cast<ProcessFn>(GetProcAddress(GetHandle(), "MultichannelConvolver_Process"));
+    m_pProcessChannel = reinterpret_cast<ProcessChannelFn>(GetProcAddress(GetHandle(), "Filter_ProcessChannel"));
+    m_pDispose = reinterpret_cast<DisposeFn>(GetProcAddress(GetHandle(), "MultichannelConvolver_Dispose"));
+
+    if (!m_pCreate || !m_pSetMultithreaded || !m_pProcess || !m_pProcessChannel || !m_pDispose) {
+        fprintf(stderr, "FATAL: Could not resolve DLL exports (error %lu)\n", GetLastError());
+        Unload();
+        return false;
+    }
+
+    return true;
+}
+
+void* MultichannelConvolverLoader::Create(const float** impulses, int len, int channels) {
+    if (!m_pCreate) return nullptr;
+    return m_pCreate(impulses, len, channels);
+}
+
+void MultichannelConvolverLoader::SetMultithreaded(void* convolver, bool multithreaded) {
+    if (!m_pSetMultithreaded) return;
+    m_pSetMultithreaded(convolver, multithreaded);
+}
+
+void MultichannelConvolverLoader::Process(void* convolver, float* samples, int len) {
+    if (!m_pProcess) return;
+    m_pProcess(convolver, samples, len);
+}
+
+void MultichannelConvolverLoader::ProcessChannel(void* convolver, float* samples, int len, int channel, int channels) {
+    if (!m_pProcessChannel) return;
+    m_pProcessChannel(convolver, samples, len, channel, channels);
+}
+
+void MultichannelConvolverLoader::Dispose(void* convolver) {
+    if (!m_pDispose) return;
+    m_pDispose(convolver);
+}
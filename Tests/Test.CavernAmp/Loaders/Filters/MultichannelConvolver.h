@@ -0,0 +1,37 @@
+#ifndef MULTICHANNELCONVOLVER_LOADER_H
+#define MULTICHANNELCONVOLVER_LOADER_H
+
+#include "../DllLoader.h"
+
+class MultichannelConvolverLoader : public DllLoader {
+public:
+    MultichannelConvolverLoader();
+    ~MultichannelConvolverLoader();
+
+    // Load DLL and resolve MultichannelConvolver-specific function pointers
+    bool Load(const wchar_t* dllPath) override;
+
+    // --- Exported API (proxied to DLL) ---
+    void* Create(const float** impulses, int len, int channels);
+    void  SetMultithreaded(void* convolver, bool multithreaded);
+    void  Process(void* convolver, float* samples, int len);
+    void  ProcessChannel(void* convolver, float* samples, int len, int channel, int channels);
+    void  Dispose(void* convolver);
+
+protected:
+    // Function pointer types
+    typedef void* (*CreateFn)(const float**, int, int);
+    typedef void  (*SetMultithreadedFn)(void*, bool);
+    typedef void  (*ProcessFn)(void*, float*, int);
+    typedef void  (*ProcessChannelFn)(void*, float*, int, int, int);
+    typedef void  (*DisposeFn)(void*);
+
+    // Function pointers
+    CreateFn   m_pCreate;
+    SetMultithreadedFn   m_pSetMultithreaded;
+    ProcessFn   m_pProcess;
+    ProcessChannelFn   m_pProcessChannel;
+    DisposeFn   m_pDispose;
+};
+
+#endif // MULTICHANNELCONVOLVER_LOADER_H
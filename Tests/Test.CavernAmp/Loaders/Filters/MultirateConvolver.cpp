@@ -0,0 +1,59 @@
+#include "MultirateConvolver.h"
+#include <cstdio>
+
+MultirateConvolverLoader::MultirateConvolverLoader()
+    : m_pCreate(nullptr)
+    , m_pCreateIfBandLimited(nullptr)
+    , m_pGetFactor(nullptr)
+    , m_pProcess(nullptr)
+    , m_pDispose(nullptr)
+{
+}
+
+MultirateConvolverLoader::~MultirateConvolverLoader() {
+}
+
+bool MultirateConvolverLoader::Load(const wchar_t* dllPath) {
+    if (!DllLoader::Load(dllPath)) {
+        return false;
+    }
+
+    m_pCreate = reinterpret_cast<CreateFn>(GetProcAddress(GetHandle(), "MultirateConvolver_Create"));
+    m_pCreateIfBandLimited = reinterpret_cast<CreateIfBandLimitedFn>(GetProcAddress(GetHandle(), "MultirateConvolver_CreateIfBandLimited"));
+    m_pGetFactor = reinterpret_cast<GetFactorFn>(GetProcAddress(GetHandle(), "MultirateConvolver_GetFactor"));
+    m_pProcess = reinterpret_cast<ProcessFn>(GetProcAddress(GetHandle(), "MultirateConvolver_Process"));
+    m_pDispose = reinterpret_cast<DisposeFn>(GetProcAddress(GetHandle(), "MultirateConvolver_Dispose"));
+
+    if (!m_pCreate || !m_pCreateIfBandLimited || !m_pGetFactor || !m_pProcess || !m_pDispose) {
+        fprintf(stderr, "FATAL: Could not resolve DLL exports (error %lu)\n", GetLastError());
+        Unload();
+        return false;
+    }
+
+    return true;
+}
+
+void* MultirateConvolverLoader::Create(const float* impulse, int len, int factor) {
+    if (!m_pCreate) return nullptr;
+    return m_pCreate(impulse, len, factor);
+}
+
+void* MultirateConvolverLoader::CreateIfBandLimited(const float* impulse, int len) {
+    if (!m_pCreateIfBandLimited) return nullptr;
+    return m_pCreateIfBandLimited(impulse, len);
+}
+
+int MultirateConvolverLoader::GetFactor(void* convolver) {
+    if (!m_pGetFactor) return 0;
+    return m_pGetFactor(convolver);
+}
+
+void MultirateConvolverLoader::Process(void* convolver, float* samples, int len, int channel, int channels) {
+    if (!m_pProcess) return;
+    m_pProcess(convolver, samples, len, channel, channels);
+}
+
+void MultirateConvolverLoader::Dispose(void* convolver) {
+    if (!m_pDispose) return;
+    m_pDispose(convolver);
+}
@@ -0,0 +1,37 @@
+#ifndef MULTIRATECONVOLVER_LOADER_H
+#define MULTIRATECONVOLVER_LOADER_H
+
+#include "../DllLoader.h"
+
+class MultirateConvolverLoader : public DllLoader {
+public:
+    MultirateConvolverLoader();
+    ~MultirateConvolverLoader();
+
+    // Load DLL and resolve MultirateConvolver-specific function pointers
+    bool Load(const wchar_t* dllPath) override;
+
+    // --- Exported API (proxied to DLL) ---
+    void* Create(const float* impulse, int len, int factor);
+    void* CreateIfBandLimited(const float* impulse, int len);
+    int   GetFactor(void* convolver);
+    void  Process(void* convolver, float* samples, int len, int channel, int channels);
+    void  Dispose(void* convolver);
+
+protected:
+    // Function pointer types
+    typedef void* (*CreateFn)(const float*, int, int);
+    typedef void* (*CreateIfBandLimitedFn)(const float*, int);
+    typedef int   (*GetFactorFn)(void*);
+    typedef void  (*ProcessFn)(void*, float*, int, int, int);
+    typedef void  (*DisposeFn)(void*);
+
+    // Function pointers
+    CreateFn   m_pCreate;
+    CreateIfBandLimitedFn   m_pCreateIfBandLimited;
+    GetFactorFn   m_pGetFactor;
+    ProcessFn   m_pProcess;
+    DisposeFn   m_pDispose;
+};
+
+#endif // MULTIRATECONVOLVER_LOADER_H
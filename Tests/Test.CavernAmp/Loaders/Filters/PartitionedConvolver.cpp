@@ -0,0 +1,59 @@
+#include "PartitionedConvolver.h"
+#include <cstdio>
+
+PartitionedConvolverLoader::PartitionedConvolverLoader()
+    : m_pCreate(nullptr)
+    , m_pGetLatency(nullptr)
+    , m_pGetPartitions(nullptr)
+    , m_pProcess(nullptr)
+    , m_pDispose(nullptr)
+{
+}
+
+PartitionedConvolverLoader::~PartitionedConvolverLoader() {
+}
+
+bool PartitionedConvolverLoader::Load(const wchar_t* dllPath) {
+    if (!DllLoader::Load(dllPath)) {
+        return false;
+    }
+
+    m_pCreate = reinterpret_cast<CreateFn>(GetProcAddress(GetHandle(), "PartitionedConvolver_Create"));
+    m_pGetLatency = reinterpret_cast<GetIntFn>(GetProcAddress(GetHandle(), "PartitionedConvolver_GetLatency"));
+    m_pGetPartitions = reinterpret_cast<GetIntFn>(GetProcAddress(GetHandle(), "PartitionedConvolver_GetPartitions"));
+    m_pProcess = reinterpret_cast<ProcessFn>(GetProcAddress(GetHandle(), "PartitionedConvolver_Process"));
+    m_pDispose = reinterpret_cast<DisposeFn>(GetProcAddress(GetHandle(), "PartitionedConvolver_Dispose"));
+
+    if (!m_pCreate || !m_pGetLatency || !m_pGetPartitions || !m_pProcess || !m_pDispose) {
+        fprintf(stderr, "FATAL: Could not resolve DLL exports (error %lu)\n", GetLastError());
+        Unload();
+        return false;
+    }
+
+    return true;
+}
+
+void* PartitionedConvolverLoader::Create(const float* impulse, int len, int blockSize) {
+    if (!m_pCreate) return nullptr;
+    return m_pCreate(impulse, len, blockSize);
+}
+
+int PartitionedConvolverLoader::GetLatency(void* convolver) {
+    if (!m_pGetLatency) return -1;
+    return m_pGetLatency(convolver);
+}
+
+int PartitionedConvolverLoader::GetPartitions(void* convolver) {
+    if (!m_pGetPartitions) return -1;
+    return m_pGetPartitions(convolver);
+}
+
+void PartitionedConvolverLoader::Process(void* convolver, float* samples, int len, int channel, int channels) {
+    if (!m_pProcess) return;
+    m_pProcess(convolver, samples, len, channel, channels);
+}
+
+void PartitionedConvolverLoader::Dispose(void* convolver) {
+    if (!m_pDispose) return;
+    m_pDispose(convolver);
+}
@@ -0,0 +1,36 @@
+#ifndef PARTITIONEDCONVOLVER_LOADER_H
+#define PARTITIONEDCONVOLVER_LOADER_H
+
+#include "../DllLoader.h"
+
+class PartitionedConvolverLoader : public DllLoader {
+public:
+    PartitionedConvolverLoader();
+    ~PartitionedConvolverLoader();
+
+    // Load DLL and resolve PartitionedConvolver-specific function pointers
+    bool Load(const wchar_t* dllPath) override;
+
+    // --- Exported API (proxied to DLL) ---
+    void* Create(const float* impulse, int len, int blockSize);
+    int   GetLatency(void* convolver);
+    int   GetPartitions(void* convolver);
+    void  Process(void* convolver, float* samples, int len, int channel, int channels);
+    void  Dispose(void* convolver);
+
+protected:
+    // Function pointer types
+    typedef void* (*CreateFn)(const float*, int, int);
+    typedef int   (*GetIntFn)(void*);
+    typedef void  (*ProcessFn)(void*, float*, int, int, int);
+    typedef void  (*DisposeFn)(void*);
+
+    // Function pointers
+    CreateFn   m_pCreate;
+    GetIntFn   m_pGetLatency;
+    GetIntFn   m_pGetPartitions;
+    ProcessFn   m_pProcess;
+    DisposeFn   m_pDispose;
+};
+
+#endif // PARTITIONEDCONVOLVER_LOADER_H
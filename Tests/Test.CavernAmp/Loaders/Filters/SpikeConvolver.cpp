@@ -0,0 +1,52 @@
+#include "SpikeConvolver.h"
+#include <cstdio>
+
+SpikeConvolverLoader::SpikeConvolverLoader()
+    : m_pCreate(nullptr)
+    , m_pGetSpikes(nullptr)
+    , m_pProcess(nullptr)
+    , m_pDispose(nullptr)
+{
+}
+
+SpikeConvolverLoader::~SpikeConvolverLoader() {
+}
+
+bool SpikeConvolverLoader::Load(const wchar_t* dllPath) {
+    if (!DllLoader::Load(dllPath)) {
+        return false;
+    }
+
+    m_pCreate = reinterpret_cast<CreateFn>(GetProcAddress(GetHandle(), "SpikeConvolver_Create"));
+    m_pGetSpikes = reinterpret_cast<GetSpikesFn>(GetProcAddress(GetHandle(), "SpikeConvolver_GetSpikes"));
+    m_pProcess = reinterpret_cast<ProcessFn>(GetProcAddress(GetHandle(), "SpikeConvolver_Process"));
+    m_pDispose = reinterpret_cast<DisposeFn>(GetProcAddress(GetHandle(), "SpikeConvolver_Dispose"));
+
+    if (!m_pCreate || !m_pGetSpikes || !m_pProcess || !m_pDispose) {
+        fprintf(stderr, "FATAL: Could not resolve DLL exports (error %lu)\n", GetLastError());
+        Unload();
+        return false;
+    }
+
+    return true;
+}
+
+void* SpikeConvolverLoader::Create(const float* impulse, int len, int delay) {
+    if (!m_pCreate) return nullptr;
+    return m_pCreate(impulse, len, delay);
+}
+
+int SpikeConvolverLoader::GetSpikes(void* convolver) {
+    if (!m_pGetSpikes) return -1;
+    return m_pGetSpikes(convolver);
+}
+
+void SpikeConvolverLoader::Process(void* convolver, float* samples, int len, int channel, int channels) {
+    if (!m_pProcess) return;
+    m_pProcess(convolver, samples, len, channel, channels);
+}
+
+void SpikeConvolverLoader::Dispose(void* convolver) {
+    if (!m_pDispose) return;
+    m_pDispose(convolver);
+}
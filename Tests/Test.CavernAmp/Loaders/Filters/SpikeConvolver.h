@@ -0,0 +1,34 @@
+#ifndef SPIKECONVOLVER_LOADER_H
+#define SPIKECONVOLVER_LOADER_H
+
+#include "../DllLoader.h"
+
+class SpikeConvolverLoader : public DllLoader {
+public:
+    SpikeConvolverLoader();
+    ~SpikeConvolverLoader();
+
+    // Load DLL and resolve SpikeConvolver-specific function pointers
+    bool Load(const wchar_t* dllPath) override;
+
+    // --- Exported API (proxied to DLL) ---
+    void* Create(const float* impulse, int len, int delay);
+    int   GetSpikes(void* convolver);
+    void  Process(void* convolver, float* samples, int len, int channel, int channels);
+    void  Dispose(void* convolver);
+
+protected:
+    // Function pointer types
+    typedef void* (*CreateFn)(const float*, int, int);
+    typedef int   (*GetSpikesFn)(void*);
+    typedef void  (*ProcessFn)(void*, float*, int, int, int);
+    typedef void  (*DisposeFn)(void*);
+
+    // Function pointers
+    CreateFn   m_pCreate;
+    GetSpikesFn   m_pGetSpikes;
+    ProcessFn   m_pProcess;
+    DisposeFn   m_pDispose;
+};
+
+#endif // SPIKECONVOLVER_LOADER_H
@@ -0,0 +1,52 @@
+#include "ZeroLatencyConvolver.h"
+#include <cstdio>
+
+ZeroLatencyConvolverLoader::ZeroLatencyConvolverLoader()
+    : m_pCreate(nullptr)
+    , m_pSetSampleRate(nullptr)
+    , m_pProcess(nullptr)
+    , m_pDispose(nullptr)
+{
+}
+
+ZeroLatencyConvolverLoader::~ZeroLatencyConvolverLoader() {
+}
+
+bool ZeroLatencyConvolverLoader::Load(const wchar_t* dllPath) {
+    if (!DllLoader::Load(dllPath)) {
+        return false;
+    }
+
+    m_pCreate = reinterpret_cast<CreateFn>(GetProcAddress(GetHandle(), "ZeroLatencyConvolver_Create"));
+    m_pSetSampleRate = reinterpret_cast<SetSampleRateFn>(GetProcAddress(GetHandle(), "ZeroLatencyConvolver_SetSampleRate"));
+    m_pProcess = reinterpret_cast<ProcessFn>(GetProcAddress(GetHandle(), "ZeroLatencyConvolver_Process"));
+    m_pDispose = reinterpret_cast<DisposeFn>(GetProcAddress(GetHandle(), "ZeroLatencyConvolver_Dispose"));
+
+    if (!m_pCreate || !m_pSetSampleRate || !m_pProcess || !m_pDispose) {
+        fprintf(stderr, "FATAL: Could not resolve DLL exports (error %lu)\n", GetLastError());
+        Unload();
+        return false;
+    }
+
+    return true;
+}
+
+void* ZeroLatencyConvolverLoader::Create(const float* impulse, int len, int headLength) {
+    if (!m_pCreate) return nullptr;
+    return m_pCreate(impulse, len, headLength);
+}
+
+void ZeroLatencyConvolverLoader::SetSampleRate(void* convolver, int sampleRate) {
+    if (!m_pSetSampleRate) return;
+    m_pSetSampleRate(convolver, sampleRate);
+}
+
+void ZeroLatencyConvolverLoader::Process(void* convolver, float* samples, int len, int channel, int channels) {
+    if (!m_pProcess) return;
+    m_pProcess(convolver, samples, len, channel, channels);
+}
+
+void ZeroLatencyConvolverLoader::Dispose(void* convolver) {
+    if (!m_pDispose) return;
+    m_pDispose(convolver);
+}
@@ -0,0 +1,34 @@
+#ifndef ZEROLATENCYCONVOLVER_LOADER_H
+#define ZEROLATENCYCONVOLVER_LOADER_H
+
+#include "../DllLoader.h"
+
+class ZeroLatencyConvolverLoader : public DllLoader {
+public:
+    ZeroLatencyConvolverLoader();
+    ~ZeroLatencyConvolverLoader();
+
+    // Load DLL and resolve ZeroLatencyConvolver-specific function pointers
+    bool Load(const wchar_t* dllPath) override;
+
+    // --- Exported API (proxied to DLL) ---
+    void* Create(const float* impulse, int len, int headLength);
+    void  SetSampleRate(void* convolver, int sampleRate);
+    void  Process(void* convolver, float* samples, int len, int channel, int channels);
+    void  Dispose(void* convolver);
+
+protected:
+    // Function pointer types
+    typedef void* (*CreateFn)(const float*, int, int);
+    typedef void  (*SetSampleRateFn)(void*, int);
+    typedef void  (*ProcessFn)(void*, float*, int, int, int);
+    typedef void  (*DisposeFn)(void*);
+
+    // Function pointers
+    CreateFn   m_pCreate;
+    SetSampleRateFn   m_pSetSampleRate;
+    ProcessFn   m_pProcess;
+    DisposeFn   m_pDispose;
+};
+
+#endif // ZEROLATENCYCONVOLVER_LOADER_H
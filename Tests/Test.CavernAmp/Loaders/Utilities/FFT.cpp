@@ -0,0 +1,183 @@
+#include "FFT.h"
+#include <cstdio>
+
+FFTLoader::FFTLoader()
+    : m_pCacheCreate(nullptr)
+    , m_pCacheSetMultithreaded(nullptr)
+    , m_pCacheDispose(nullptr)
+    , m_pInPlaceFFT(nullptr)
+    , m_pInPlaceIFFT(nullptr)
+    , m_pProcessRealFFT(nullptr)
+    , m_pProcessRealIFFT(nullptr)
+    , m_pInPlaceRealIFFT(nullptr)
+    , m_pInPlaceFFTBatch(nullptr)
+    , m_pInPlaceIFFTBatch(nullptr)
+    , m_pSetAutotune(nullptr)
+    , m_pGetAutotune(nullptr)
+    , m_pWisdomSize(nullptr)
+    , m_pImportWisdom(nullptr)
+    , m_pExportWisdom(nullptr)
+    , m_pForgetWisdom(nullptr)
+    , m_pFallbackSetMaxBytes(nullptr)
+    , m_pFallbackGetMaxBytes(nullptr)
+    , m_pFallbackHits(nullptr)
+    , m_pFallbackMisses(nullptr)
+    , m_pFallbackResetCounters(nullptr)
+    , m_pFallbackClear(nullptr)
+{
+}
+
+FFTLoader::~FFTLoader() {
+}
+
+bool FFTLoader::Load(const wchar_t* dllPath) {
+    if (!DllLoader::Load(dllPath)) {
+        return false;
+    }
+
+    m_pCacheCreate = reinterpret_cast<CacheCreateFn>(GetProcAddress(GetHandle(), "FFTCache_Create"));
+    m_pCacheSetMultithreaded = reinterpret_cast<CacheSetMultithreadedFn>(GetProcAddress(GetHandle(), "FFTCache_SetMultithreaded"));
+    m_pCacheDispose = reinterpret_cast<CacheDisposeFn>(GetProcAddress(GetHandle(), "FFTCache_Dispose"));
+    m_pInPlaceFFT = reinterpret_cast<TransformFn>(GetProcAddress(GetHandle(), "InPlaceFFT"));
+    m_pInPlaceIFFT = reinterpret_cast<TransformFn>(GetProcAddress(GetHandle(), "InPlaceIFFT"));
+    m_pProcessRealFFT = reinterpret_cast<TransformFn>(GetProcAddress(GetHandle(), "ProcessRealFFT"));
+    m_pProcessRealIFFT = reinterpret_cast<TransformFn>(GetProcAddress(GetHandle(), "ProcessRealIFFT"));
+    m_pInPlaceRealIFFT = reinterpret_cast<TransformFn>(GetProcAddress(GetHandle(), "InPlaceRealIFFT"));
+    m_pInPlaceFFTBatch = reinterpret_cast<BatchFn>(GetProcAddress(GetHandle(), "InPlaceFFTBatch"));
+    m_pInPlaceIFFTBatch = reinterpret_cast<BatchFn>(GetProcAddress(GetHandle(), "InPlaceIFFTBatch"));
+    m_pSetAutotune = reinterpret_cast<SetBoolFn>(GetProcAddress(GetHandle(), "FFTPlanner_SetAutotune"));
+    m_pGetAutotune = reinterpret_cast<GetBoolFn>(GetProcAddress(GetHandle(), "FFTPlanner_GetAutotune"));
+    m_pWisdomSize = reinterpret_cast<GetIntFn>(GetProcAddress(GetHandle(), "FFTPlanner_WisdomSize"));
+    m_pImportWisdom = reinterpret_cast<PathFn>(GetProcAddress(GetHandle(), "FFTPlanner_ImportWisdom"));
+    m_pExportWisdom = reinterpret_cast<PathFn>(GetProcAddress(GetHandle(), "FFTPlanner_ExportWisdom"));
+    m_pForgetWisdom = reinterpret_cast<ActionFn>(GetProcAddress(GetHandle(), "FFTPlanner_ForgetWisdom"));
+    m_pFallbackSetMaxBytes = reinterpret_cast<SetLongFn>(GetProcAddress(GetHandle(), "FallbackFFTCache_SetMaxBytes"));
+    m_pFallbackGetMaxBytes = reinterpret_cast<GetLongFn>(GetProcAddress(GetHandle(), "FallbackFFTCache_GetMaxBytes"));
+    m_pFallbackHits = reinterpret_cast<GetLongFn>(GetProcAddress(GetHandle(), "FallbackFFTCache_Hits"));
+    m_pFallbackMisses = reinterpret_cast<GetLongFn>(GetProcAddress(GetHandle(), "FallbackFFTCache_Misses"));
+    m_pFallbackResetCounters = reinterpret_cast<ActionFn>(GetProcAddress(GetHandle(), "FallbackFFTCache_ResetCounters"));
+    m_pFallbackClear = reinterpret_cast<ActionFn>(GetProcAddress(GetHandle(), "FallbackFFTCache_Clear"));
+
+    if (!m_pCacheCreate || !m_pCacheSetMultithreaded || !m_pCacheDispose || !m_pInPlaceFFT || !m_pInPlaceIFFT ||
+        !m_pProcessRealFFT || !m_pProcessRealIFFT || !m_pInPlaceRealIFFT ||
+        !m_pInPlaceFFTBatch || !m_pInPlaceIFFTBatch ||
+        !m_pSetAutotune || !m_pGetAutotune || !m_pWisdomSize || !m_pImportWisdom || !m_pExportWisdom ||
+        !m_pForgetWisdom || !m_pFallbackSetMaxBytes || !m_pFallbackGetMaxBytes || !m_pFallbackHits || !m_pFallbackMisses ||
+        !m_pFallbackResetCounters || !m_pFallbackClear) {
+        fprintf(stderr, "FATAL: Could not resolve DLL exports (error %lu)\n", GetLastError());
+        Unload();
+        return false;
+    }
+
+    return true;
+}
+
+void* FFTLoader::CacheCreate(int fftSize) {
+    if (!m_pCacheCreate) return nullptr;
+    return m_pCacheCreate(fftSize);
+}
+
+void FFTLoader::CacheSetMultithreaded(void* cache, bool multithreaded) {
+    if (!m_pCacheSetMultithreaded) return;
+    m_pCacheSetMultithreaded(cache, multithreaded);
+}
+
+void FFTLoader::CacheDispose(void* cache) {
+    if (!m_pCacheDispose) return;
+    m_pCacheDispose(cache);
+}
+
+void FFTLoader::InPlaceFFT(float* samples, int sampleCount, void* cache) {
+    if (!m_pInPlaceFFT) return;
+    m_pInPlaceFFT(samples, sampleCount, cache);
+}
+
+void FFTLoader::InPlaceIFFT(float* samples, int sampleCount, void* cache) {
+    if (!m_pInPlaceIFFT) return;
+    m_pInPlaceIFFT(samples, sampleCount, cache);
+}
+
+void FFTLoader::ProcessRealFFT(float* samples, int sampleCount, void* cache) {
+    if (!m_pProcessRealFFT) return;
+    m_pProcessRealFFT(samples, sampleCount, cache);
+}
+
+void FFTLoader::ProcessRealIFFT(float* samples, int sampleCount, void* cache) {
+    if (!m_pProcessRealIFFT) return;
+    m_pProcessRealIFFT(samples, sampleCount, cache);
+}
+
+void FFTLoader::InPlaceRealIFFT(float* samples, int sampleCount, void* cache) {
+    if (!m_pInPlaceRealIFFT) return;
+    m_pInPlaceRealIFFT(samples, sampleCount, cache);
+}
+
+void FFTLoader::InPlaceFFTBatch(float** signals, int channels, int sampleCount, void* cache, bool multithreaded) {
+    if (!m_pInPlaceFFTBatch) return;
+    m_pInPlaceFFTBatch(signals, channels, sampleCount, cache, multithreaded);
+}
+
+void FFTLoader::InPlaceIFFTBatch(float** signals, int channels, int sampleCount, void* cache, bool multithreaded) {
+    if (!m_pInPlaceIFFTBatch) return;
+    m_pInPlaceIFFTBatch(signals, channels, sampleCount, cache, multithreaded);
+}
+
+void FFTLoader::SetAutotune(bool enabled) {
+    if (!m_pSetAutotune) return;
+    m_pSetAutotune(enabled);
+}
+
+bool FFTLoader::GetAutotune() {
+    if (!m_pGetAutotune) return false;
+    return m_pGetAutotune();
+}
+
+int FFTLoader::WisdomSize() {
+    if (!m_pWisdomSize) return 0;
+    return m_pWisdomSize();
+}
+
+bool FFTLoader::ImportWisdom(const char* path) {
+    if (!m_pImportWisdom) return false;
+    return m_pImportWisdom(path);
+}
+
+bool FFTLoader::ExportWisdom(const char* path) {
+    if (!m_pExportWisdom) return false;
+    return m_pExportWisdom(path);
+}
+
+void FFTLoader::ForgetWisdom() {
+    if (!m_pForgetWisdom) return;
+    m_pForgetWisdom();
+}
+
+void FFTLoader::FallbackSetMaxBytes(long long limit) {
+    if (!m_pFallbackSetMaxBytes) return;
+    m_pFallbackSetMaxBytes(limit);
+}
+
+long long FFTLoader::FallbackGetMaxBytes() {
+    if (!m_pFallbackGetMaxBytes) return 0;
+    return m_pFallbackGetMaxBytes();
+}
+
+long long FFTLoader::FallbackHits() {
+    if (!m_pFallbackHits) return 0;
+    return m_pFallbackHits();
+}
+
+long long FFTLoader::FallbackMisses() {
+    if (!m_pFallbackMisses) return 0;
+    return m_pFallbackMisses();
+}
+
+void FFTLoader::FallbackResetCounters() {
+    if (!m_pFallbackResetCounters) return;
+    m_pFallbackResetCounters();
+}
+
+void FFTLoader::FallbackClear() {
+    if (!m_pFallbackClear) return;
+    m_pFallbackClear();
+}
@@ -0,0 +1,79 @@
+#ifndef FFT_LOADER_H
+#define FFT_LOADER_H
+
+#include "../DllLoader.h"
+
+// Complex arrays are passed as interleaved real and imaginary pairs, the layout of CavernAmp's Complex.
+class FFTLoader : public DllLoader {
+public:
+    FFTLoader();
+    ~FFTLoader();
+
+    // Load DLL and resolve FFT-specific function pointers
+    bool Load(const wchar_t* dllPath) override;
+
+    // --- Exported API (proxied to DLL) ---
+    void* CacheCreate(int fftSize);
+    void  CacheSetMultithreaded(void* cache, bool multithreaded);
+    void  CacheDispose(void* cache);
+    void  InPlaceFFT(float* samples, int sampleCount, void* cache);
+    void  InPlaceIFFT(float* samples, int sampleCount, void* cache);
+    void  ProcessRealFFT(float* samples, int sampleCount, void* cache);
+    void  ProcessRealIFFT(float* samples, int sampleCount, void* cache);
+    void  InPlaceRealIFFT(float* samples, int sampleCount, void* cache);
+    void  InPlaceFFTBatch(float** signals, int channels, int sampleCount, void* cache, bool multithreaded);
+    void  InPlaceIFFTBatch(float** signals, int channels, int sampleCount, void* cache, bool multithreaded);
+    void  SetAutotune(bool enabled);
+    bool  GetAutotune();
+    int   WisdomSize();
+    bool  ImportWisdom(const char* path);
+    bool  ExportWisdom(const char* path);
+    void  ForgetWisdom();
+    void  FallbackSetMaxBytes(long long limit);
+    long long FallbackGetMaxBytes();
+    long long FallbackHits();
+    long long FallbackMisses();
+    void  FallbackResetCounters();
+    void  FallbackClear();
+
+protected:
+    // Function pointer types
+    typedef void* (*CacheCreateFn)(int);
+    typedef void  (*CacheSetMultithreadedFn)(void*, bool);
+    typedef void  (*CacheDisposeFn)(void*);
+    typedef void  (*TransformFn)(float*, int, void*);
+    typedef void  (*BatchFn)(float**, int, int, void*, bool);
+    typedef void  (*SetBoolFn)(bool);
+    typedef bool  (*GetBoolFn)();
+    typedef int   (*GetIntFn)();
+    typedef bool  (*PathFn)(const char*);
+    typedef void  (*SetLongFn)(long long);
+    typedef long long (*GetLongFn)();
+    typedef void  (*ActionFn)();
+
+    // Function pointers
+    CacheCreateFn   m_pCacheCreate;
+    CacheSetMultithreadedFn   m_pCacheSetMultithreaded;
+    CacheDisposeFn   m_pCacheDispose;
+    TransformFn   m_pInPlaceFFT;
+    TransformFn   m_pInPlaceIFFT;
+    TransformFn   m_pProcessRealFFT;
+    TransformFn   m_pProcessRealIFFT;
+    TransformFn   m_pInPlaceRealIFFT;
+    BatchFn   m_pInPlaceFFTBatch;
+    BatchFn   m_pInPlaceIFFTBatch;
+    SetBoolFn   m_pSetAutotune;
+    GetBoolFn   m_pGetAutotune;
+    GetIntFn   m_pWisdomSize;
+    PathFn   m_pImportWisdom;
+    PathFn   m_pExportWisdom;
+    ActionFn   m_pForgetWisdom;
+    SetLongFn   m_pFallbackSetMaxBytes;
+    GetLongFn   m_pFallbackGetMaxBytes;
+    GetLongFn   m_pFallbackHits;
+    GetLongFn   m_pFallbackMisses;
+    ActionFn   m_pFallbackResetCounters;
+    ActionFn   m_pFallbackClear;
+};
+
+#endif // FFT_LOADER_H
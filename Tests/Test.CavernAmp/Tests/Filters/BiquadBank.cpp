@@ -0,0 +1,176 @@
+#include "BiquadBank.h"
+#include "Reference.h"
+#include "../../test.h"
+#include <cstdio>
+
+// Global pointer to the current test instance (for C-style wrapper functions)
+static BiquadBankTests* g_currentTests = nullptr;
+
+// --- C-style wrapper functions ---
+// These bridge between runTest(function pointer) and our member methods.
+static bool staticTest_ChannelGroups() {
+    return g_currentTests ? g_currentTests->testChannelGroups() : false;
+}
+static bool staticTest_ChannelOffset() {
+    return g_currentTests ? g_currentTests->testChannelOffset() : false;
+}
+static bool staticTest_SetBiquadRange() {
+    return g_currentTests ? g_currentTests->testSetBiquadRange() : false;
+}
+
+// --- Helpers ---
+// Frames of the test signals
+static const int frames = 2000;
+// Calls of uneven lengths around the 256 frame runs, the rest of the signal is processed in the last call
+static const int callLengths[] = {1, 255, 256, 257, 700};
+
+BiquadBankTests::BiquadBankTests() {}
+BiquadBankTests::~BiquadBankTests() {}
+
+bool BiquadBankTests::LoadLibrary(const wchar_t* dllPath) {
+    return m_loader.Load(dllPath);
+}
+
+bool BiquadBankTests::setBands(void* bank, int channels, int bands, std::vector<float>& coefficients) {
+    coefficients.assign(channels * bands * 5, 0.0f);
+    for (int channel = 0; channel < channels; ++channel) {
+        for (int band = 0; band < bands; ++band) {
+            float* target = &coefficients[(channel * bands + band) * 5];
+            if ((channel + band) % 4 == 3) {
+                target[0] = 1; // Left pass-through
+                continue;
+            }
+            peakingBiquad(target, 0.01 + 0.02 * channel + 0.1 * band, (channel & 1 ? -6.0 : 6.0) + band, 0.7 + 0.1 * band);
+            char desc[128];
+            snprintf(desc, sizeof(desc), "SetBiquad failed for channel %d, band %d", channel, band);
+            ASSERT_TRUE(m_loader.SetBiquad(bank, channel, band, target[0], target[1], target[2], target[3], target[4]),
+                desc);
+        }
+    }
+    return true;
+}
+
+bool BiquadBankTests::compareToReference(void* bank, int bankChannels, int bands,
+    const std::vector<float>& coefficients, int channel, int channels) {
+    std::vector<float> original(frames * channels);
+    fillNoise(original.data(), frames * channels, 1, 0.5f);
+    std::vector<float> output = original;
+    int position = 0;
+    for (int callLength : callLengths) {
+        m_loader.FilterProcessChannel(bank, output.data() + position * channels, callLength * channels, channel, channels);
+        position += callLength;
+    }
+    m_loader.FilterProcessChannel(bank, output.data() + position * channels, (frames - position) * channels,
+        channel, channels);
+
+    std::vector<float> signal(frames);
+    for (int other = 0; other < channels; ++other) {
+        char desc[256];
+        int bankChannel = other - channel;
+        if (bankChannel < 0 || bankChannel >= bankChannels) {
+            for (int i = 0; i < frames; ++i) {
+                snprintf(desc, sizeof(desc), "Channel %d changed at frame %d", other, i);
+                ASSERT_TRUE(output[i * channels + other] == original[i * channels + other], desc);
+            }
+            continue;
+        }
+
+        for (int i = 0; i < frames; ++i) {
+            signal[i] = original[i * channels + other];
+        }
+        std::vector<double> expected = filterBiquads(signal.data(), frames,
+            reinterpret_cast<const float (*)[5]>(&coefficients[bankChannel * bands * 5]), bands);
+        for (int i = 0; i < frames; ++i) {
+            snprintf(desc, sizeof(desc), "Channel %d, frame %d", other, i);
+            ASSERT_APPROX_EQUAL((float)expected[i], output[i * channels + other], desc);
+        }
+    }
+    return true;
+}
+
+bool BiquadBankTests::Run() {
+    printf("BiquadBank tests:\n");
+
+    g_currentTests = this;
+    runTest("ChannelGroups",  staticTest_ChannelGroups);
+    runTest("ChannelOffset",  staticTest_ChannelOffset);
+    runTest("SetBiquadRange", staticTest_SetBiquadRange);
+    g_currentTests = nullptr;
+
+    return g_testFailed == 0;
+}
+
+// ============================================================
+// Test 1: ChannelGroups
+//
+// Meaning: Every channel is filtered by its own chain of bands, for
+// a full and a partial group of 8 channels, an odd number of bands
+// processed in pairs, and the state is kept between uneven calls.
+// After a Reset, the same input gives the same output again.
+// ============================================================
+bool BiquadBankTests::testChannelGroups() {
+    const int channels = 11, bands = 3;
+    void* bank = m_loader.Create(channels, bands);
+    ASSERT_NOT_NULL(bank, "BiquadBank_Create returned null");
+    std::vector<float> coefficients;
+    bool passed = setBands(bank, channels, bands, coefficients) &&
+        compareToReference(bank, channels, bands, coefficients, 0, channels);
+    if (passed) {
+        m_loader.Reset(bank);
+        passed = compareToReference(bank, channels, bands, coefficients, 0, channels);
+    }
+    if (passed) {
+        // The export for all channels shall match the same reference
+        m_loader.Reset(bank);
+        std::vector<float> original(frames * channels), output(frames * channels), reference(frames * channels);
+        fillNoise(original.data(), frames * channels, 1, 0.5f);
+        output = original;
+        reference = original;
+        m_loader.Process(bank, output.data(), frames * channels);
+        m_loader.Reset(bank);
+        m_loader.FilterProcessChannel(bank, reference.data(), frames * channels, 0, channels);
+        for (int i = 0; i < frames * channels && passed; ++i) {
+            passed = output[i] == reference[i];
+        }
+        if (!passed) {
+            fprintf(stderr, "\n  BiquadBank_Process differs from processing from channel 0\n");
+        }
+    }
+    m_loader.Dispose(bank);
+    return passed;
+}
+
+// ============================================================
+// Test 2: ChannelOffset
+//
+// Meaning: A bank of a partial group filters only its channels from
+// an offset of a signal with more channels, and the channels before
+// and after it are left untouched.
+// ============================================================
+bool BiquadBankTests::testChannelOffset() {
+    const int bankChannels = 5, bands = 2, channel = 2, channels = 9;
+    void* bank = m_loader.Create(bankChannels, bands);
+    ASSERT_NOT_NULL(bank, "BiquadBank_Create returned null");
+    std::vector<float> coefficients;
+    bool passed = setBands(bank, bankChannels, bands, coefficients) &&
+        compareToReference(bank, bankChannels, bands, coefficients, channel, channels);
+    m_loader.Dispose(bank);
+    return passed;
+}
+
+// ============================================================
+// Test 3: SetBiquadRange
+//
+// Meaning: Setting a band out of the channel or band range fails,
+// the edges of the range succeed.
+// ============================================================
+bool BiquadBankTests::testSetBiquadRange() {
+    void* bank = m_loader.Create(3, 2);
+    ASSERT_NOT_NULL(bank, "BiquadBank_Create returned null");
+    bool passed = m_loader.SetBiquad(bank, 0, 0, 1, 0, 0, 0, 0) && m_loader.SetBiquad(bank, 2, 1, 1, 0, 0, 0, 0) &&
+        !m_loader.SetBiquad(bank, -1, 0, 1, 0, 0, 0, 0) && !m_loader.SetBiquad(bank, 3, 0, 1, 0, 0, 0, 0) &&
+        !m_loader.SetBiquad(bank, 0, -1, 1, 0, 0, 0, 0) && !m_loader.SetBiquad(bank, 0, 2, 1, 0, 0, 0, 0);
+    m_loader.Dispose(bank);
+    ASSERT_TRUE(passed, "SetBiquad range check");
+    return true;
+}
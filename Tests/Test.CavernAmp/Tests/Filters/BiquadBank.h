@@ -0,0 +1,35 @@
+#ifndef BIQUADBANK_TESTS_H
+#define BIQUADBANK_TESTS_H
+
+#include "../../Loaders/Filters/BiquadBank.h"
+#include <vector>
+
+class BiquadBankTests {
+public:
+    BiquadBankTests();
+    ~BiquadBankTests();
+
+    // Load the DLL before running tests
+    bool LoadLibrary(const wchar_t* dllPath);
+
+    // Run all tests, returns true if all passed
+    bool Run();
+
+    // Individual tests (called via C-style wrappers)
+    bool testChannelGroups();
+    bool testChannelOffset();
+    bool testSetBiquadRange();
+
+private:
+    BiquadBankLoader m_loader;
+
+    // Design different bands for each channel, leaving some pass-through, and set them in the bank
+    bool setBands(void* bank, int channels, int bands, std::vector<float>& coefficients);
+
+    // Filter the channels from an offset of a noise signal with more channels in uneven calls, and compare each
+    // filtered channel to the reference, while the other channels shall stay untouched
+    bool compareToReference(void* bank, int bankChannels, int bands, const std::vector<float>& coefficients,
+        int channel, int channels);
+};
+
+#endif // BIQUADBANK_TESTS_H
@@ -0,0 +1,136 @@
+#include "BiquadCascade.h"
+#include "Reference.h"
+#include "../../test.h"
+#include <cstdio>
+
+// Global pointer to the current test instance (for C-style wrapper functions)
+static BiquadCascadeTests* g_currentTests = nullptr;
+
+// --- C-style wrapper functions ---
+// These bridge between runTest(function pointer) and our member methods.
+static bool staticTest_SinglePrecision() {
+    return g_currentTests ? g_currentTests->testSinglePrecision() : false;
+}
+static bool staticTest_DoublePrecision() {
+    return g_currentTests ? g_currentTests->testDoublePrecision() : false;
+}
+static bool staticTest_SetSectionRange() {
+    return g_currentTests ? g_currentTests->testSetSectionRange() : false;
+}
+
+// --- Helpers ---
+// Interleaved layout of the test signals, the middle channel is filtered
+static const int channels = 3, channel = 1;
+// Frames of the test signals
+static const int frames = 2000;
+// Sections of the tested cascades, a full and a partial group of the sections run together
+static const int sections = 6;
+// Calls of uneven lengths around the 256 sample runs, the rest of the signal is processed in the last call
+static const int callLengths[] = {1, 255, 256, 257, 700};
+
+BiquadCascadeTests::BiquadCascadeTests() {}
+BiquadCascadeTests::~BiquadCascadeTests() {}
+
+bool BiquadCascadeTests::LoadLibrary(const wchar_t* dllPath) {
+    return m_loader.Load(dllPath);
+}
+
+bool BiquadCascadeTests::compareToReference(bool doublePrecision, double lowestFrequency) {
+    void* cascade = m_loader.Create(sections, doublePrecision);
+    ASSERT_NOT_NULL(cascade, "BiquadCascade_Create returned null");
+    float coefficients[sections][5];
+    for (int section = 0; section < sections; ++section) {
+        peakingBiquad(coefficients[section], lowestFrequency * (section + 1), section & 1 ? -4.0 : 5.0, 0.7 + 0.2 * section);
+        float* c = coefficients[section];
+        if (!m_loader.SetSection(cascade, section, c[0], c[1], c[2], c[3], c[4])) {
+            m_loader.Dispose(cascade);
+            fprintf(stderr, "\n  SetSection failed for section %d\n", section);
+            return false;
+        }
+    }
+
+    std::vector<float> signal(frames), original(frames * channels);
+    fillNoise(signal.data(), frames, 1, 0.5f);
+    fillNoise(original.data(), frames * channels, 2, 1);
+    interleave(original.data(), signal.data(), frames, channel, channels);
+    std::vector<double> expected = filterBiquads(signal.data(), frames, coefficients, sections);
+
+    // The second pass after a Reset shall give the same result
+    for (int pass = 0; pass < 2; ++pass) {
+        std::vector<float> output = original;
+        int position = 0;
+        for (int callLength : callLengths) {
+            m_loader.Process(cascade, output.data() + position * channels, callLength * channels, channel, channels);
+            position += callLength;
+        }
+        m_loader.Process(cascade, output.data() + position * channels, (frames - position) * channels, channel, channels);
+        m_loader.Reset(cascade);
+
+        for (int i = 0; i < frames; ++i) {
+            char desc[256];
+            snprintf(desc, sizeof(desc), "Pass %d, frame %d", pass, i);
+            if (!assertApproxEqual((float)expected[i], output[i * channels + channel], __FILE__, __LINE__, desc)) {
+                m_loader.Dispose(cascade);
+                return false;
+            }
+            for (int other = 0; other < channels; ++other) {
+                if (other != channel && output[i * channels + other] != original[i * channels + other]) {
+                    m_loader.Dispose(cascade);
+                    fprintf(stderr, "\n  Pass %d, channel %d changed at frame %d\n", pass, other, i);
+                    return false;
+                }
+            }
+        }
+    }
+    m_loader.Dispose(cascade);
+    return true;
+}
+
+bool BiquadCascadeTests::Run() {
+    printf("BiquadCascade tests:\n");
+
+    g_currentTests = this;
+    runTest("SinglePrecision", staticTest_SinglePrecision);
+    runTest("DoublePrecision", staticTest_DoublePrecision);
+    runTest("SetSectionRange", staticTest_SetSectionRange);
+    g_currentTests = nullptr;
+
+    return g_testFailed == 0;
+}
+
+// ============================================================
+// Test 1: SinglePrecision
+//
+// Meaning: A cascade with single precision state matches the chain
+// of sections on an interleaved channel across uneven calls, and
+// leaves the other channels untouched.
+// ============================================================
+bool BiquadCascadeTests::testSinglePrecision() {
+    return compareToReference(false, 0.02);
+}
+
+// ============================================================
+// Test 2: DoublePrecision
+//
+// Meaning: A cascade with double precision state matches the chain
+// of sections, even with the low frequency bands it's used for.
+// ============================================================
+bool BiquadCascadeTests::testDoublePrecision() {
+    return compareToReference(true, 0.02) && compareToReference(true, 0.001);
+}
+
+// ============================================================
+// Test 3: SetSectionRange
+//
+// Meaning: Setting a section out of range fails, the edges of the
+// range succeed.
+// ============================================================
+bool BiquadCascadeTests::testSetSectionRange() {
+    void* cascade = m_loader.Create(sections, false);
+    ASSERT_NOT_NULL(cascade, "BiquadCascade_Create returned null");
+    bool passed = m_loader.SetSection(cascade, 0, 1, 0, 0, 0, 0) && m_loader.SetSection(cascade, sections - 1, 1, 0, 0, 0, 0) &&
+        !m_loader.SetSection(cascade, -1, 1, 0, 0, 0, 0) && !m_loader.SetSection(cascade, sections, 1, 0, 0, 0, 0);
+    m_loader.Dispose(cascade);
+    ASSERT_TRUE(passed, "SetSection range check");
+    return true;
+}
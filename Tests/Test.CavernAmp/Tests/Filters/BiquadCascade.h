@@ -0,0 +1,30 @@
+#ifndef BIQUADCASCADE_TESTS_H
+#define BIQUADCASCADE_TESTS_H
+
+#include "../../Loaders/Filters/BiquadCascade.h"
+
+class BiquadCascadeTests {
+public:
+    BiquadCascadeTests();
+    ~BiquadCascadeTests();
+
+    // Load the DLL before running tests
+    bool LoadLibrary(const wchar_t* dllPath);
+
+    // Run all tests, returns true if all passed
+    bool Run();
+
+    // Individual tests (called via C-style wrappers)
+    bool testSinglePrecision();
+    bool testDoublePrecision();
+    bool testSetSectionRange();
+
+private:
+    BiquadCascadeLoader m_loader;
+
+    // Filter the middle channel of an interleaved noise signal with a cascade of peaking sections in both calls of
+    // uneven lengths and compare it to the reference, while the other channels shall stay untouched
+    bool compareToReference(bool doublePrecision, double lowestFrequency);
+};
+
+#endif // BIQUADCASCADE_TESTS_H
@@ -0,0 +1,218 @@
+#include "BiquadFilter.h"
+#include "../../test.h"
+#include <cstdio>
+#include <cstring>
+
+// Global pointer to the current test instance (for C-style wrapper functions)
+static BiquadFilterTests* g_currentTests = nullptr;
+
+// --- C-style wrapper functions ---
+// These bridge between runTest(function pointer) and our member methods.
+static bool staticTest_BlockProcessingToggle() {
+    return g_currentTests ? g_currentTests->testBlockProcessingToggle() : false;
+}
+static bool staticTest_BlockProcessingEquivalence() {
+    return g_currentTests ? g_currentTests->testBlockProcessingEquivalence() : false;
+}
+static bool staticTest_BlockProcessingParameterChange() {
+    return g_currentTests ? g_currentTests->testBlockProcessingParameterChange() : false;
+}
+static bool staticTest_BlockProcessingLowFrequency() {
+    return g_currentTests ? g_currentTests->testBlockProcessingLowFrequency() : false;
+}
+
+// --- Helpers ---
+// Number of biquad filter types (BiquadFilterType in CavernAmp)
+static const int biquadTypes = 8;
+// Sample rate of all test filters
+static const int sampleRate = 48000;
+// Q of all test filters (Q_REF in CavernAmp)
+static const double qRef = 0.7071067811865475;
+// Gain of the filter types that have one: HighShelf, LowShelf, PeakingEQ
+static double gainOf(int type) {
+    return type == 3 || type == 5 || type == 7 ? 6 : 0;
+}
+
+// Deterministic white noise between -0.5 and 0.5
+static void fillNoise(float* samples, int len) {
+    unsigned int seed = 12345;
+    for (int i = 0; i < len; ++i) {
+        seed = seed * 1664525u + 1013904223u;
+        samples[i] = (seed >> 8) / 16777216.0f - 0.5f;
+    }
+}
+
+// Process a signal in calls of uneven lengths, which are not multiples of the block size
+static void processSplit(BiquadFilterLoader& loader, void* filter, float* samples, int len) {
+    const int splits[] = {1003, 5, 1, 64};
+    int position = 0;
+    for (int split : splits) {
+        loader.Process(filter, samples + position, split);
+        position += split;
+    }
+    loader.Process(filter, samples + position, len - position);
+}
+
+BiquadFilterTests::BiquadFilterTests() {}
+BiquadFilterTests::~BiquadFilterTests() {}
+
+bool BiquadFilterTests::LoadLibrary(const wchar_t* dllPath) {
+    return m_loader.Load(dllPath);
+}
+
+bool BiquadFilterTests::Run() {
+    printf("BiquadFilter tests:\n");
+
+    g_currentTests = this;
+    runTest("BlockProcessingToggle",          staticTest_BlockProcessingToggle);
+    runTest("BlockProcessingEquivalence",     staticTest_BlockProcessingEquivalence);
+    runTest("BlockProcessingParameterChange", staticTest_BlockProcessingParameterChange);
+    runTest("BlockProcessingLowFrequency",    staticTest_BlockProcessingLowFrequency);
+    g_currentTests = nullptr;
+
+    return g_testFailed == 0;
+}
+
+// ============================================================
+// Test 1: BlockProcessingToggle
+//
+// Meaning: Block processing is off by default, and can be turned
+// on and off again.
+// ============================================================
+bool BiquadFilterTests::testBlockProcessingToggle() {
+    void* filter = m_loader.Create(7, sampleRate, 1000, qRef, 6);
+    ASSERT_NOT_NULL(filter, "BiquadFilter_Create returned null");
+
+    bool defaultState = m_loader.GetBlockProcessing(filter);
+    m_loader.SetBlockProcessing(filter, true);
+    bool enabled = m_loader.GetBlockProcessing(filter);
+    m_loader.SetBlockProcessing(filter, false);
+    bool disabled = m_loader.GetBlockProcessing(filter);
+    m_loader.Dispose(filter);
+
+    ASSERT_TRUE(!defaultState, "Block processing should be disabled by default");
+    ASSERT_TRUE(enabled, "Block processing should be enabled");
+    ASSERT_TRUE(!disabled, "Block processing should be disabled again");
+    return true;
+}
+
+// ============================================================
+// Test 2: BlockProcessingEquivalence
+//
+// Meaning: For every filter type, the block state-space path gives
+// the same output as the sample-by-sample recurrence, even when
+// the signal is processed in calls of uneven lengths.
+// ============================================================
+bool BiquadFilterTests::testBlockProcessingEquivalence() {
+    const int len = 4099;
+    const double frequencies[] = {1000, 10000};
+    std::vector<float> scalar(len), block(len);
+    for (int type = 0; type < biquadTypes; ++type) {
+        for (double frequency : frequencies) {
+            void* reference = m_loader.Create(type, sampleRate, frequency, qRef, gainOf(type));
+            void* tested = m_loader.Create(type, sampleRate, frequency, qRef, gainOf(type));
+            ASSERT_NOT_NULL(reference, "BiquadFilter_Create returned null");
+            ASSERT_NOT_NULL(tested, "BiquadFilter_Create returned null");
+            m_loader.SetBlockProcessing(tested, true);
+
+            fillNoise(scalar.data(), len);
+            memcpy(block.data(), scalar.data(), len * sizeof(float));
+            m_loader.Process(reference, scalar.data(), len);
+            processSplit(m_loader, tested, block.data(), len);
+            m_loader.Dispose(reference);
+            m_loader.Dispose(tested);
+
+            for (int i = 0; i < len; ++i) {
+                char desc[256];
+                snprintf(desc, sizeof(desc), "type %d at %g Hz, sample %d", type, frequency, i);
+                ASSERT_APPROX_EQUAL(scalar[i], block[i], desc);
+            }
+        }
+    }
+    return true;
+}
+
+// ============================================================
+// Test 3: BlockProcessingParameterChange
+//
+// Meaning: Changing the filter's parameters while block processing
+// is enabled updates the block matrix, and the history carries
+// over the change like in the sample-by-sample path.
+// ============================================================
+bool BiquadFilterTests::testBlockProcessingParameterChange() {
+    const int len = 2051;
+    std::vector<float> scalar(len), block(len);
+    fillNoise(scalar.data(), len);
+    memcpy(block.data(), scalar.data(), len * sizeof(float));
+
+    void* reference = m_loader.Create(7, sampleRate, 1000, qRef, 6);
+    void* tested = m_loader.Create(7, sampleRate, 1000, qRef, 6);
+    ASSERT_NOT_NULL(reference, "BiquadFilter_Create returned null");
+    ASSERT_NOT_NULL(tested, "BiquadFilter_Create returned null");
+    m_loader.SetBlockProcessing(tested, true);
+
+    const int half = len / 2;
+    m_loader.Process(reference, scalar.data(), half);
+    m_loader.Process(tested, block.data(), half);
+    m_loader.SetCenterFreq(reference, 5000);
+    m_loader.SetCenterFreq(tested, 5000);
+    m_loader.Process(reference, scalar.data() + half, len - half);
+    m_loader.Process(tested, block.data() + half, len - half);
+    m_loader.Dispose(reference);
+    m_loader.Dispose(tested);
+
+    for (int i = 0; i < len; ++i) {
+        char desc[256];
+        snprintf(desc, sizeof(desc), "sample %d", i);
+        ASSERT_APPROX_EQUAL(scalar[i], block[i], desc);
+    }
+    return true;
+}
+
+// ============================================================
+// Test 4: BlockProcessingLowFrequency
+//
+// Meaning: With poles close to the unit circle, single precision
+// rounding accumulates in both paths, so they can't be compared to
+// each other within the tolerance. Instead, both are compared to
+// the recurrence calculated in double precision from the same
+// coefficients, and the block path can't be less accurate.
+// ============================================================
+bool BiquadFilterTests::testBlockProcessingLowFrequency() {
+    const int len = 48000;
+    std::vector<float> scalar(len), block(len);
+    for (int type = 0; type < biquadTypes; ++type) {
+        void* reference = m_loader.Create(type, sampleRate, 40, 5, gainOf(type));
+        void* tested = m_loader.Create(type, sampleRate, 40, 5, gainOf(type));
+        ASSERT_NOT_NULL(reference, "BiquadFilter_Create returned null");
+        ASSERT_NOT_NULL(tested, "BiquadFilter_Create returned null");
+        m_loader.SetBlockProcessing(tested, true);
+        double b0 = m_loader.GetB0(reference), b1 = m_loader.GetB1(reference), b2 = m_loader.GetB2(reference),
+            a1 = m_loader.GetA1(reference), a2 = m_loader.GetA2(reference);
+
+        fillNoise(scalar.data(), len);
+        memcpy(block.data(), scalar.data(), len * sizeof(float));
+        double x1 = 0, x2 = 0, y1 = 0, y2 = 0, scalarError = 0, blockError = 0;
+        std::vector<double> exact(len);
+        for (int i = 0; i < len; ++i) {
+            exact[i] = b0 * scalar[i] + b1 * x1 + b2 * x2 - a1 * y1 - a2 * y2;
+            x2 = x1;
+            x1 = scalar[i];
+            y2 = y1;
+            y1 = exact[i];
+        }
+        m_loader.Process(reference, scalar.data(), len);
+        processSplit(m_loader, tested, block.data(), len);
+        m_loader.Dispose(reference);
+        m_loader.Dispose(tested);
+
+        for (int i = 0; i < len; ++i) {
+            scalarError = std::fmax(scalarError, std::fabs(scalar[i] - exact[i]));
+            blockError = std::fmax(blockError, std::fabs(block[i] - exact[i]));
+        }
+        char desc[256];
+        snprintf(desc, sizeof(desc), "type %d: block error %e, scalar error %e", type, blockError, scalarError);
+        ASSERT_TRUE(blockError <= scalarError, desc);
+    }
+    return true;
+}
@@ -0,0 +1,27 @@
+#ifndef BIQUADFILTER_TESTS_H
+#define BIQUADFILTER_TESTS_H
+
+#include "../../Loaders/Filters/BiquadFilter.h"
+
+class BiquadFilterTests {
+public:
+    BiquadFilterTests();
+    ~BiquadFilterTests();
+
+    // Load the DLL before running tests
+    bool LoadLibrary(const wchar_t* dllPath);
+
+    // Run all tests, returns true if all passed
+    bool Run();
+
+    // Individual tests (called via C-style wrappers)
+    bool testBlockProcessingToggle();
+    bool testBlockProcessingEquivalence();
+    bool testBlockProcessingParameterChange();
+    bool testBlockProcessingLowFrequency();
+
+private:
+    BiquadFilterLoader m_loader;
+};
+
+#endif // BIQUADFILTER_TESTS_H
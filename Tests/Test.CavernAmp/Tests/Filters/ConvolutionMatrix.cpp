@@ -0,0 +1,188 @@
+#include "ConvolutionMatrix.h"
+#include "Reference.h"
+#include "../../test.h"
+#include <cstdio>
+#include <cstring>
+
+// Global pointer to the current test instance (for C-style wrapper functions)
+static ConvolutionMatrixTests* g_currentTests = nullptr;
+
+// --- C-style wrapper functions ---
+// These bridge between runTest(function pointer) and our member methods.
+static bool staticTest_Routing() {
+    return g_currentTests ? g_currentTests->testRouting() : false;
+}
+static bool staticTest_RouteRemoval() {
+    return g_currentTests ? g_currentTests->testRouteRemoval() : false;
+}
+static bool staticTest_SetFilterRange() {
+    return g_currentTests ? g_currentTests->testSetFilterRange() : false;
+}
+
+// --- Helpers ---
+// Channels of the tested matrices
+static const int inputs = 3, outputs = 3;
+// Longest filter of the tested matrices
+static const int maxLength = 256;
+// Frames of the test signals
+static const int frames = 2500;
+
+// Take a channel of an interleaved signal
+static std::vector<float> deinterleave(const std::vector<float>& interleaved, int channel, int channels) {
+    std::vector<float> result(interleaved.size() / channels);
+    for (size_t i = 0; i < result.size(); ++i) {
+        result[i] = interleaved[i * channels + channel];
+    }
+    return result;
+}
+
+// Process the input in calls of uneven lengths
+static void processSplit(ConvolutionMatrixLoader& loader, void* matrix, const float* input, float* output, int frames) {
+    const int callLength = 300;
+    for (int start = 0; start < frames; start += callLength) {
+        int count = frames - start < callLength ? frames - start : callLength;
+        loader.Process(matrix, input + start * inputs, output + start * outputs, count);
+    }
+}
+
+ConvolutionMatrixTests::ConvolutionMatrixTests() {}
+ConvolutionMatrixTests::~ConvolutionMatrixTests() {}
+
+bool ConvolutionMatrixTests::LoadLibrary(const wchar_t* dllPath) {
+    return m_loader.Load(dllPath);
+}
+
+bool ConvolutionMatrixTests::Run() {
+    printf("ConvolutionMatrix tests:\n");
+
+    g_currentTests = this;
+    runTest("Routing",        staticTest_Routing);
+    runTest("RouteRemoval",   staticTest_RouteRemoval);
+    runTest("SetFilterRange", staticTest_SetFilterRange);
+    g_currentTests = nullptr;
+
+    return g_testFailed == 0;
+}
+
+// ============================================================
+// Test 1: Routing
+//
+// Meaning: Each output is the sum of its routed inputs convolved
+// with the routes' filters, also when the channels are transformed
+// on multiple threads. An output without routes is silent, even if
+// the output buffer had content, and an input without routes
+// doesn't leak to any output.
+// ============================================================
+bool ConvolutionMatrixTests::testRouting() {
+    // Input 0 to output 0, input 1 to outputs 0 and 2, input 2 is not routed, output 1 has no routes
+    const int routes[][2] = {{0, 0}, {1, 0}, {1, 2}};
+    const int lengths[] = {maxLength, 100, 1};
+    std::vector<float> impulses[3];
+    for (int route = 0; route < 3; ++route) {
+        impulses[route].resize(lengths[route]);
+        fillNoise(impulses[route].data(), lengths[route], 20 + route, 0.2f);
+    }
+    std::vector<float> input(frames * inputs);
+    fillNoise(input.data(), frames * inputs, 1, 1);
+
+    for (int multithreaded = 0; multithreaded < 2; ++multithreaded) {
+        void* matrix = m_loader.Create(inputs, outputs, maxLength);
+        ASSERT_NOT_NULL(matrix, "ConvolutionMatrix_Create returned null");
+        m_loader.SetMultithreaded(matrix, multithreaded != 0);
+        bool set = true;
+        for (int route = 0; route < 3; ++route) {
+            set &= m_loader.SetFilter(matrix, routes[route][0], routes[route][1], impulses[route].data(), lengths[route]);
+        }
+        std::vector<float> output(frames * outputs);
+        fillNoise(output.data(), frames * outputs, 2, 1);
+        processSplit(m_loader, matrix, input.data(), output.data(), frames);
+        m_loader.Dispose(matrix);
+        ASSERT_TRUE(set, "SetFilter should accept filters up to the maximum length");
+
+        std::vector<double> expected[outputs];
+        for (int channel = 0; channel < outputs; ++channel) {
+            expected[channel].assign(frames, 0.0);
+        }
+        for (int route = 0; route < 3; ++route) {
+            std::vector<float> source = deinterleave(input, routes[route][0], inputs);
+            std::vector<double> filtered = convolveDirect(source.data(), frames, impulses[route].data(), lengths[route]);
+            for (int i = 0; i < frames; ++i) {
+                expected[routes[route][1]][i] += filtered[i];
+            }
+        }
+        for (int i = 0; i < frames; ++i) {
+            for (int channel = 0; channel < outputs; ++channel) {
+                char desc[256];
+                snprintf(desc, sizeof(desc), "multithreaded: %d, output %d, frame %d", multithreaded, channel, i);
+                ASSERT_APPROX_EQUAL((float)expected[channel][i], output[i * outputs + channel], desc);
+            }
+        }
+    }
+    return true;
+}
+
+// ============================================================
+// Test 2: RouteRemoval
+//
+// Meaning: Removing a route mid-stream stops new input from
+// reaching its output, while the tail of the already filtered
+// input is still output.
+// ============================================================
+bool ConvolutionMatrixTests::testRouteRemoval() {
+    const int len = 100, half = frames / 2;
+    float impulse[len];
+    fillNoise(impulse, len, 30, 0.2f);
+    std::vector<float> input(frames * inputs);
+    fillNoise(input.data(), frames * inputs, 3, 1);
+
+    void* matrix = m_loader.Create(inputs, outputs, maxLength);
+    ASSERT_NOT_NULL(matrix, "ConvolutionMatrix_Create returned null");
+    m_loader.SetFilter(matrix, 2, 1, impulse, len);
+    std::vector<float> output(frames * outputs);
+    m_loader.Process(matrix, input.data(), output.data(), half);
+    bool removed = m_loader.SetFilter(matrix, 2, 1, nullptr, 0);
+    m_loader.Process(matrix, input.data() + half * inputs, output.data() + half * outputs, frames - half);
+    m_loader.Dispose(matrix);
+    ASSERT_TRUE(removed, "A route should be removed by a null impulse");
+
+    std::vector<float> source = deinterleave(input, 2, inputs);
+    std::vector<double> expected = convolveDirect(source.data(), half, impulse, len);
+    expected.resize(frames, 0.0);
+    for (int i = half; i < half + len - 1; ++i) { // The tail of the last inputs before the removal
+        for (int tap = i - half + 1; tap < len; ++tap) {
+            expected[i] += (double)impulse[tap] * source[i - tap];
+        }
+    }
+    for (int i = 0; i < frames; ++i) {
+        char desc[256];
+        snprintf(desc, sizeof(desc), "output 1, frame %d", i);
+        ASSERT_APPROX_EQUAL((float)expected[i], output[i * outputs + 1], desc);
+        snprintf(desc, sizeof(desc), "unrouted outputs should be silent at frame %d", i);
+        ASSERT_TRUE(output[i * outputs] == 0 && output[i * outputs + 2] == 0, desc);
+    }
+    return true;
+}
+
+// ============================================================
+// Test 3: SetFilterRange
+//
+// Meaning: Filters longer than GetMaxLength and channels out of
+// range are rejected.
+// ============================================================
+bool ConvolutionMatrixTests::testSetFilterRange() {
+    void* matrix = m_loader.Create(inputs, outputs, maxLength);
+    ASSERT_NOT_NULL(matrix, "ConvolutionMatrix_Create returned null");
+    int actualMaxLength = m_loader.GetMaxLength(matrix);
+    std::vector<float> impulse(actualMaxLength + 1, 0.0f);
+    bool longest = m_loader.SetFilter(matrix, 0, 0, impulse.data(), actualMaxLength),
+        tooLong = m_loader.SetFilter(matrix, 0, 0, impulse.data(), actualMaxLength + 1),
+        badInput = m_loader.SetFilter(matrix, inputs, 0, impulse.data(), 1),
+        badOutput = m_loader.SetFilter(matrix, 0, -1, impulse.data(), 1);
+    m_loader.Dispose(matrix);
+
+    ASSERT_TRUE(actualMaxLength >= maxLength, "GetMaxLength should be at least the requested length");
+    ASSERT_TRUE(longest, "A filter of GetMaxLength samples should be accepted");
+    ASSERT_TRUE(!tooLong, "A filter longer than GetMaxLength should be rejected");
+    ASSERT_TRUE(!badInput && !badOutput, "Channels out of range should be rejected");
+    return true;
+}
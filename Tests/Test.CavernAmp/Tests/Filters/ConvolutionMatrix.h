@@ -0,0 +1,26 @@
+#ifndef CONVOLUTIONMATRIX_TESTS_H
+#define CONVOLUTIONMATRIX_TESTS_H
+
+#include "../../Loaders/Filters/ConvolutionMatrix.h"
+
+class ConvolutionMatrixTests {
+public:
+    ConvolutionMatrixTests();
+    ~ConvolutionMatrixTests();
+
+    // Load the DLL before running tests
+    bool LoadLibrary(const wchar_t* dllPath);
+
+    // Run all tests, returns true if all passed
+    bool Run();
+
+    // Individual tests (called via C-style wrappers)
+    bool testRouting();
+    bool testRouteRemoval();
+    bool testSetFilterRange();
+
+private:
+    ConvolutionMatrixLoader m_loader;
+};
+
+#endif // CONVOLUTIONMATRIX_TESTS_H
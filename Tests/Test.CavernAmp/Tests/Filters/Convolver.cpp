@@ -0,0 +1,131 @@
+#include "Convolver.h"
+#include "Reference.h"
+#include "../../test.h"
+#include <cstdio>
+#include <cstring>
+
+// Global pointer to the current test instance (for C-style wrapper functions)
+static ConvolverTests* g_currentTests = nullptr;
+
+// --- C-style wrapper functions ---
+// These bridge between runTest(function pointer) and our member methods.
+static bool staticTest_DirectForm() {
+    return g_currentTests ? g_currentTests->testDirectForm() : false;
+}
+static bool staticTest_CreateOptimal() {
+    return g_currentTests ? g_currentTests->testCreateOptimal() : false;
+}
+
+// --- Helpers ---
+// Interleaved layout of the test signals, the middle channel is filtered
+static const int channels = 3, channel = 1;
+// Frames of the test signals
+static const int frames = 3000;
+// Calls of uneven lengths, shorter and longer than the impulses, the rest of the signal is processed in the last call
+static const int callLengths[] = {1, 5, 63, 64, 1000};
+
+// Convolve the middle channel of an interleaved noise signal with an impulse and a delay, and compare it to the
+// direct convolution, while the other channels shall stay untouched
+template<typename Processor>
+static bool compareToReference(const float* impulse, int len, int delay, Processor process) {
+    std::vector<float> signal(frames), original(frames * channels);
+    fillNoise(signal.data(), frames, 1, 1);
+    fillNoise(original.data(), frames * channels, 2, 1);
+    interleave(original.data(), signal.data(), frames, channel, channels);
+    std::vector<float> output = original;
+    int position = 0;
+    for (int callLength : callLengths) {
+        process(output.data() + position * channels, callLength * channels);
+        position += callLength;
+    }
+    process(output.data() + position * channels, (frames - position) * channels);
+
+    std::vector<float> delayed(delay + len, 0.0f);
+    memcpy(delayed.data() + delay, impulse, len * sizeof(float));
+    std::vector<double> expected = convolveDirect(signal.data(), frames, delayed.data(), delay + len);
+    for (int i = 0; i < frames; ++i) {
+        char desc[256];
+        snprintf(desc, sizeof(desc), "%d taps, delay %d, frame %d", len, delay, i);
+        ASSERT_APPROX_EQUAL((float)expected[i], output[i * channels + channel], desc);
+        for (int other = 0; other < channels; ++other) {
+            if (other != channel) {
+                snprintf(desc, sizeof(desc), "%d taps, delay %d, channel %d changed at frame %d", len, delay, other, i);
+                ASSERT_TRUE(output[i * channels + other] == original[i * channels + other], desc);
+            }
+        }
+    }
+    return true;
+}
+
+ConvolverTests::ConvolverTests() {}
+ConvolverTests::~ConvolverTests() {}
+
+bool ConvolverTests::LoadLibrary(const wchar_t* dllPath) {
+    return m_loader.Load(dllPath);
+}
+
+bool ConvolverTests::Run() {
+    printf("Convolver tests:\n");
+
+    g_currentTests = this;
+    runTest("DirectForm",    staticTest_DirectForm);
+    runTest("CreateOptimal", staticTest_CreateOptimal);
+    g_currentTests = nullptr;
+
+    return g_testFailed == 0;
+}
+
+// ============================================================
+// Test 1: DirectForm
+//
+// Meaning: The direct form convolution matches the reference with
+// and without delay, when the calls are shorter or longer than the
+// impulse, or not a multiple of the 8 samples processed at once.
+// ============================================================
+bool ConvolverTests::testDirectForm() {
+    const int lengths[] = {1, 7, 64, 200};
+    const int delays[] = {0, 37};
+    for (int len : lengths) {
+        std::vector<float> impulse(len);
+        fillNoise(impulse.data(), len, 3 + len, 0.2f);
+        for (int delay : delays) {
+            void* conv = m_loader.Create(impulse.data(), len, delay);
+            ASSERT_NOT_NULL(conv, "Convolver_Create returned null");
+            bool matches = compareToReference(impulse.data(), len, delay, [&](float* samples, int count) {
+                m_loader.Process(conv, samples, count, channel, channels);
+            });
+            m_loader.Dispose(conv);
+            if (!matches) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// ============================================================
+// Test 2: CreateOptimal
+//
+// Meaning: Whichever convolution the factory picks for short and
+// long impulses and block sizes, its output matches the reference.
+// ============================================================
+bool ConvolverTests::testCreateOptimal() {
+    const int lengths[] = {16, 2000};
+    const int blockSizes[] = {0, 64};
+    for (int len : lengths) {
+        std::vector<float> impulse(len);
+        fillNoise(impulse.data(), len, 4 + len, 0.05f);
+        for (int blockSize : blockSizes) {
+            void* filter = m_loader.CreateOptimal(impulse.data(), len, 5, blockSize);
+            ASSERT_NOT_NULL(filter, "Convolver_CreateOptimal returned null");
+            bool matches = compareToReference(impulse.data(), len, 5, [&](float* samples, int count) {
+                m_loader.FilterProcessChannel(filter, samples, count, channel, channels);
+            });
+            m_loader.FilterDispose(filter);
+            if (!matches) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
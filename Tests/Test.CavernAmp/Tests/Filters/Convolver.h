@@ -0,0 +1,25 @@
+#ifndef CONVOLVER_TESTS_H
+#define CONVOLVER_TESTS_H
+
+#include "../../Loaders/Filters/Convolver.h"
+
+class ConvolverTests {
+public:
+    ConvolverTests();
+    ~ConvolverTests();
+
+    // Load the DLL before running tests
+    bool LoadLibrary(const wchar_t* dllPath);
+
+    // Run all tests, returns true if all passed
+    bool Run();
+
+    // Individual tests (called via C-style wrappers)
+    bool testDirectForm();
+    bool testCreateOptimal();
+
+private:
+    ConvolverLoader m_loader;
+};
+
+#endif // CONVOLVER_TESTS_H
@@ -1,4 +1,5 @@
 #include "FastConvolver.h"
+#include "Reference.h"
 #include "../../test.h"
 #include <cstdio>
 #include <cstring>
@@ -26,6 +27,21 @@ static bool staticTest_MultipleCycles() {
 static bool staticTest_FastConvolverWithDelay() {
     return g_currentTests ? g_currentTests->testFastConvolverWithDelay() : false;
 }
+static bool staticTest_FastConvolverMixedRadix() {
+    return g_currentTests ? g_currentTests->testFastConvolverMixedRadix() : false;
+}
+static bool staticTest_FastConvolverLongDelay() {
+    return g_currentTests ? g_currentTests->testFastConvolverLongDelay() : false;
+}
+static bool staticTest_FastConvolverImpulseSwap() {
+    return g_currentTests ? g_currentTests->testFastConvolverImpulseSwap() : false;
+}
+static bool staticTest_FastConvolverSilenceSkipping() {
+    return g_currentTests ? g_currentTests->testFastConvolverSilenceSkipping() : false;
+}
+static bool staticTest_FastConvolverSharedSpectrum() {
+    return g_currentTests ? g_currentTests->testFastConvolverSharedSpectrum() : false;
+}
 
 FastConvolverTests::FastConvolverTests() {}
 FastConvolverTests::~FastConvolverTests() {}
@@ -44,6 +60,11 @@ bool FastConvolverTests::Run() {
     runTest("FastConvolverGetLength", staticTest_FastConvolverGetLength);
     runTest("MultipleCycles",         staticTest_MultipleCycles);
     runTest("FastConvolverWithDelay", staticTest_FastConvolverWithDelay);
+    runTest("FastConvolverMixedRadix", staticTest_FastConvolverMixedRadix);
+    runTest("FastConvolverLongDelay", staticTest_FastConvolverLongDelay);
+    runTest("FastConvolverImpulseSwap", staticTest_FastConvolverImpulseSwap);
+    runTest("FastConvolverSilenceSkipping", staticTest_FastConvolverSilenceSkipping);
+    runTest("FastConvolverSharedSpectrum", staticTest_FastConvolverSharedSpectrum);
     g_currentTests = nullptr;
 
     return g_testFailed == 0;
@@ -219,3 +240,249 @@ bool FastConvolverTests::testFastConvolverWithDelay() {
     // Should not crash or corrupt memory
     return true;
 }
+
+// Test: Long filters are padded to a cheaper 3 * 2^n length, and still convolve correctly
+bool FastConvolverTests::testFastConvolverMixedRadix() {
+    const int len = 3000, shift = 1500, signalLength = 8192;
+    std::vector<float> impulse(len, 0.0f);
+    impulse[shift] = 1.0f;
+
+    void* conv = m_loader.Create(impulse.data(), len, 0);
+    if (!conv) return false;
+
+    // The smallest length holding twice the filter is 6144 = 3 * 2^11, cheaper to transform than 8192
+    int actualLength = m_loader.GetLength(conv);
+    if (actualLength != 6144) {
+        m_loader.Dispose(conv);
+        fprintf(stderr, "\n  GetLength expected %d, got %d\n", 6144, actualLength);
+        return false;
+    }
+
+    std::vector<float> signal(signalLength);
+    for (int i = 0; i < signalLength; ++i) {
+        signal[i] = 0.5f * sinf(i * 0.01f);
+    }
+    std::vector<float> output = signal;
+    m_loader.Process(conv, output.data(), signalLength, 0, 1);
+    m_loader.Dispose(conv);
+
+    // A shifted Dirac delta only delays the signal
+    for (int i = 0; i < signalLength; ++i) {
+        float expected = i < shift ? 0.0f : signal[i - shift];
+        char desc[256];
+        snprintf(desc, sizeof(desc), "output[%d]: expected %f", i, expected);
+        ASSERT_APPROX_EQUAL(expected, output[i], desc);
+    }
+    return true;
+}
+
+// Test: Delays longer than the filter wrap around the overlap buffer multiple times, with blocks of any size
+bool FastConvolverTests::testFastConvolverLongDelay() {
+    float impulse[] = {0.5f, 0.0f, 0.25f};
+    const int len = 3, delay = 1000, signalLength = 5000;
+    const int blockSizes[] = {1, 7, 64, 333};
+
+    for (int blockSize : blockSizes) {
+        void* conv = m_loader.Create(impulse, len, delay);
+        if (!conv) return false;
+
+        std::vector<float> signal(signalLength);
+        for (int i = 0; i < signalLength; ++i) {
+            signal[i] = 0.5f * sinf(i * 0.03f);
+        }
+        std::vector<float> output = signal;
+        for (int start = 0; start < signalLength; start += blockSize) {
+            int count = signalLength - start < blockSize ? signalLength - start : blockSize;
+            m_loader.Process(conv, output.data() + start, count, 0, 1);
+        }
+        m_loader.Dispose(conv);
+
+        for (int i = 0; i < signalLength; ++i) {
+            float expected = 0;
+            for (int tap = 0; tap < len; ++tap) {
+                int source = i - delay - tap;
+                if (source >= 0) {
+                    expected += impulse[tap] * signal[source];
+                }
+            }
+            char desc[256];
+            snprintf(desc, sizeof(desc), "block %d, output[%d]: expected %f", blockSize, i, expected);
+            ASSERT_APPROX_EQUAL(expected, output[i], desc);
+        }
+    }
+    return true;
+}
+
+// Test: Swapping the impulse mid-stream keeps the old filter's output until the swap, crossfades the contribution of the
+// first block after the swap, and only uses the new filter for later blocks. The second swap reuses the spectrum that
+// was swapped out by the first one.
+bool FastConvolverTests::testFastConvolverImpulseSwap() {
+    const int len = 50, blocks = 12;
+    const int swapBlocks[] = {4, 8};
+    float impulses[3][len], unheard[len];
+    for (int i = 0; i < 3; ++i) {
+        fillNoise(impulses[i], len, i + 1, 0.2f);
+    }
+    fillNoise(unheard, len, 4, 0.2f);
+
+    void* conv = m_loader.Create(impulses[0], len, 0);
+    if (!conv) return false;
+    const int blockSize = m_loader.GetLength(conv) / 2, signalLength = blocks * blockSize;
+    std::vector<float> signal(signalLength);
+    fillNoise(signal.data(), signalLength, 5, 1);
+
+    // Before the first swap, the impulse is replaced twice: the first replacement shall never be heard
+    std::vector<float> output = signal;
+    bool replaced = true;
+    for (int block = 0; block < blocks; ++block) {
+        if (block == swapBlocks[0]) {
+            replaced &= m_loader.SetImpulse(conv, unheard, len) && m_loader.SetImpulse(conv, impulses[1], len);
+        } else if (block == swapBlocks[1]) {
+            replaced &= m_loader.SetImpulse(conv, impulses[2], len);
+        }
+        m_loader.Process(conv, output.data() + block * blockSize, blockSize, 0, 1);
+    }
+    bool tooLong = m_loader.SetImpulse(conv, signal.data(), blockSize + 1);
+    m_loader.Dispose(conv);
+    ASSERT_TRUE(replaced, "SetImpulse should accept impulses up to half of GetLength");
+    ASSERT_TRUE(!tooLong, "SetImpulse should reject impulses longer than half of GetLength");
+
+    // Each input block is convolved with the impulse active in that block. In a swap block, the block's own output
+    // fades from the old to the new impulse, while the tail it leaves for the next block is fully the new impulse's.
+    for (int i = 0; i < signalLength; ++i) {
+        double expected = 0;
+        for (int tap = 0; tap < len && tap <= i; ++tap) {
+            int source = i - tap, block = source / blockSize, active = 0;
+            for (int swap : swapBlocks) {
+                active += block >= swap;
+            }
+            double contribution = (double)impulses[active][tap] * signal[source];
+            if (active && block == swapBlocks[active - 1] && i / blockSize == block) {
+                double old = (double)impulses[active - 1][tap] * signal[source],
+                    gain = (double)(i - block * blockSize + 1) / (blockSize + 1);
+                contribution = old + (contribution - old) * gain;
+            }
+            expected += contribution;
+        }
+        char desc[256];
+        snprintf(desc, sizeof(desc), "output[%d]: expected %f", i, expected);
+        ASSERT_APPROX_EQUAL((float)expected, output[i], desc);
+    }
+    return true;
+}
+
+// Test: Silent blocks skip the transforms, but still output the tail of earlier blocks. When that has also ended, only
+// zeros are written. Signal after the silence is convolved like the silence was processed.
+bool FastConvolverTests::testFastConvolverSilenceSkipping() {
+    const int len = 100, signalBlocks = 3, silentBlocks = 6, blocks = 2 * signalBlocks + silentBlocks;
+    float impulse[len];
+    fillNoise(impulse, len, 1, 0.2f);
+
+    void* conv = m_loader.Create(impulse, len, 0);
+    if (!conv) return false;
+    const int blockSize = m_loader.GetLength(conv) / 2, signalLength = blocks * blockSize,
+        silenceStart = signalBlocks * blockSize, silenceEnd = silenceStart + silentBlocks * blockSize;
+    std::vector<float> signal(signalLength, 0.0f);
+    fillNoise(signal.data(), silenceStart, 2, 1);
+    fillNoise(signal.data() + silenceEnd, signalLength - silenceEnd, 3, 1);
+
+    std::vector<float> output = signal;
+    for (int block = 0; block < blocks; ++block) {
+        m_loader.Process(conv, output.data() + block * blockSize, blockSize, 0, 1);
+    }
+    long long timeslots = m_loader.GetTimeslots(conv), skipped = m_loader.GetSkippedTimeslots(conv),
+        drained = m_loader.GetDrainedTimeslots(conv);
+    m_loader.Dispose(conv);
+
+    // The first silent block still outputs the tail of the last signal block, the rest have nothing to output
+    ASSERT_TRUE(timeslots == blocks, "Each block should be processed in a single timeslot");
+    ASSERT_TRUE(skipped == silentBlocks, "The transforms should be skipped in all silent blocks");
+    ASSERT_TRUE(drained == silentBlocks - 1, "All silent blocks but the first one should be drained");
+
+    for (int i = 0; i < signalLength; ++i) {
+        double expected = 0;
+        for (int tap = 0; tap < len && tap <= i; ++tap) {
+            expected += (double)impulse[tap] * signal[i - tap];
+        }
+        char desc[256];
+        snprintf(desc, sizeof(desc), "output[%d]: expected %f", i, expected);
+        ASSERT_APPROX_EQUAL((float)expected, output[i], desc);
+        if (i >= silenceStart + blockSize && i < silenceEnd) {
+            snprintf(desc, sizeof(desc), "output[%d] should be exactly zero in a drained block", i);
+            ASSERT_TRUE(output[i] == 0, desc);
+        }
+    }
+    return true;
+}
+
+// Test: Clones share the spectrum of the original, so any number of them holds a single spectrum, which is freed with the
+// last one. Replacing the impulse of one clone writes a new spectrum for that clone only, the others keep their output.
+bool FastConvolverTests::testFastConvolverSharedSpectrum() {
+    const int len = 1000, clones = 8, changed = 3, blocks = 4, swapBlock = 2;
+    float impulse[len], replacement[len];
+    fillNoise(impulse, len, 1, 0.05f);
+    fillNoise(replacement, len, 2, 0.05f);
+
+    const long long before = m_loader.GetSpectrumMemoryUsage();
+    void* filters[clones + 1];
+    filters[0] = m_loader.Create(impulse, len, 0);
+    if (!filters[0]) return false;
+    const int filterLength = m_loader.GetLength(filters[0]), blockSize = filterLength / 2,
+        signalLength = blocks * blockSize;
+    const long long spectrum = (filterLength / 2 + 1) * 2 * (long long)sizeof(float),
+        instance = m_loader.GetMemoryUsage(filters[0]);
+    for (int i = 1; i <= clones; ++i) {
+        filters[i] = m_loader.Clone(filters[0]);
+    }
+    long long shared = m_loader.GetSpectrumMemoryUsage() - before;
+    bool sameInstances = true;
+    for (int i = 1; i <= clones; ++i) {
+        sameInstances &= filters[i] && m_loader.GetMemoryUsage(filters[i]) == instance;
+    }
+
+    std::vector<float> signal(signalLength);
+    fillNoise(signal.data(), signalLength, 3, 1);
+    std::vector<std::vector<float>> outputs(clones + 1, signal);
+    bool replaced = true;
+    for (int block = 0; block < blocks; ++block) {
+        if (block == swapBlock) {
+            replaced = m_loader.SetImpulse(filters[changed], replacement, len);
+        }
+        for (int i = 0; i <= clones; ++i) {
+            m_loader.Process(filters[i], outputs[i].data() + block * blockSize, blockSize, 0, 1);
+        }
+    }
+    long long afterSwap = m_loader.GetSpectrumMemoryUsage() - before,
+        changedInstance = m_loader.GetMemoryUsage(filters[changed]);
+    for (int i = 0; i <= clones; ++i) {
+        m_loader.Dispose(filters[i]);
+    }
+    long long afterDispose = m_loader.GetSpectrumMemoryUsage() - before;
+
+    char desc[256];
+    snprintf(desc, sizeof(desc), "%d clones should hold one spectrum of %lld bytes, got %lld", clones, spectrum, shared);
+    ASSERT_TRUE(shared == spectrum, desc);
+    ASSERT_TRUE(sameInstances, "Clones should use as much memory as the original besides the shared spectrum");
+    ASSERT_TRUE(replaced, "SetImpulse on a clone should succeed");
+    snprintf(desc, sizeof(desc), "A replaced impulse should only add one spectrum, got %lld bytes", afterSwap);
+    ASSERT_TRUE(afterSwap == 2 * spectrum, desc);
+    ASSERT_TRUE(changedInstance > instance, "The crossfade buffer should only be allocated by SetImpulse");
+    ASSERT_TRUE(afterDispose == 0, "All spectra should be freed with the last filter using them");
+
+    std::vector<double> expected = convolveDirect(signal.data(), signalLength, impulse, len);
+    for (int i = 0; i <= clones; ++i) {
+        if (i == changed) {
+            continue;
+        }
+        for (int sample = 0; sample < signalLength; ++sample) {
+            snprintf(desc, sizeof(desc), "filter %d, output[%d]", i, sample);
+            ASSERT_APPROX_EQUAL((float)expected[sample], outputs[i][sample], desc);
+        }
+    }
+    // Before the swap, the changed clone still matches the others
+    for (int sample = 0; sample < swapBlock * blockSize; ++sample) {
+        snprintf(desc, sizeof(desc), "changed clone before the swap, output[%d]", sample);
+        ASSERT_APPROX_EQUAL((float)expected[sample], outputs[changed][sample], desc);
+    }
+    return true;
+}
@@ -26,6 +26,11 @@ public:
     bool testFastConvolverGetLength();
     bool testMultipleCycles();
     bool testFastConvolverWithDelay();
+    bool testFastConvolverMixedRadix();
+    bool testFastConvolverLongDelay();
+    bool testFastConvolverImpulseSwap();
+    bool testFastConvolverSilenceSkipping();
+    bool testFastConvolverSharedSpectrum();
 
 private:
     FastConvolverLoader m_loader;
@@ -0,0 +1,142 @@
+#include "MultichannelConvolver.h"
+#include "Reference.h"
+#include "../../test.h"
+#include <cstdio>
+#include <cstring>
+
+// Global pointer to the current test instance (for C-style wrapper functions)
+static MultichannelConvolverTests* g_currentTests = nullptr;
+
+// --- C-style wrapper functions ---
+// These bridge between runTest(function pointer) and our member methods.
+static bool staticTest_AllChannels() {
+    return g_currentTests ? g_currentTests->testAllChannels() : false;
+}
+static bool staticTest_ChannelOffset() {
+    return g_currentTests ? g_currentTests->testChannelOffset() : false;
+}
+
+// --- Helpers ---
+// Length of the impulses of all channels
+static const int impulseLength = 200;
+// Frames of the test signals
+static const int frames = 3000;
+
+// A different random impulse for each channel
+static std::vector<std::vector<float>> channelImpulses(int channels) {
+    std::vector<std::vector<float>> impulses(channels, std::vector<float>(impulseLength));
+    for (int channel = 0; channel < channels; ++channel) {
+        fillNoise(impulses[channel].data(), impulseLength, 10 + channel, 0.2f);
+    }
+    return impulses;
+}
+
+// Create a convolver with a separate impulse for each channel
+static void* createConvolver(MultichannelConvolverLoader& loader, const std::vector<std::vector<float>>& impulses) {
+    std::vector<const float*> pointers;
+    for (const std::vector<float>& impulse : impulses) {
+        pointers.push_back(impulse.data());
+    }
+    return loader.Create(pointers.data(), impulseLength, (int)impulses.size());
+}
+
+MultichannelConvolverTests::MultichannelConvolverTests() {}
+MultichannelConvolverTests::~MultichannelConvolverTests() {}
+
+bool MultichannelConvolverTests::LoadLibrary(const wchar_t* dllPath) {
+    return m_loader.Load(dllPath);
+}
+
+bool MultichannelConvolverTests::Run() {
+    printf("MultichannelConvolver tests:\n");
+
+    g_currentTests = this;
+    runTest("AllChannels",   staticTest_AllChannels);
+    runTest("ChannelOffset", staticTest_ChannelOffset);
+    g_currentTests = nullptr;
+
+    return g_testFailed == 0;
+}
+
+// ============================================================
+// Test 1: AllChannels
+//
+// Meaning: Each channel of an interleaved signal is convolved with
+// its own impulse, also with an odd channel count, where the last
+// channel has no pair, and when the pairs are processed on
+// multiple threads. The signal is processed in calls of uneven
+// lengths.
+// ============================================================
+bool MultichannelConvolverTests::testAllChannels() {
+    const int channels = 5, callLength = 333;
+    std::vector<std::vector<float>> impulses = channelImpulses(channels);
+    std::vector<float> signal(frames * channels);
+    fillNoise(signal.data(), frames * channels, 1, 1);
+
+    for (int multithreaded = 0; multithreaded < 2; ++multithreaded) {
+        void* conv = createConvolver(m_loader, impulses);
+        ASSERT_NOT_NULL(conv, "MultichannelConvolver_Create returned null");
+        m_loader.SetMultithreaded(conv, multithreaded != 0);
+        std::vector<float> output = signal;
+        for (int start = 0; start < frames; start += callLength) {
+            int count = frames - start < callLength ? frames - start : callLength;
+            m_loader.Process(conv, output.data() + start * channels, count * channels);
+        }
+        m_loader.Dispose(conv);
+
+        std::vector<float> channelSignal(frames);
+        for (int channel = 0; channel < channels; ++channel) {
+            for (int i = 0; i < frames; ++i) {
+                channelSignal[i] = signal[i * channels + channel];
+            }
+            std::vector<double> expected = convolveDirect(channelSignal.data(), frames, impulses[channel].data(),
+                impulseLength);
+            for (int i = 0; i < frames; ++i) {
+                char desc[256];
+                snprintf(desc, sizeof(desc), "multithreaded: %d, channel %d, frame %d", multithreaded, channel, i);
+                ASSERT_APPROX_EQUAL((float)expected[i], output[i * channels + channel], desc);
+            }
+        }
+    }
+    return true;
+}
+
+// ============================================================
+// Test 2: ChannelOffset
+//
+// Meaning: A convolver of 3 channels filters channels 2 to 4 of a
+// 6 channel signal, and leaves the other channels untouched.
+// ============================================================
+bool MultichannelConvolverTests::testChannelOffset() {
+    const int channels = 3, first = 2, signalChannels = 6;
+    std::vector<std::vector<float>> impulses = channelImpulses(channels);
+    std::vector<float> signal(frames * signalChannels);
+    fillNoise(signal.data(), frames * signalChannels, 2, 1);
+
+    void* conv = createConvolver(m_loader, impulses);
+    ASSERT_NOT_NULL(conv, "MultichannelConvolver_Create returned null");
+    std::vector<float> output = signal;
+    m_loader.ProcessChannel(conv, output.data(), frames * signalChannels, first, signalChannels);
+    m_loader.Dispose(conv);
+
+    std::vector<float> channelSignal(frames);
+    for (int channel = 0; channel < signalChannels; ++channel) {
+        for (int i = 0; i < frames; ++i) {
+            channelSignal[i] = signal[i * signalChannels + channel];
+        }
+        bool filtered = channel >= first && channel < first + channels;
+        std::vector<double> expected = filtered ?
+            convolveDirect(channelSignal.data(), frames, impulses[channel - first].data(), impulseLength) :
+            std::vector<double>(channelSignal.begin(), channelSignal.end());
+        for (int i = 0; i < frames; ++i) {
+            char desc[256];
+            snprintf(desc, sizeof(desc), "%s channel %d, frame %d", filtered ? "filtered" : "untouched", channel, i);
+            if (filtered) {
+                ASSERT_APPROX_EQUAL((float)expected[i], output[i * signalChannels + channel], desc);
+            } else {
+                ASSERT_TRUE(output[i * signalChannels + channel] == channelSignal[i], desc);
+            }
+        }
+    }
+    return true;
+}
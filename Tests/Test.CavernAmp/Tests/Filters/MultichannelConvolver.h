@@ -0,0 +1,25 @@
+#ifndef MULTICHANNELCONVOLVER_TESTS_H
+#define MULTICHANNELCONVOLVER_TESTS_H
+
+#include "../../Loaders/Filters/MultichannelConvolver.h"
+
+class MultichannelConvolverTests {
+public:
+    MultichannelConvolverTests();
+    ~MultichannelConvolverTests();
+
+    // Load the DLL before running tests
+    bool LoadLibrary(const wchar_t* dllPath);
+
+    // Run all tests, returns true if all passed
+    bool Run();
+
+    // Individual tests (called via C-style wrappers)
+    bool testAllChannels();
+    bool testChannelOffset();
+
+private:
+    MultichannelConvolverLoader m_loader;
+};
+
+#endif // MULTICHANNELCONVOLVER_TESTS_H
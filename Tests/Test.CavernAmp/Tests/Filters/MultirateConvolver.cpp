@@ -0,0 +1,199 @@
+#include "MultirateConvolver.h"
+#include "Reference.h"
+#include "../../test.h"
+#include <cstdio>
+#include <cstring>
+
+// Global pointer to the current test instance (for C-style wrapper functions)
+static MultirateConvolverTests* g_currentTests = nullptr;
+
+// --- C-style wrapper functions ---
+// These bridge between runTest(function pointer) and our member methods.
+static bool staticTest_ShortImpulses() {
+    return g_currentTests ? g_currentTests->testShortImpulses() : false;
+}
+static bool staticTest_BandLimited() {
+    return g_currentTests ? g_currentTests->testBandLimited() : false;
+}
+static bool staticTest_Broadband() {
+    return g_currentTests ? g_currentTests->testBroadband() : false;
+}
+
+// --- Helpers ---
+static const double pi = 3.14159265358979323846;
+// Length of the impulses detected as band-limited, long enough for the largest factor
+static const int bandLimitedLength = 16384;
+
+// Lowpass filtered noise under 200 Hz at 48 kHz, faded in and out, so it has no content at higher frequencies
+static std::vector<float> bandLimitedImpulse() {
+    const int lowpassLength = 4001, center = lowpassLength / 2;
+    const double frequency = 200.0 / 48000;
+    std::vector<double> lowpass(lowpassLength);
+    for (int tap = 0; tap < lowpassLength; ++tap) {
+        int x = tap - center;
+        double sinc = x ? sin(2 * pi * frequency * x) / (pi * x) : 2 * frequency;
+        lowpass[tap] = sinc * (.42 - .5 * cos(2 * pi * tap / (lowpassLength - 1)) +
+            .08 * cos(4 * pi * tap / (lowpassLength - 1)));
+    }
+    std::vector<float> noise(bandLimitedLength + lowpassLength), impulse(bandLimitedLength);
+    fillNoise(noise.data(), bandLimitedLength + lowpassLength, 1, 1);
+    for (int i = 0; i < bandLimitedLength; ++i) {
+        double value = 0;
+        for (int tap = 0; tap < lowpassLength; ++tap) {
+            value += lowpass[tap] * noise[i + tap];
+        }
+        impulse[i] = (float)(value * (.5 - .5 * cos(2 * pi * (i + .5) / bandLimitedLength)));
+    }
+    return impulse;
+}
+
+MultirateConvolverTests::MultirateConvolverTests() {}
+MultirateConvolverTests::~MultirateConvolverTests() {}
+
+bool MultirateConvolverTests::LoadLibrary(const wchar_t* dllPath) {
+    return m_loader.Load(dllPath);
+}
+
+bool MultirateConvolverTests::Run() {
+    printf("MultirateConvolver tests:\n");
+
+    g_currentTests = this;
+    runTest("ShortImpulses", staticTest_ShortImpulses);
+    runTest("BandLimited",   staticTest_BandLimited);
+    runTest("Broadband",     staticTest_Broadband);
+    g_currentTests = nullptr;
+
+    return g_testFailed == 0;
+}
+
+// ============================================================
+// Test 1: ShortImpulses
+//
+// Meaning: Impulses which end before the split of the head and the
+// tail are convolved only by the head, exactly. Longer impulses
+// with a silent tail are also exact, as the silent tail adds
+// nothing. The middle of 3 interleaved channels is filtered, the
+// others are left untouched.
+// ============================================================
+bool MultirateConvolverTests::testShortImpulses() {
+    const int factor = 8, channels = 3, channel = 1, signalLength = 3000, callLength = 700;
+    const int identityLengths[] = {1, 100, 256, 257, 1000};
+    const int randomLengths[] = {100, 256};
+
+    std::vector<float> signal(signalLength);
+    fillNoise(signal.data(), signalLength, 2, 0.5f);
+    for (int i = 0; i < signalLength; i += 37) {
+        signal[i] = 1; // Click train
+    }
+    std::vector<float> neighbours(signalLength * channels);
+    fillNoise(neighbours.data(), signalLength * channels, 3, 1);
+
+    for (int test = 0; test < 7; ++test) {
+        bool identity = test < 5;
+        int len = identity ? identityLengths[test] : randomLengths[test - 5];
+        std::vector<float> impulse(len, 0.0f);
+        if (identity) {
+            impulse[0] = 1;
+        } else {
+            fillNoise(impulse.data(), len, 4 + test, 0.2f);
+        }
+
+        void* conv = m_loader.Create(impulse.data(), len, factor);
+        ASSERT_NOT_NULL(conv, "MultirateConvolver_Create returned null");
+        std::vector<float> output = neighbours;
+        interleave(output.data(), signal.data(), signalLength, channel, channels);
+        for (int start = 0; start < signalLength; start += callLength) {
+            int count = signalLength - start < callLength ? signalLength - start : callLength;
+            m_loader.Process(conv, output.data() + start * channels, count * channels, channel, channels);
+        }
+        m_loader.Dispose(conv);
+
+        std::vector<double> expected = convolveDirect(signal.data(), signalLength, impulse.data(), len);
+        for (int i = 0; i < signalLength; ++i) {
+            char desc[256];
+            snprintf(desc, sizeof(desc), "%s impulse of %d taps, output[%d]", identity ? "identity" : "random", len, i);
+            ASSERT_APPROX_EQUAL((float)expected[i], output[i * channels + channel], desc);
+            for (int other = 0; other < channels; ++other) {
+                if (other != channel) {
+                    snprintf(desc, sizeof(desc), "impulse of %d taps, channel %d changed at %d", len, other, i);
+                    ASSERT_TRUE(output[i * channels + other] == neighbours[i * channels + other], desc);
+                }
+            }
+        }
+    }
+    return true;
+}
+
+// ============================================================
+// Test 2: BandLimited
+//
+// Meaning: A long impulse without high frequency content is detected
+// as band-limited, and the multirate convolution of white noise is
+// within -60 dB of the direct convolution. The second of 2
+// interleaved channels is filtered, the first is left untouched.
+// A call longer than a timeslot of the tail is split to runs.
+// ============================================================
+bool MultirateConvolverTests::testBandLimited() {
+    const int channels = 2, channel = 1, signalLength = 40000;
+    const int callLengths[] = {4096, 1, 30000};
+    std::vector<float> impulse = bandLimitedImpulse();
+    void* conv = m_loader.CreateIfBandLimited(impulse.data(), bandLimitedLength);
+    ASSERT_NOT_NULL(conv, "A band-limited impulse should be convolved at a reduced rate");
+    int factor = m_loader.GetFactor(conv);
+
+    std::vector<float> signal(signalLength), neighbours(signalLength * channels);
+    fillNoise(signal.data(), signalLength, 5, 1);
+    fillNoise(neighbours.data(), signalLength * channels, 6, 1);
+    std::vector<float> output = neighbours;
+    interleave(output.data(), signal.data(), signalLength, channel, channels);
+    int start = 0;
+    for (int callLength : callLengths) {
+        m_loader.Process(conv, output.data() + start * channels, callLength * channels, channel, channels);
+        start += callLength;
+    }
+    m_loader.Process(conv, output.data() + start * channels, (signalLength - start) * channels, channel, channels);
+    m_loader.Dispose(conv);
+    ASSERT_TRUE(factor == 16, "Content under 200 Hz should be convolved at 1/16 of the sample rate");
+
+    std::vector<double> expected = convolveDirect(signal.data(), signalLength, impulse.data(), bandLimitedLength);
+    double error = 0, energy = 0;
+    for (int i = 0; i < signalLength; ++i) {
+        double difference = output[i * channels + channel] - expected[i];
+        error += difference * difference;
+        energy += expected[i] * expected[i];
+        if (output[i * channels] != neighbours[i * channels]) {
+            char desc[256];
+            snprintf(desc, sizeof(desc), "channel 0 changed at %d", i);
+            ASSERT_TRUE(false, desc);
+        }
+    }
+    if (error > 1e-6 * energy) {
+        fprintf(stderr, "\n  Relative error is %g dB, expected at most -60 dB\n", 10 * log10(error / energy));
+        return false;
+    }
+    return true;
+}
+
+// ============================================================
+// Test 3: Broadband
+//
+// Meaning: Impulses with high frequency content, or ones too short
+// to be worth convolving at a lower rate, are not band-limited.
+// ============================================================
+bool MultirateConvolverTests::testBroadband() {
+    std::vector<float> impulse(bandLimitedLength);
+    fillNoise(impulse.data(), bandLimitedLength, 7, 1);
+    void* conv = m_loader.CreateIfBandLimited(impulse.data(), bandLimitedLength);
+    if (conv) {
+        m_loader.Dispose(conv);
+    }
+    ASSERT_TRUE(!conv, "White noise should not be detected as band-limited");
+
+    std::vector<float> shortImpulse = bandLimitedImpulse();
+    conv = m_loader.CreateIfBandLimited(shortImpulse.data(), 1000);
+    if (conv) {
+        m_loader.Dispose(conv);
+    }
+    ASSERT_TRUE(!conv, "Short impulses should not be convolved at a reduced rate");
+    return true;
+}
@@ -0,0 +1,26 @@
+#ifndef MULTIRATECONVOLVER_TESTS_H
+#define MULTIRATECONVOLVER_TESTS_H
+
+#include "../../Loaders/Filters/MultirateConvolver.h"
+
+class MultirateConvolverTests {
+public:
+    MultirateConvolverTests();
+    ~MultirateConvolverTests();
+
+    // Load the DLL before running tests
+    bool LoadLibrary(const wchar_t* dllPath);
+
+    // Run all tests, returns true if all passed
+    bool Run();
+
+    // Individual tests (called via C-style wrappers)
+    bool testShortImpulses();
+    bool testBandLimited();
+    bool testBroadband();
+
+private:
+    MultirateConvolverLoader m_loader;
+};
+
+#endif // MULTIRATECONVOLVER_TESTS_H
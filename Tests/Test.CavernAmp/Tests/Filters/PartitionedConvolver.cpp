@@ -0,0 +1,120 @@
+#include "PartitionedConvolver.h"
+#include "Reference.h"
+#include "../../test.h"
+#include <algorithm>
+#include <cstdio>
+
+// Global pointer to the current test instance (for C-style wrapper functions)
+static PartitionedConvolverTests* g_currentTests = nullptr;
+
+// --- C-style wrapper functions ---
+// These bridge between runTest(function pointer) and our member methods.
+static bool staticTest_OddBlockSizes() {
+    return g_currentTests ? g_currentTests->testOddBlockSizes() : false;
+}
+static bool staticTest_ShortImpulses() {
+    return g_currentTests ? g_currentTests->testShortImpulses() : false;
+}
+
+// --- Helpers ---
+// Interleaved layout of the test signals, the first channel is filtered
+static const int channels = 3, channel = 0;
+// Frames of the test signals
+static const int frames = 4000;
+// Calls of uneven lengths, which start and end inside blocks or cross several of them, repeated until the signal ends
+static const int callLengths[] = {1, 2, 99, 101, 300, 777};
+
+PartitionedConvolverTests::PartitionedConvolverTests() {}
+PartitionedConvolverTests::~PartitionedConvolverTests() {}
+
+bool PartitionedConvolverTests::LoadLibrary(const wchar_t* dllPath) {
+    return m_loader.Load(dllPath);
+}
+
+bool PartitionedConvolverTests::compareToReference(int len, int blockSize) {
+    std::vector<float> impulse(len);
+    fillNoise(impulse.data(), len, len + blockSize, 0.1f);
+    void* conv = m_loader.Create(impulse.data(), len, blockSize);
+    ASSERT_NOT_NULL(conv, "PartitionedConvolver_Create returned null");
+    int latency = m_loader.GetLatency(conv), partitions = m_loader.GetPartitions(conv);
+
+    std::vector<float> signal(frames), original(frames * channels);
+    fillNoise(signal.data(), frames, 1, 1);
+    fillNoise(original.data(), frames * channels, 2, 1);
+    interleave(original.data(), signal.data(), frames, channel, channels);
+    std::vector<float> output = original;
+    for (int position = 0, call = 0; position < frames; ++call) {
+        int callLength = std::min(callLengths[call % (sizeof(callLengths) / sizeof(callLengths[0]))], frames - position);
+        m_loader.Process(conv, output.data() + position * channels, callLength * channels, channel, channels);
+        position += callLength;
+    }
+    m_loader.Dispose(conv);
+
+    char desc[256];
+    snprintf(desc, sizeof(desc), "%d taps, block %d: latency %d", len, blockSize, latency);
+    ASSERT_TRUE(latency == blockSize, desc);
+    snprintf(desc, sizeof(desc), "%d taps, block %d: %d partitions", len, blockSize, partitions);
+    ASSERT_TRUE(partitions == (len + blockSize - 1) / blockSize, desc);
+    std::vector<double> expected = convolveDirect(signal.data(), frames, impulse.data(), len);
+    for (int i = 0; i < frames; ++i) {
+        snprintf(desc, sizeof(desc), "%d taps, block %d, frame %d", len, blockSize, i);
+        ASSERT_APPROX_EQUAL(i < latency ? 0.0f : (float)expected[i - latency], output[i * channels + channel], desc);
+        for (int other = 0; other < channels; ++other) {
+            if (other != channel) {
+                snprintf(desc, sizeof(desc), "%d taps, block %d, channel %d changed at frame %d", len, blockSize, other, i);
+                ASSERT_TRUE(output[i * channels + other] == original[i * channels + other], desc);
+            }
+        }
+    }
+    return true;
+}
+
+bool PartitionedConvolverTests::Run() {
+    printf("PartitionedConvolver tests:\n");
+
+    g_currentTests = this;
+    runTest("OddBlockSizes", staticTest_OddBlockSizes);
+    runTest("ShortImpulses", staticTest_ShortImpulses);
+    g_currentTests = nullptr;
+
+    return g_testFailed == 0;
+}
+
+// ============================================================
+// Test 1: OddBlockSizes
+//
+// Meaning: Blocks of any size, including ones without a power of
+// two transform, delay the direct convolution by exactly one block,
+// for impulses of one and many partitions with a partial last one.
+// ============================================================
+bool PartitionedConvolverTests::testOddBlockSizes() {
+    const int blockSizes[] = {1, 3, 100, 256};
+    const int lengths[] = {256, 1000};
+    for (int blockSize : blockSizes) {
+        for (int len : lengths) {
+            if (!compareToReference(len, blockSize)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// ============================================================
+// Test 2: ShortImpulses
+//
+// Meaning: Impulses shorter than a block are a single zero padded
+// partition, which still has the latency of a whole block.
+// ============================================================
+bool PartitionedConvolverTests::testShortImpulses() {
+    const int lengths[] = {1, 2, 50};
+    const int blockSizes[] = {3, 100, 256};
+    for (int len : lengths) {
+        for (int blockSize : blockSizes) {
+            if (len < blockSize && !compareToReference(len, blockSize)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
@@ -0,0 +1,29 @@
+#ifndef PARTITIONEDCONVOLVER_TESTS_H
+#define PARTITIONEDCONVOLVER_TESTS_H
+
+#include "../../Loaders/Filters/PartitionedConvolver.h"
+
+class PartitionedConvolverTests {
+public:
+    PartitionedConvolverTests();
+    ~PartitionedConvolverTests();
+
+    // Load the DLL before running tests
+    bool LoadLibrary(const wchar_t* dllPath);
+
+    // Run all tests, returns true if all passed
+    bool Run();
+
+    // Individual tests (called via C-style wrappers)
+    bool testOddBlockSizes();
+    bool testShortImpulses();
+
+private:
+    PartitionedConvolverLoader m_loader;
+
+    // Convolve the first channel of an interleaved noise signal in calls crossing block boundaries, and compare it to
+    // the direct convolution delayed by the latency, while the other channels shall stay untouched
+    bool compareToReference(int len, int blockSize);
+};
+
+#endif // PARTITIONEDCONVOLVER_TESTS_H
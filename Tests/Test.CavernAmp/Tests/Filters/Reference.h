@@ -0,0 +1,68 @@
+#ifndef REFERENCE_H
+#define REFERENCE_H
+
+#include <cmath>
+#include <vector>
+
+// ============================================================
+// Reference implementations the native filters are compared to
+// ============================================================
+
+// Deterministic white noise between -scale / 2 and scale / 2
+inline void fillNoise(float* samples, int len, unsigned int seed, float scale) {
+    for (int i = 0; i < len; ++i) {
+        seed = seed * 1664525u + 1013904223u;
+        samples[i] = ((seed >> 8) / 16777216.0f - 0.5f) * scale;
+    }
+}
+
+// Direct convolution of a signal with an impulse in double precision, cut to the length of the signal
+inline std::vector<double> convolveDirect(const float* signal, int signalLength, const float* impulse, int len) {
+    std::vector<double> result(signalLength, 0.0);
+    for (int i = 0; i < signalLength; ++i) {
+        for (int tap = 0; tap < len && tap <= i; ++tap) {
+            result[i] += (double)impulse[tap] * signal[i - tap];
+        }
+    }
+    return result;
+}
+
+// Filter a signal with a chain of biquads in double precision, each given as b0, b1, b2, a1, a2 normalized by a0
+inline std::vector<double> filterBiquads(const float* signal, int len, const float (*biquads)[5], int count) {
+    std::vector<double> result(signal, signal + len);
+    for (int biquad = 0; biquad < count; ++biquad) {
+        const float* c = biquads[biquad];
+        double x1 = 0, x2 = 0, y1 = 0, y2 = 0;
+        for (int i = 0; i < len; ++i) {
+            double x = result[i];
+            double y = c[0] * x + c[1] * x1 + c[2] * x2 - c[3] * y1 - c[4] * y2;
+            x2 = x1;
+            x1 = x;
+            y2 = y1;
+            y1 = y;
+            result[i] = y;
+        }
+    }
+    return result;
+}
+
+// Peaking EQ biquad coefficients (b0, b1, b2, a1, a2 normalized by a0) at a frequency relative to the sample rate
+inline void peakingBiquad(float* target, double frequency, double gainDb, double q) {
+    static const double pi = 3.14159265358979323846;
+    double a = std::pow(10, gainDb / 40), w0 = 2 * pi * frequency, alpha = std::sin(w0) / (2 * q),
+        cosW0 = std::cos(w0), a0 = 1 + alpha / a;
+    target[0] = (float)((1 + alpha * a) / a0);
+    target[1] = (float)(-2 * cosW0 / a0);
+    target[2] = (float)((1 - alpha * a) / a0);
+    target[3] = (float)(-2 * cosW0 / a0);
+    target[4] = (float)((1 - alpha / a) / a0);
+}
+
+// Place a channel of samples into an interleaved buffer
+inline void interleave(float* interleaved, const float* channelSamples, int len, int channel, int channels) {
+    for (int i = 0; i < len; ++i) {
+        interleaved[i * channels + channel] = channelSamples[i];
+    }
+}
+
+#endif // REFERENCE_H
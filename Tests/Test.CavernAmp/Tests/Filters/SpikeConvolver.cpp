@@ -0,0 +1,126 @@
+#include "SpikeConvolver.h"
+#include "Reference.h"
+#include "../../test.h"
+#include <cstdio>
+#include <cstring>
+
+// Global pointer to the current test instance (for C-style wrapper functions)
+static SpikeConvolverTests* g_currentTests = nullptr;
+
+// --- C-style wrapper functions ---
+// These bridge between runTest(function pointer) and our member methods.
+static bool staticTest_SparseImpulse() {
+    return g_currentTests ? g_currentTests->testSparseImpulse() : false;
+}
+static bool staticTest_NoSpikes() {
+    return g_currentTests ? g_currentTests->testNoSpikes() : false;
+}
+
+// --- Helpers ---
+// Interleaved layout of the test signals, the first channel is filtered
+static const int channels = 2, channel = 0;
+// Frames of the test signals, long enough to wrap the ring buffer multiple times
+static const int frames = 12000;
+// Calls of uneven lengths around the 256 sample runs, the rest of the signal is processed in the last call
+static const int callLengths[] = {1, 255, 256, 257, 1000, 3};
+
+// Create an interleaved noise signal of which the filtered channel is also returned separately
+static void createSignal(std::vector<float>& signal, std::vector<float>& original) {
+    signal.resize(frames);
+    original.resize(frames * channels);
+    fillNoise(signal.data(), frames, 1, 1);
+    fillNoise(original.data(), frames * channels, 2, 1);
+    interleave(original.data(), signal.data(), frames, channel, channels);
+}
+
+SpikeConvolverTests::SpikeConvolverTests() {}
+SpikeConvolverTests::~SpikeConvolverTests() {}
+
+bool SpikeConvolverTests::LoadLibrary(const wchar_t* dllPath) {
+    return m_loader.Load(dllPath);
+}
+
+bool SpikeConvolverTests::Run() {
+    printf("SpikeConvolver tests:\n");
+
+    g_currentTests = this;
+    runTest("SparseImpulse", staticTest_SparseImpulse);
+    runTest("NoSpikes",      staticTest_NoSpikes);
+    g_currentTests = nullptr;
+
+    return g_testFailed == 0;
+}
+
+// ============================================================
+// Test 1: SparseImpulse
+//
+// Meaning: A sparse impulse with and without delay matches the
+// direct convolution across run and ring buffer boundaries, and
+// only its non-zero taps are counted as spikes.
+// ============================================================
+bool SpikeConvolverTests::testSparseImpulse() {
+    const int len = 3000;
+    const int taps[] = {0, 1, 7, 255, 256, 1024, 2047, 2999};
+    const int spikes = sizeof(taps) / sizeof(taps[0]);
+    std::vector<float> impulse(len, 0.0f);
+    for (int i = 0; i < spikes; ++i) {
+        impulse[taps[i]] = (i & 1 ? -0.1f : 0.1f) * (i + 1);
+    }
+
+    const int delays[] = {0, 100};
+    std::vector<float> signal, original;
+    createSignal(signal, original);
+    for (int delay : delays) {
+        void* conv = m_loader.Create(impulse.data(), len, delay);
+        ASSERT_NOT_NULL(conv, "SpikeConvolver_Create returned null");
+        ASSERT_TRUE(m_loader.GetSpikes(conv) == spikes, "Spike count");
+
+        std::vector<float> output = original;
+        int position = 0;
+        for (int callLength : callLengths) {
+            m_loader.Process(conv, output.data() + position * channels, callLength * channels, channel, channels);
+            position += callLength;
+        }
+        m_loader.Process(conv, output.data() + position * channels, (frames - position) * channels, channel, channels);
+        m_loader.Dispose(conv);
+
+        std::vector<float> delayed(delay + len, 0.0f);
+        memcpy(delayed.data() + delay, impulse.data(), len * sizeof(float));
+        std::vector<double> expected = convolveDirect(signal.data(), frames, delayed.data(), delay + len);
+        for (int i = 0; i < frames; ++i) {
+            char desc[256];
+            snprintf(desc, sizeof(desc), "Delay %d, frame %d", delay, i);
+            ASSERT_APPROX_EQUAL((float)expected[i], output[i * channels + channel], desc);
+            snprintf(desc, sizeof(desc), "Delay %d, other channel changed at frame %d", delay, i);
+            ASSERT_TRUE(output[i * channels + 1 - channel] == original[i * channels + 1 - channel], desc);
+        }
+    }
+    return true;
+}
+
+// ============================================================
+// Test 2: NoSpikes
+//
+// Meaning: An all-zero impulse has no spikes and silences the
+// filtered channel, while the other channel stays untouched.
+// ============================================================
+bool SpikeConvolverTests::testNoSpikes() {
+    std::vector<float> impulse(64, 0.0f);
+    void* conv = m_loader.Create(impulse.data(), 64, 10);
+    ASSERT_NOT_NULL(conv, "SpikeConvolver_Create returned null");
+    ASSERT_TRUE(m_loader.GetSpikes(conv) == 0, "Spike count");
+
+    std::vector<float> signal, original;
+    createSignal(signal, original);
+    std::vector<float> output = original;
+    m_loader.Process(conv, output.data(), frames * channels, channel, channels);
+    m_loader.Dispose(conv);
+    for (int i = 0; i < frames; ++i) {
+        char desc[256];
+        snprintf(desc, sizeof(desc), "Frame %d not silent", i);
+        ASSERT_TRUE(output[i * channels + channel] == 0, desc);
+        snprintf(desc, sizeof(desc), "Other channel changed at frame %d", i);
+        ASSERT_TRUE(output[i * channels + 1 - channel] == original[i * channels + 1 - channel], desc);
+    }
+    return true;
+}
@@ -0,0 +1,25 @@
+#ifndef SPIKECONVOLVER_TESTS_H
+#define SPIKECONVOLVER_TESTS_H
+
+#include "../../Loaders/Filters/SpikeConvolver.h"
+
+class SpikeConvolverTests {
+public:
+    SpikeConvolverTests();
+    ~SpikeConvolverTests();
+
+    // Load the DLL before running tests
+    bool LoadLibrary(const wchar_t* dllPath);
+
+    // Run all tests, returns true if all passed
+    bool Run();
+
+    // Individual tests (called via C-style wrappers)
+    bool testSparseImpulse();
+    bool testNoSpikes();
+
+private:
+    SpikeConvolverLoader m_loader;
+};
+
+#endif // SPIKECONVOLVER_TESTS_H
@@ -0,0 +1,153 @@
+#include "ZeroLatencyConvolver.h"
+#include "Reference.h"
+#include "../../test.h"
+#include <algorithm>
+#include <cstdio>
+
+// Global pointer to the current test instance (for C-style wrapper functions)
+static ZeroLatencyConvolverTests* g_currentTests = nullptr;
+
+// --- C-style wrapper functions ---
+// These bridge between runTest(function pointer) and our member methods.
+static bool staticTest_ImpulseLengths() {
+    return g_currentTests ? g_currentTests->testImpulseLengths() : false;
+}
+static bool staticTest_HeadLengths() {
+    return g_currentTests ? g_currentTests->testHeadLengths() : false;
+}
+static bool staticTest_DisposePending() {
+    return g_currentTests ? g_currentTests->testDisposePending() : false;
+}
+
+// --- Helpers ---
+// Interleaved layout of the test signals, the second channel is filtered
+static const int channels = 2, channel = 1;
+// Calls of uneven lengths, the long ones finish blocks of the background segments faster than real time, so their
+// results are completed on the calling thread. The calls are repeated until the signal ends.
+static const int callLengths[] = {1, 7, 64, 100, 3000, 513, 12000};
+
+// Impulse with a decaying noise, which keeps the rounding errors of long transforms low
+static std::vector<float> createImpulse(int len) {
+    std::vector<float> impulse(len);
+    fillNoise(impulse.data(), len, len, 1);
+    for (int i = 0; i < len; ++i) {
+        impulse[i] *= 0.5f / (1 + i * 0.01f);
+    }
+    return impulse;
+}
+
+ZeroLatencyConvolverTests::ZeroLatencyConvolverTests() {}
+ZeroLatencyConvolverTests::~ZeroLatencyConvolverTests() {}
+
+bool ZeroLatencyConvolverTests::LoadLibrary(const wchar_t* dllPath) {
+    return m_loader.Load(dllPath);
+}
+
+bool ZeroLatencyConvolverTests::compareToReference(int len, int headLength, int sampleRate) {
+    std::vector<float> impulse = createImpulse(len);
+    void* conv = m_loader.Create(impulse.data(), len, headLength);
+    ASSERT_NOT_NULL(conv, "ZeroLatencyConvolver_Create returned null");
+    if (sampleRate) {
+        m_loader.SetSampleRate(conv, sampleRate);
+    }
+
+    const int frames = len + 4000; // Every sample of the impulse is heard
+    std::vector<float> signal(frames), original(frames * channels);
+    fillNoise(signal.data(), frames, 1, 1);
+    fillNoise(original.data(), frames * channels, 2, 1);
+    interleave(original.data(), signal.data(), frames, channel, channels);
+    std::vector<float> output = original;
+    for (int position = 0, call = 0; position < frames; ++call) {
+        int callLength = std::min(callLengths[call % (sizeof(callLengths) / sizeof(callLengths[0]))], frames - position);
+        m_loader.Process(conv, output.data() + position * channels, callLength * channels, channel, channels);
+        position += callLength;
+    }
+    m_loader.Dispose(conv);
+
+    std::vector<double> expected = convolveDirect(signal.data(), frames, impulse.data(), len);
+    for (int i = 0; i < frames; ++i) {
+        char desc[256];
+        snprintf(desc, sizeof(desc), "%d taps, head %d, frame %d", len, headLength, i);
+        ASSERT_APPROX_EQUAL((float)expected[i], output[i * channels + channel], desc);
+        snprintf(desc, sizeof(desc), "%d taps, head %d, other channel changed at frame %d", len, headLength, i);
+        ASSERT_TRUE(output[i * channels + 1 - channel] == original[i * channels + 1 - channel], desc);
+    }
+    return true;
+}
+
+bool ZeroLatencyConvolverTests::Run() {
+    printf("ZeroLatencyConvolver tests:\n");
+
+    g_currentTests = this;
+    runTest("ImpulseLengths", staticTest_ImpulseLengths);
+    runTest("HeadLengths",    staticTest_HeadLengths);
+    runTest("DisposePending", staticTest_DisposePending);
+    g_currentTests = nullptr;
+
+    return g_testFailed == 0;
+}
+
+// ============================================================
+// Test 1: ImpulseLengths
+//
+// Meaning: The output matches the direct convolution without any
+// latency, for impulses that end in the direct form head, in the
+// first segments, and reach the background segments.
+// ============================================================
+bool ZeroLatencyConvolverTests::testImpulseLengths() {
+    const int lengths[] = {1, 63, 64, 65, 300, 2000, 40000};
+    for (int len : lengths) {
+        if (!compareToReference(len, 0, 0)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// ============================================================
+// Test 2: HeadLengths
+//
+// Meaning: Direct form heads of any length, which also set the
+// block size of the first segment, give the same zero latency
+// output, and so does a sample rate other than the default.
+// ============================================================
+bool ZeroLatencyConvolverTests::testHeadLengths() {
+    const int headLengths[] = {16, 100};
+    for (int headLength : headLengths) {
+        if (!compareToReference(5000, headLength, 0)) {
+            return false;
+        }
+    }
+    return compareToReference(5000, 0, 192000);
+}
+
+// ============================================================
+// Test 3: DisposePending
+//
+// Meaning: Disposing a filter while its background segments are
+// queued or running waits for them, and leaves the scheduler
+// working for the filters created after it.
+// ============================================================
+bool ZeroLatencyConvolverTests::testDisposePending() {
+    const int len = 40000, blockSize = 512;
+    std::vector<float> impulse = createImpulse(len);
+    std::vector<float> samples(blockSize);
+    fillNoise(samples.data(), blockSize, 3, 1);
+    for (int cycle = 0; cycle < 8; ++cycle) {
+        void* conv[4];
+        for (void*& filter : conv) {
+            filter = m_loader.Create(impulse.data(), len, 0);
+            ASSERT_NOT_NULL(filter, "ZeroLatencyConvolver_Create returned null");
+        }
+        // Each cycle ends at a different point of the segment blocks
+        for (int block = 0; block <= 8 + cycle * 5; ++block) {
+            for (void* filter : conv) {
+                m_loader.Process(filter, samples.data(), blockSize, 0, 1);
+            }
+        }
+        for (void* filter : conv) {
+            m_loader.Dispose(filter);
+        }
+    }
+    return compareToReference(20000, 0, 0);
+}
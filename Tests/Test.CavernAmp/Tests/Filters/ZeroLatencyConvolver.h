@@ -0,0 +1,30 @@
+#ifndef ZEROLATENCYCONVOLVER_TESTS_H
+#define ZEROLATENCYCONVOLVER_TESTS_H
+
+#include "../../Loaders/Filters/ZeroLatencyConvolver.h"
+
+class ZeroLatencyConvolverTests {
+public:
+    ZeroLatencyConvolverTests();
+    ~ZeroLatencyConvolverTests();
+
+    // Load the DLL before running tests
+    bool LoadLibrary(const wchar_t* dllPath);
+
+    // Run all tests, returns true if all passed
+    bool Run();
+
+    // Individual tests (called via C-style wrappers)
+    bool testImpulseLengths();
+    bool testHeadLengths();
+    bool testDisposePending();
+
+private:
+    ZeroLatencyConvolverLoader m_loader;
+
+    // Convolve the second channel of a stereo noise signal in calls of uneven lengths, and compare it to the direct
+    // convolution without latency, while the first channel shall stay untouched
+    bool compareToReference(int len, int headLength, int sampleRate);
+};
+
+#endif // ZEROLATENCYCONVOLVER_TESTS_H
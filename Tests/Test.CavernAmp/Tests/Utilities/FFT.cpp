@@ -0,0 +1,504 @@
+#include "FFT.h"
+#include "../Filters/Reference.h"
+#include "../../test.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+// Global pointer to the current test instance (for C-style wrapper functions)
+static FFTTests* g_currentTests = nullptr;
+
+// --- C-style wrapper functions ---
+// These bridge between runTest(function pointer) and our member methods.
+static bool staticTest_PowerOfTwo() {
+    return g_currentTests ? g_currentTests->testPowerOfTwo() : false;
+}
+static bool staticTest_Cacheless() {
+    return g_currentTests ? g_currentTests->testCacheless() : false;
+}
+static bool staticTest_Real() {
+    return g_currentTests ? g_currentTests->testReal() : false;
+}
+static bool staticTest_FallbackCache() {
+    return g_currentTests ? g_currentTests->testFallbackCache() : false;
+}
+static bool staticTest_MixedRadix() {
+    return g_currentTests ? g_currentTests->testMixedRadix() : false;
+}
+static bool staticTest_Bluestein() {
+    return g_currentTests ? g_currentTests->testBluestein() : false;
+}
+static bool staticTest_Batch() {
+    return g_currentTests ? g_currentTests->testBatch() : false;
+}
+static bool staticTest_Wisdom() {
+    return g_currentTests ? g_currentTests->testWisdom() : false;
+}
+static bool staticTest_FourStep() {
+    return g_currentTests ? g_currentTests->testFourStep() : false;
+}
+
+// --- Helpers ---
+// Largest allowed error of a bin relative to the RMS level of the spectrum
+static const double maxRelativeError = 1e-5;
+
+// A bin of the naive DFT of interleaved complex samples in double precision
+static void naiveDFT(const float* samples, int size, int bin, double& real, double& imaginary) {
+    static const double pi = 3.14159265358979323846;
+    real = imaginary = 0;
+    for (int i = 0; i < size; ++i) {
+        // The product is reduced to a period first, so the angle is exact for any size
+        double angle = -2 * pi * (double)(((long long)bin * i) % size) / size,
+            c = std::cos(angle), s = std::sin(angle);
+        real += samples[2 * i] * c - samples[2 * i + 1] * s;
+        imaginary += samples[2 * i] * s + samples[2 * i + 1] * c;
+    }
+}
+
+// Bins compared to the DFT: all of them for small sizes, evenly spread ones and the edges for large sizes
+static std::vector<int> checkedBinsOf(int size, int checkedBins) {
+    std::vector<int> bins;
+    if (size <= checkedBins) {
+        for (int bin = 0; bin < size; ++bin) {
+            bins.push_back(bin);
+        }
+        return bins;
+    }
+    for (int i = 0; i < checkedBins - 2; ++i) {
+        bins.push_back((int)((long long)i * size / (checkedBins - 2)) + i % 3);
+    }
+    bins.push_back(size / 2);
+    bins.push_back(size - 1);
+    return bins;
+}
+
+// Compare a transformed signal to the DFT of the source at the checked bins, the error is relative to the RMS of a bin.
+// Bins over lastBin are not checked, as real transforms only return the first half of the spectrum.
+static bool compareSpectrum(const float* source, const float* spectrum, int size, int checkedBins, const char* what,
+    int lastBin = -1) {
+    double level = std::sqrt(size / 6.0); // Each sample's components are uniform noise in [-0.5, 0.5)
+    if (lastBin != -1) {
+        level /= std::sqrt(2.0); // Real signals have no imaginary noise
+    }
+    for (int bin : checkedBinsOf(size, checkedBins)) {
+        if (lastBin != -1 && bin > lastBin) {
+            continue;
+        }
+        double real, imaginary;
+        naiveDFT(source, size, bin, real, imaginary);
+        double error = std::hypot(spectrum[2 * bin] - real, spectrum[2 * bin + 1] - imaginary) / level;
+        if (error > maxRelativeError) {
+            fprintf(stderr, "\n  %s, size %d, bin %d: relative error %g\n", what, size, bin, error);
+            return false;
+        }
+    }
+    return true;
+}
+
+// Compare the result of a round trip to the source of count values, after a scaling, relative to the RMS level of the source
+static bool compareSignal(const float* source, const float* result, int count, const char* what, double scale = 1) {
+    for (int i = 0; i < count; ++i) {
+        double error = std::fabs(result[i] * scale - source[i]) / std::sqrt(1 / 12.0);
+        if (error > maxRelativeError) {
+            fprintf(stderr, "\n  %s, %d values, value %d: relative error %g\n", what, count, i, error);
+            return false;
+        }
+    }
+    return true;
+}
+
+// Read a whole file, returns false if it can't be read
+static bool readFile(const char* path, std::vector<char>& contents) {
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        return false;
+    }
+    contents.clear();
+    char buffer[256];
+    size_t read;
+    while ((read = fread(buffer, 1, sizeof(buffer), file)) != 0) {
+        contents.insert(contents.end(), buffer, buffer + read);
+    }
+    fclose(file);
+    return true;
+}
+
+// Write the first length bytes of contents to a file, returns false if it can't be written
+static bool writeFile(const char* path, const std::vector<char>& contents, size_t length) {
+    FILE* file = fopen(path, "wb");
+    if (!file) {
+        return false;
+    }
+    bool written = !length || fwrite(contents.data(), 1, length, file) == length;
+    return !fclose(file) && written;
+}
+
+FFTTests::FFTTests() {}
+FFTTests::~FFTTests() {}
+
+bool FFTTests::LoadLibrary(const wchar_t* dllPath) {
+    return m_loader.Load(dllPath);
+}
+
+bool FFTTests::compareToDFT(int size, bool withCache, int checkedBins, bool multithreaded) {
+    std::vector<float> source(2 * size);
+    fillNoise(source.data(), 2 * size, size, 1);
+    std::vector<float> samples = source;
+    void* cache = withCache ? m_loader.CacheCreate(size) : nullptr;
+    if (withCache && !cache) {
+        fprintf(stderr, "\n  FFTCache_Create returned null for size %d\n", size);
+        return false;
+    }
+    if (cache) {
+        m_loader.CacheSetMultithreaded(cache, multithreaded);
+    }
+    m_loader.InPlaceFFT(samples.data(), size, cache);
+    bool passed = compareSpectrum(source.data(), samples.data(), size, checkedBins, "InPlaceFFT");
+    if (passed) {
+        m_loader.InPlaceIFFT(samples.data(), size, cache);
+        passed = compareSignal(source.data(), samples.data(), 2 * size, "InPlaceIFFT");
+    }
+    if (cache) {
+        m_loader.CacheDispose(cache);
+    }
+    return passed;
+}
+
+bool FFTTests::compareRealToDFT(int size, bool withCache, int checkedBins, bool multithreaded) {
+    std::vector<float> source(size), complexSource(2 * size);
+    fillNoise(source.data(), size, size + 1, 1);
+    for (int i = 0; i < size; ++i) {
+        complexSource[2 * i] = source[i];
+    }
+    std::vector<float> samples(size + 2);
+    std::copy(source.begin(), source.end(), samples.begin());
+    void* cache = withCache ? m_loader.CacheCreate(size) : nullptr;
+    if (withCache && !cache) {
+        fprintf(stderr, "\n  FFTCache_Create returned null for size %d\n", size);
+        return false;
+    }
+    if (cache) {
+        m_loader.CacheSetMultithreaded(cache, multithreaded);
+    }
+    m_loader.ProcessRealFFT(samples.data(), size, cache);
+    std::vector<float> spectrum = samples;
+    bool passed = compareSpectrum(complexSource.data(), samples.data(), size, checkedBins, "ProcessRealFFT", size / 2);
+    if (passed) {
+        m_loader.ProcessRealIFFT(samples.data(), size, cache);
+        passed = compareSignal(source.data(), samples.data(), size, "ProcessRealIFFT", 1.0 / size);
+    }
+    if (passed) {
+        m_loader.InPlaceRealIFFT(spectrum.data(), size, cache);
+        passed = compareSignal(source.data(), spectrum.data(), size, "InPlaceRealIFFT");
+    }
+    if (cache) {
+        m_loader.CacheDispose(cache);
+    }
+    return passed;
+}
+
+bool FFTTests::compareBatchToDFT(int channels, int size, bool multithreaded, int checkedBins) {
+    std::vector<std::vector<float>> sources(channels), signals(channels);
+    std::vector<float*> pointers(channels);
+    for (int channel = 0; channel < channels; ++channel) {
+        sources[channel].resize(2 * size);
+        fillNoise(sources[channel].data(), 2 * size, size * channels + channel, 1);
+        signals[channel] = sources[channel];
+        pointers[channel] = signals[channel].data();
+    }
+    void* cache = m_loader.CacheCreate(size);
+    if (!cache) {
+        fprintf(stderr, "\n  FFTCache_Create returned null for size %d\n", size);
+        return false;
+    }
+
+    char desc[128];
+    snprintf(desc, sizeof(desc), "InPlaceFFTBatch (%d channels, %s)", channels,
+        multithreaded ? "multithreaded" : "single thread");
+    m_loader.InPlaceFFTBatch(pointers.data(), channels, size, cache, multithreaded);
+    bool passed = true;
+    for (int channel = 0; passed && channel < channels; ++channel) {
+        passed = compareSpectrum(sources[channel].data(), signals[channel].data(), size, checkedBins, desc);
+    }
+    if (passed) {
+        snprintf(desc, sizeof(desc), "InPlaceIFFTBatch (%d channels, %s)", channels,
+            multithreaded ? "multithreaded" : "single thread");
+        m_loader.InPlaceIFFTBatch(pointers.data(), channels, size, cache, multithreaded);
+        for (int channel = 0; passed && channel < channels; ++channel) {
+            passed = compareSignal(sources[channel].data(), signals[channel].data(), 2 * size, desc);
+        }
+    }
+    m_loader.CacheDispose(cache);
+    return passed;
+}
+
+bool FFTTests::Run() {
+    printf("FFT tests:\n");
+
+    g_currentTests = this;
+    runTest("PowerOfTwo", staticTest_PowerOfTwo);
+    runTest("Cacheless",  staticTest_Cacheless);
+    runTest("Real",       staticTest_Real);
+    runTest("FallbackCache", staticTest_FallbackCache);
+    runTest("MixedRadix", staticTest_MixedRadix);
+    runTest("Bluestein",  staticTest_Bluestein);
+    runTest("Batch",      staticTest_Batch);
+    runTest("Wisdom",     staticTest_Wisdom);
+    runTest("FourStep",   staticTest_FourStep);
+    g_currentTests = nullptr;
+
+    return g_testFailed == 0;
+}
+
+// ============================================================
+// Test 1: PowerOfTwo
+//
+// Meaning: Power of two transforms from the smallest size through
+// the codelets and the radix-4/2 butterflies match a naive DFT, and
+// the inverse transform gives the normalized signal back.
+// ============================================================
+bool FFTTests::testPowerOfTwo() {
+    for (int size = 2; size <= 16384; size <<= 1) {
+        if (!compareToDFT(size, true, 256)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// ============================================================
+// Test 2: Cacheless
+//
+// Meaning: Transforms without a cache, or with a cache of a smaller
+// size, use a fallback cache of the right size, and are correct.
+// ============================================================
+bool FFTTests::testCacheless() {
+    const int sizes[] = {8, 1024, 8192};
+    for (int size : sizes) {
+        if (!compareToDFT(size, false, 256)) {
+            return false;
+        }
+    }
+
+    // A cache too small for the transform is not used
+    std::vector<float> source(2 * 512), samples(2 * 512);
+    fillNoise(source.data(), 2 * 512, 7, 1);
+    samples = source;
+    void* small = m_loader.CacheCreate(64);
+    ASSERT_NOT_NULL(small, "FFTCache_Create returned null");
+    m_loader.InPlaceFFT(samples.data(), 512, small);
+    m_loader.CacheDispose(small);
+    return compareSpectrum(source.data(), samples.data(), 512, 512, "InPlaceFFT with a small cache");
+}
+
+// ============================================================
+// Test 3: Real
+//
+// Meaning: The packed real transform matches the first half of a
+// naive DFT of the real signal, ProcessRealIFFT returns the signal
+// scaled by its length, and InPlaceRealIFFT returns it normalized.
+// ============================================================
+bool FFTTests::testReal() {
+    for (int size = 2; size <= 16384; size <<= 1) {
+        if (!compareRealToDFT(size, true, 256)) {
+            return false;
+        }
+    }
+    return compareRealToDFT(4096, false, 256);
+}
+
+// ============================================================
+// Test 4: FallbackCache
+//
+// Meaning: Cache-less transforms create a fallback cache for a new
+// size and reuse it later, while a memory limit smaller than a
+// single cache only keeps the most recently used one.
+// ============================================================
+bool FFTTests::testFallbackCache() {
+    std::vector<float> samples(2 * 1024);
+    fillNoise(samples.data(), 2 * 1024, 3, 1);
+    long long oldLimit = m_loader.FallbackGetMaxBytes();
+    m_loader.FallbackClear();
+    m_loader.FallbackResetCounters();
+    ASSERT_TRUE(m_loader.FallbackHits() == 0 && m_loader.FallbackMisses() == 0, "Counters not reset");
+
+    m_loader.InPlaceFFT(samples.data(), 256, nullptr);
+    ASSERT_TRUE(m_loader.FallbackHits() == 0 && m_loader.FallbackMisses() == 1, "First transform of a size did not miss");
+    m_loader.InPlaceIFFT(samples.data(), 256, nullptr);
+    ASSERT_TRUE(m_loader.FallbackHits() == 1 && m_loader.FallbackMisses() == 1, "Repeated size did not hit");
+    m_loader.InPlaceFFT(samples.data(), 512, nullptr);
+    m_loader.InPlaceFFT(samples.data(), 256, nullptr);
+    m_loader.InPlaceFFT(samples.data(), 512, nullptr);
+    ASSERT_TRUE(m_loader.FallbackHits() == 3 && m_loader.FallbackMisses() == 2, "Two sizes were not both kept");
+
+    // With a tiny limit, only the last size is kept
+    m_loader.FallbackClear();
+    m_loader.FallbackResetCounters();
+    m_loader.FallbackSetMaxBytes(1);
+    m_loader.InPlaceFFT(samples.data(), 1024, nullptr);
+    m_loader.InPlaceFFT(samples.data(), 256, nullptr);
+    m_loader.InPlaceFFT(samples.data(), 1024, nullptr);
+    m_loader.InPlaceFFT(samples.data(), 1024, nullptr);
+    long long hits = m_loader.FallbackHits(), misses = m_loader.FallbackMisses();
+    m_loader.FallbackSetMaxBytes(oldLimit);
+    m_loader.FallbackClear();
+    ASSERT_TRUE(hits == 1 && misses == 3, "The memory limit did not evict the older size");
+    ASSERT_TRUE(m_loader.FallbackGetMaxBytes() == oldLimit, "The memory limit was not restored");
+    return true;
+}
+
+// ============================================================
+// Test 5: MixedRadix
+//
+// Meaning: Sizes with only 2, 3 and 5 as prime factors, like 3 * 2^n,
+// 5 * 2^n and mixed products, match a naive DFT in both complex and
+// real transforms, and round trip.
+// ============================================================
+bool FFTTests::testMixedRadix() {
+    const int sizes[] = {3, 5, 6, 10, 15, 24, 45, 96, 160, 225, 750, 3 * 1024, 5 * 2048, 3 * 5 * 5 * 64};
+    for (int size : sizes) {
+        if (!compareToDFT(size, true, 256)) {
+            return false;
+        }
+    }
+    const int realSizes[] = {6, 10, 30, 96, 480, 3 * 2048, 5 * 1024};
+    for (int size : realSizes) {
+        if (!compareRealToDFT(size, true, 256)) {
+            return false;
+        }
+    }
+    return compareToDFT(3 * 512, false, 256);
+}
+
+// ============================================================
+// Test 6: Bluestein
+//
+// Meaning: Sizes with other prime factors, including primes, are
+// transformed through Bluestein's algorithm, matching a naive DFT in
+// both complex and real transforms, and round trip.
+// ============================================================
+bool FFTTests::testBluestein() {
+    const int sizes[] = {7, 11, 17, 77, 97, 127, 1009, 4099, 7 * 1024};
+    for (int size : sizes) {
+        if (!compareToDFT(size, true, 256)) {
+            return false;
+        }
+    }
+    const int realSizes[] = {14, 22, 194, 2 * 1009, 7 * 512};
+    for (int size : realSizes) {
+        if (!compareRealToDFT(size, true, 256)) {
+            return false;
+        }
+    }
+    return compareToDFT(1009, false, 256);
+}
+
+// ============================================================
+// Test 7: Batch
+//
+// Meaning: Batched transforms match a naive DFT on every channel,
+// both in SIMD lanes (with channel counts that leave lanes unused)
+// and one by one for larger or non-power of two sizes, with and
+// without worker threads, and the inverse batch round trips.
+// ============================================================
+bool FFTTests::testBatch() {
+    const int channelCounts[] = {1, 5, 8, 13};
+    const int sizes[] = {4, 64, 4096, 8192, 96, 1009};
+    for (int multithreaded = 0; multithreaded < 2; ++multithreaded) {
+        for (int channels : channelCounts) {
+            for (int size : sizes) {
+                if (!compareBatchToDFT(channels, size, multithreaded != 0, 32)) {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+// ============================================================
+// Test 8: Wisdom
+//
+// Meaning: Planning a power of two size with autotuning adds it to
+// the wisdom, which survives an export, forget and import round trip,
+// while truncated, corrupted and missing files are rejected without
+// changing the wisdom.
+// ============================================================
+bool FFTTests::testWisdom() {
+    const char* previousPath = "Test.CavernAmp.previous.wisdom";
+    const char* path = "Test.CavernAmp.wisdom";
+    const char* brokenPath = "Test.CavernAmp.broken.wisdom";
+    bool autotune = m_loader.GetAutotune();
+    ASSERT_TRUE(m_loader.ExportWisdom(previousPath), "Exporting the current wisdom failed");
+
+    // An empty wisdom round trips
+    m_loader.ForgetWisdom();
+    ASSERT_TRUE(m_loader.WisdomSize() == 0, "Forgetting the wisdom left entries");
+    ASSERT_TRUE(m_loader.ExportWisdom(path), "Exporting an empty wisdom failed");
+    ASSERT_TRUE(m_loader.ImportWisdom(path), "Importing an empty wisdom failed");
+    ASSERT_TRUE(m_loader.WisdomSize() == 0, "Importing an empty wisdom added entries");
+
+    // A new plan is measured, no other test uses this size, so it's not alive yet
+    m_loader.SetAutotune(true);
+    m_loader.FallbackClear();
+    void* cache = m_loader.CacheCreate(32768);
+    ASSERT_NOT_NULL(cache, "FFTCache_Create returned null");
+    m_loader.CacheDispose(cache);
+    int measured = m_loader.WisdomSize();
+    ASSERT_TRUE(measured > 0, "Planning with autotuning did not add to the wisdom");
+
+    ASSERT_TRUE(m_loader.ExportWisdom(path), "Exporting the wisdom failed");
+    m_loader.ForgetWisdom();
+    ASSERT_TRUE(m_loader.ImportWisdom(path), "Importing the exported wisdom failed");
+    ASSERT_TRUE(m_loader.WisdomSize() == measured, "The imported wisdom has a different size");
+
+    // Broken files are rejected and don't change the wisdom
+    std::vector<char> contents;
+    ASSERT_TRUE(readFile(path, contents) && contents.size() > 4, "Reading the exported wisdom failed");
+    m_loader.ForgetWisdom();
+    const size_t truncations[] = {contents.size() - 1, contents.size() - 4, 12, 3, 0};
+    for (size_t length : truncations) {
+        ASSERT_TRUE(writeFile(brokenPath, contents, length), "Writing a truncated wisdom failed");
+        ASSERT_TRUE(!m_loader.ImportWisdom(brokenPath), "A truncated wisdom file was imported");
+    }
+    std::vector<char> corrupted = contents;
+    corrupted[0] ^= 1;
+    ASSERT_TRUE(writeFile(brokenPath, corrupted, corrupted.size()), "Writing a corrupted wisdom failed");
+    ASSERT_TRUE(!m_loader.ImportWisdom(brokenPath), "A wisdom file with a bad magic was imported");
+    corrupted = contents;
+    corrupted[contents.size() - 1] ^= 2; // The last leaf size is not a candidate anymore
+    ASSERT_TRUE(writeFile(brokenPath, corrupted, corrupted.size()), "Writing a corrupted wisdom failed");
+    ASSERT_TRUE(!m_loader.ImportWisdom(brokenPath), "A wisdom file with an invalid entry was imported");
+    remove(brokenPath);
+    ASSERT_TRUE(!m_loader.ImportWisdom(brokenPath), "A missing wisdom file was imported");
+    ASSERT_TRUE(m_loader.WisdomSize() == 0, "A rejected wisdom file changed the wisdom");
+
+    m_loader.SetAutotune(autotune);
+    ASSERT_TRUE(m_loader.ImportWisdom(previousPath), "Restoring the previous wisdom failed");
+    remove(previousPath);
+    remove(path);
+    return true;
+}
+
+// ============================================================
+// Test 9: FourStep
+//
+// Meaning: Power of two sizes over the L2 cache size, which take the
+// four-step path, match a naive DFT at spread bins and round trip,
+// for complex and real transforms, with the sub-transforms on the
+// calling thread and on worker threads. The sizes go up to 2^20 to
+// exceed the four-step minimum even with large L2 caches.
+// ============================================================
+bool FFTTests::testFourStep() {
+    for (int multithreaded = 0; multithreaded < 2; ++multithreaded) {
+        for (int size = 1 << 16; size <= 1 << 20; size <<= 2) {
+            if (!compareToDFT(size, true, 16, multithreaded != 0)) {
+                return false;
+            }
+        }
+        if (!compareRealToDFT(1 << 19, true, 16, multithreaded != 0)) {
+            return false;
+        }
+    }
+    return compareToDFT(1 << 18, false, 16) && compareBatchToDFT(3, 1 << 17, true, 8);
+}
@@ -0,0 +1,45 @@
+#ifndef FFT_TESTS_H
+#define FFT_TESTS_H
+
+#include "../../Loaders/Utilities/FFT.h"
+#include <vector>
+
+class FFTTests {
+public:
+    FFTTests();
+    ~FFTTests();
+
+    // Load the DLL before running tests
+    bool LoadLibrary(const wchar_t* dllPath);
+
+    // Run all tests, returns true if all passed
+    bool Run();
+
+    // Individual tests (called via C-style wrappers)
+    bool testPowerOfTwo();
+    bool testCacheless();
+    bool testReal();
+    bool testFallbackCache();
+    bool testMixedRadix();
+    bool testBluestein();
+    bool testBatch();
+    bool testWisdom();
+    bool testFourStep();
+
+private:
+    FFTLoader m_loader;
+
+    // Transform complex noise of a size with a cache of that size, or without a cache, and compare the checked bins to
+    // a naive DFT, then check that the inverse transform gives the noise back. The cache can spread the work on threads.
+    bool compareToDFT(int size, bool withCache, int checkedBins, bool multithreaded = false);
+
+    // Transform real noise of a size and compare the half spectrum to a naive DFT, then check that both inverse
+    // transforms give the noise back, with their own scaling
+    bool compareRealToDFT(int size, bool withCache, int checkedBins, bool multithreaded = false);
+
+    // Transform channels of complex noise in a batch and compare each channel to a naive DFT, then check that the
+    // inverse batch gives the noise back
+    bool compareBatchToDFT(int channels, int size, bool multithreaded, int checkedBins);
+};
+
+#endif // FFT_TESTS_H
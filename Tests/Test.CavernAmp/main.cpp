@@ -1,7 +1,18 @@
 #include <windows.h>
 #include <cstdio>
 #include "test.h"
+#include "Tests/Filters/BiquadFilter.h"
 #include "Tests/Filters/FastConvolver.h"
+#include "Tests/Filters/MultirateConvolver.h"
+#include "Tests/Filters/MultichannelConvolver.h"
+#include "Tests/Filters/ConvolutionMatrix.h"
+#include "Tests/Filters/Convolver.h"
+#include "Tests/Filters/SpikeConvolver.h"
+#include "Tests/Filters/BiquadBank.h"
+#include "Tests/Filters/BiquadCascade.h"
+#include "Tests/Filters/ZeroLatencyConvolver.h"
+#include "Tests/Filters/PartitionedConvolver.h"
+#include "Tests/Utilities/FFT.h"
 
 int main() {
     // Load DLL from same directory as executable
@@ -26,7 +37,84 @@ int main() {
         return 1;
     }
 
+    BiquadFilterTests biquadTests;
+    if (!biquadTests.LoadLibrary(dllPath)) {
+        fprintf(stderr, "Failed to load CavernAmp.dll from: %ls\n", dllPath);
+        return 1;
+    }
+
+    MultirateConvolverTests multirateTests;
+    if (!multirateTests.LoadLibrary(dllPath)) {
+        fprintf(stderr, "Failed to load CavernAmp.dll from: %ls\n", dllPath);
+        return 1;
+    }
+
+    MultichannelConvolverTests multichannelTests;
+    if (!multichannelTests.LoadLibrary(dllPath)) {
+        fprintf(stderr, "Failed to load CavernAmp.dll from: %ls\n", dllPath);
+        return 1;
+    }
+
+    ConvolutionMatrixTests matrixTests;
+    if (!matrixTests.LoadLibrary(dllPath)) {
+        fprintf(stderr, "Failed to load CavernAmp.dll from: %ls\n", dllPath);
+        return 1;
+    }
+
+    ConvolverTests convolverTests;
+    if (!convolverTests.LoadLibrary(dllPath)) {
+        fprintf(stderr, "Failed to load CavernAmp.dll from: %ls\n", dllPath);
+        return 1;
+    }
+
+    SpikeConvolverTests spikeConvolverTests;
+    if (!spikeConvolverTests.LoadLibrary(dllPath)) {
+        fprintf(stderr, "Failed to load CavernAmp.dll from: %ls\n", dllPath);
+        return 1;
+    }
+
+    BiquadBankTests biquadBankTests;
+    if (!biquadBankTests.LoadLibrary(dllPath)) {
+        fprintf(stderr, "Failed to load CavernAmp.dll from: %ls\n", dllPath);
+        return 1;
+    }
+
+    BiquadCascadeTests biquadCascadeTests;
+    if (!biquadCascadeTests.LoadLibrary(dllPath)) {
+        fprintf(stderr, "Failed to load CavernAmp.dll from: %ls\n", dllPath);
+        return 1;
+    }
+
+    ZeroLatencyConvolverTests zeroLatencyConvolverTests;
+    if (!zeroLatencyConvolverTests.LoadLibrary(dllPath)) {
+        fprintf(stderr, "Failed to load CavernAmp.dll from: %ls\n", dllPath);
+        return 1;
+    }
+
+    PartitionedConvolverTests partitionedConvolverTests;
+    if (!partitionedConvolverTests.LoadLibrary(dllPath)) {
+        fprintf(stderr, "Failed to load CavernAmp.dll from: %ls\n", dllPath);
+        return 1;
+    }
+
+    FFTTests fftTests;
+    if (!fftTests.LoadLibrary(dllPath)) {
+        fprintf(stderr, "Failed to load CavernAmp.dll from: %ls\n", dllPath);
+        return 1;
+    }
+
     bool allPassed = tests.Run();
+    allPassed = biquadTests.Run() && allPassed;
+    allPassed = multirateTests.Run() && allPassed;
+    allPassed = multichannelTests.Run() && allPassed;
+    allPassed = matrixTests.Run() && allPassed;
+    allPassed = convolverTests.Run() && allPassed;
+    allPassed = spikeConvolverTests.Run() && allPassed;
+    allPassed = biquadBankTests.Run() && allPassed;
+    allPassed = biquadCascadeTests.Run() && allPassed;
+    allPassed = zeroLatencyConvolverTests.Run() && allPassed;
+    allPassed = partitionedConvolverTests.Run() && allPassed;
+    allPassed = fftTests.Run() && allPassed;
 
     // Results
     printf("\n=== Results ===\n");
@@ -5,8 +5,30 @@ echo === Building Test.CavernAmp ===
 
 g++.exe -o Test.CavernAmp.exe ^
     Loaders/DllLoader.cpp ^
+    Loaders/Filters/BiquadFilter.cpp ^
     Loaders/Filters/FastConvolver.cpp ^
+    Loaders/Filters/MultirateConvolver.cpp ^
+    Loaders/Filters/MultichannelConvolver.cpp ^
+    Loaders/Filters/ConvolutionMatrix.cpp ^
+    Loaders/Filters/Convolver.cpp ^
+    Loaders/Filters/SpikeConvolver.cpp ^
+    Loaders/Filters/BiquadBank.cpp ^
+    Loaders/Filters/BiquadCascade.cpp ^
+    Loaders/Filters/ZeroLatencyConvolver.cpp ^
+    Loaders/Filters/PartitionedConvolver.cpp ^
+    Loaders/Utilities/FFT.cpp ^
+    Tests/Filters/BiquadFilter.cpp ^
     Tests/Filters/FastConvolver.cpp ^
+    Tests/Filters/MultirateConvolver.cpp ^
+    Tests/Filters/MultichannelConvolver.cpp ^
+    Tests/Filters/ConvolutionMatrix.cpp ^
+    Tests/Filters/Convolver.cpp ^
+    Tests/Filters/SpikeConvolver.cpp ^
+    Tests/Filters/BiquadBank.cpp ^
+    Tests/Filters/BiquadCascade.cpp ^
+    Tests/Filters/ZeroLatencyConvolver.cpp ^
+    Tests/Filters/PartitionedConvolver.cpp ^
+    Tests/Utilities/FFT.cpp ^
     main.cpp ^
     -std=c++17 -O2 -static-libgcc -static-libstdc++ -static -m64 -lpsapi
 